@@ -122,7 +122,7 @@ foreach(log_type ${log_types})
     endforeach()
     ginkgo_print_module_footer(${${log_type}} "  Documentation:")
     set(print_var
-        "GINKGO_BUILD_DOC;GINKGO_VERBOSE_LEVEL")
+        "GINKGO_BUILD_DOC;GINKGO_VERBOSE_LEVEL;GINKGO_DISABLE_LOGGING")
     foreach(var ${print_var})
         ginkgo_print_variable(${${log_type}} ${var} )
     endforeach()
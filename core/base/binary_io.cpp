@@ -0,0 +1,649 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/binary_io.hpp>
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/base/mapped_file.hpp"
+#include "core/base/parallel_tasks.hpp"
+#include "core/base/serialization.hpp"
+
+
+namespace gko {
+namespace {
+
+
+// every data section starts at a multiple of this many bytes
+constexpr std::uint64_t binary_alignment = 64;
+
+
+/**
+ * the header at the start of each binary file
+ */
+struct binary_header {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint32_t format;
+    std::uint32_t value_type;
+    std::uint32_t index_type;
+    std::uint32_t reserved;
+    std::uint64_t num_rows;
+    std::uint64_t num_cols;
+    std::uint64_t num_stored_elements;
+    std::uint64_t row_ptrs_offset;
+    std::uint64_t col_idxs_offset;
+    std::uint64_t values_offset;
+};
+
+static_assert(std::is_standard_layout<binary_header>::value &&
+                  sizeof(binary_header) == 80,
+              "binary_header must not contain padding");
+
+
+std::uint64_t align_offset(std::uint64_t offset)
+{
+    return ceildiv(offset, binary_alignment) * binary_alignment;
+}
+
+
+void write_section(std::ostream &os, std::uint64_t &position,
+                   std::uint64_t offset, const void *data, std::uint64_t size)
+{
+    static const char padding[binary_alignment] = {};
+    if (!os.write(padding, offset - position) ||
+        !os.write(static_cast<const char *>(data), size)) {
+        throw GKO_STREAM_ERROR("error when writing binary matrix data");
+    }
+    position = offset + size;
+}
+
+
+/**
+ * checks that a section of `num_elems` elements of `elem_size` bytes each
+ * starting at `offset` is aligned and lies inside a file of `file_size` bytes,
+ * without computing its size in bytes, which may overflow for corrupted files
+ */
+bool section_fits(std::uint64_t file_size, std::uint64_t offset,
+                  std::uint64_t num_elems, std::uint64_t elem_size)
+{
+    return offset % binary_alignment == 0 && offset <= file_size &&
+           num_elems <= (file_size - offset) / elem_size;
+}
+
+
+/**
+ * checks that a row, column or nonzero count can be used with IndexType
+ */
+template <typename IndexType>
+bool fits_index_type(std::uint64_t value)
+{
+    return value <= static_cast<std::uint64_t>(
+                        std::numeric_limits<IndexType>::max());
+}
+
+
+/**
+ * creates an array pointing into the mapped file, which keeps the mapping
+ * alive until it is destroyed
+ */
+template <typename T>
+Array<T> map_array(std::shared_ptr<const Executor> exec,
+                   std::shared_ptr<mapped_file> file, std::uint64_t offset,
+                   std::uint64_t num_elems)
+{
+    auto data = reinterpret_cast<T *>(file->get_data() + offset);
+    return Array<T>{std::move(exec), static_cast<size_type>(num_elems), data,
+                    [file](T *) {}};
+}
+
+
+// the number of consecutive rows whose indexes are encoded independently
+constexpr std::uint64_t compressed_rows_per_block = 1024;
+
+// the minimal number of rows and nonzeros decoded by a single thread
+constexpr size_type min_decode_work = size_type{1} << 16;
+
+
+/**
+ * the header at the start of each compressed binary file, the first fields
+ * match binary_header
+ */
+struct compressed_header {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint32_t format;
+    std::uint32_t value_type;
+    std::uint32_t index_type;
+    std::uint32_t value_storage;
+    std::uint64_t num_rows;
+    std::uint64_t num_cols;
+    std::uint64_t num_stored_elements;
+    std::uint64_t rows_per_block;
+    std::uint64_t blocks_offset;
+    std::uint64_t indexes_offset;
+    std::uint64_t values_offset;
+};
+
+static_assert(std::is_standard_layout<compressed_header>::value &&
+                  sizeof(compressed_header) == 88,
+              "compressed_header must not contain padding");
+
+
+/**
+ * an entry of the block index, storing where the nonzeros and the encoded
+ * indexes of a block of rows start. The last entry stores the totals.
+ */
+struct compressed_block {
+    std::uint64_t first_nonzero;
+    std::uint64_t index_offset;
+};
+
+
+/**
+ * the type in which truncated values are stored, i.e. the single precision
+ * counterpart of ValueType
+ */
+template <typename ValueType>
+using truncated_type =
+    std::conditional_t<(sizeof(remove_complex<ValueType>) > sizeof(float)),
+                       reduce_precision<ValueType>, ValueType>;
+
+
+/**
+ * maps signed integers to unsigned integers such that numbers with a small
+ * magnitude have a short varint encoding
+ */
+inline std::uint64_t zigzag_encode(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^
+           static_cast<std::uint64_t>(value >> 63);
+}
+
+
+inline std::int64_t zigzag_decode(std::uint64_t code)
+{
+    return static_cast<std::int64_t>(code >> 1) ^
+           -static_cast<std::int64_t>(code & 1);
+}
+
+
+/**
+ * appends an unsigned integer in LEB128 encoding, i.e. 7 bits per byte with
+ * the highest bit marking continuation
+ */
+inline void append_varint(std::string &out, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+
+/**
+ * reads an integer written by append_varint from `[it, end)`
+ *
+ * @return true iff a complete integer was found
+ */
+inline bool read_varint(const unsigned char *&it, const unsigned char *end,
+                        std::uint64_t &value)
+{
+    std::uint64_t result{};
+    for (int shift = 0; shift < 64 && it != end; shift += 7) {
+        const auto byte = *it++;
+        result |= std::uint64_t{byte & 0x7fu} << shift;
+        if (byte < 0x80) {
+            value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * encodes the indexes of the rows `[begin, end)`: the number of nonzeros of
+ * each row is followed by the differences between consecutive column
+ * indexes, where the first column is relative to the row index
+ */
+template <typename IndexType>
+void encode_rows(std::string &out, const IndexType *row_ptrs,
+                 const IndexType *col_idxs, size_type begin, size_type end)
+{
+    for (auto row = begin; row < end; ++row) {
+        append_varint(out, row_ptrs[row + 1] - row_ptrs[row]);
+        auto previous = static_cast<std::int64_t>(row);
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            append_varint(out, zigzag_encode(col_idxs[nz] - previous));
+            previous = col_idxs[nz];
+        }
+    }
+}
+
+
+/**
+ * decodes the indexes of a block of rows written by encode_rows
+ *
+ * @return true iff the encoded data is consistent with the block index
+ */
+template <typename IndexType>
+bool decode_rows(const unsigned char *it, const unsigned char *end,
+                 const compressed_block &block,
+                 const compressed_block &next_block, std::uint64_t num_cols,
+                 size_type begin, size_type end_row, IndexType *row_ptrs,
+                 IndexType *col_idxs)
+{
+    auto nz = block.first_nonzero;
+    for (auto row = begin; row < end_row; ++row) {
+        std::uint64_t row_nnz{};
+        if (!read_varint(it, end, row_nnz) ||
+            row_nnz > next_block.first_nonzero - nz) {
+            return false;
+        }
+        auto previous = static_cast<std::int64_t>(row);
+        for (const auto row_end = nz + row_nnz; nz < row_end; ++nz) {
+            std::uint64_t code{};
+            if (!read_varint(it, end, code)) {
+                return false;
+            }
+            const auto col = previous + zigzag_decode(code);
+            if (col < 0 || static_cast<std::uint64_t>(col) >= num_cols) {
+                return false;
+            }
+            col_idxs[nz] = static_cast<IndexType>(col);
+            previous = col;
+        }
+        row_ptrs[row + 1] = static_cast<IndexType>(nz);
+    }
+    return it == end && nz == next_block.first_nonzero;
+}
+
+
+/**
+ * reads a CSR matrix from a mapped file in the compressed binary format
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_compressed(
+    const std::string &filename, std::shared_ptr<mapped_file> file,
+    std::shared_ptr<const Executor> exec)
+{
+    using Csr = matrix::Csr<ValueType, IndexType>;
+    using stored_type = truncated_type<ValueType>;
+    const auto file_size = file->get_size();
+    compressed_header header{};
+    if (file_size < sizeof(header)) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+    std::memcpy(&header, file->get_const_data(), sizeof(header));
+    const auto truncated =
+        header.value_storage ==
+        static_cast<std::uint32_t>(binary_value_storage::single_precision);
+    const auto value_size =
+        truncated ? sizeof(stored_type) : sizeof(ValueType);
+    const auto num_rows = header.num_rows;
+    const auto nnz = header.num_stored_elements;
+    // computed without rounding up first, which may overflow
+    const auto num_blocks =
+        header.rows_per_block == 0
+            ? std::uint64_t{}
+            : num_rows / header.rows_per_block +
+                  (num_rows % header.rows_per_block != 0);
+    if ((!truncated &&
+         header.value_storage !=
+             static_cast<std::uint32_t>(binary_value_storage::exact)) ||
+        (num_rows > 0 && header.rows_per_block == 0) ||
+        !fits_index_type<IndexType>(num_rows) ||
+        !fits_index_type<IndexType>(header.num_cols) ||
+        !fits_index_type<IndexType>(nnz) ||
+        !section_fits(file_size, header.blocks_offset, num_blocks + 1,
+                      sizeof(compressed_block)) ||
+        !section_fits(file_size, header.values_offset, nnz, value_size)) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+    // the whole block index lies inside the file, so it can be read now
+    auto blocks = reinterpret_cast<const compressed_block *>(
+        file->get_const_data() + header.blocks_offset);
+    // the block index needs to be consistent before decoding any block
+    const auto index_size = blocks[num_blocks].index_offset;
+    // every row and every nonzero is encoded in at least one byte
+    bool valid = blocks[0].first_nonzero == 0 &&
+                 blocks[0].index_offset == 0 &&
+                 blocks[num_blocks].first_nonzero == nnz &&
+                 num_rows <= index_size && nnz <= index_size &&
+                 section_fits(file_size, header.indexes_offset, index_size, 1);
+    for (std::uint64_t block = 0; valid && block < num_blocks; ++block) {
+        valid =
+            blocks[block].first_nonzero <= blocks[block + 1].first_nonzero &&
+            blocks[block].index_offset <= blocks[block + 1].index_offset;
+    }
+    if (!valid) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+
+    auto host = exec->get_master();
+    Array<IndexType> row_ptrs{host, num_rows + 1};
+    Array<IndexType> col_idxs{host, nnz};
+    Array<ValueType> values{host};
+    if (truncated) {
+        values.resize_and_reset(nnz);
+    } else {
+        values = map_array<ValueType>(host, file, header.values_offset, nnz);
+    }
+    row_ptrs.get_data()[0] = 0;
+    const auto indexes = reinterpret_cast<const unsigned char *>(
+        file->get_const_data() + header.indexes_offset);
+    const auto stored_values = reinterpret_cast<const stored_type *>(
+        file->get_const_data() + header.values_offset);
+    // each thread decodes a contiguous range of blocks
+    const auto num_tasks = std::min<size_type>(
+        get_num_parallel_tasks(num_rows + nnz, min_decode_work),
+        std::max<std::uint64_t>(num_blocks, 1));
+    std::vector<unsigned char> task_valid(num_tasks, true);
+    run_parallel(num_tasks, [&](size_type task) {
+        const auto first_block = num_blocks * task / num_tasks;
+        const auto last_block = num_blocks * (task + 1) / num_tasks;
+        for (auto block = first_block; block < last_block; ++block) {
+            const auto begin = block * header.rows_per_block;
+            const auto end =
+                std::min(begin + header.rows_per_block, num_rows);
+            if (!decode_rows(indexes + blocks[block].index_offset,
+                             indexes + blocks[block + 1].index_offset,
+                             blocks[block], blocks[block + 1],
+                             header.num_cols, begin, end, row_ptrs.get_data(),
+                             col_idxs.get_data())) {
+                task_valid[task] = false;
+                return;
+            }
+        }
+        if (truncated) {
+            const auto first_nz = blocks[first_block].first_nonzero;
+            const auto last_nz = blocks[last_block].first_nonzero;
+            std::copy(stored_values + first_nz, stored_values + last_nz,
+                      values.get_data() + first_nz);
+        }
+    });
+    if (std::find(task_valid.begin(), task_valid.end(), false) !=
+        task_valid.end()) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+    auto result = Csr::create(host, dim<2>{num_rows, header.num_cols},
+                              std::move(values), std::move(col_idxs),
+                              std::move(row_ptrs));
+    if (exec != host) {
+        return gko::clone(exec, result);
+    }
+    return result;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void write_binary(std::ostream &os,
+                  const matrix::Csr<ValueType, IndexType> *matrix)
+{
+    auto host_matrix = make_temporary_clone(
+        matrix->get_executor()->get_master(), matrix);
+    const auto num_rows = host_matrix->get_size()[0];
+    const auto nnz = host_matrix->get_num_stored_elements();
+    binary_header header{};
+    std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+    header.byte_order = binary_byte_order;
+    header.version = binary_version;
+    header.format = static_cast<std::uint32_t>(binary_format::csr);
+    header.value_type = binary_type_id<ValueType>::value;
+    header.index_type = binary_type_id<IndexType>::value;
+    header.num_rows = num_rows;
+    header.num_cols = host_matrix->get_size()[1];
+    header.num_stored_elements = nnz;
+    header.row_ptrs_offset = align_offset(sizeof(binary_header));
+    header.col_idxs_offset = align_offset(
+        header.row_ptrs_offset + (num_rows + 1) * sizeof(IndexType));
+    header.values_offset =
+        align_offset(header.col_idxs_offset + nnz * sizeof(IndexType));
+    std::uint64_t position{};
+    write_section(os, position, 0, &header, sizeof(header));
+    write_section(os, position, header.row_ptrs_offset,
+                  host_matrix->get_const_row_ptrs(),
+                  (num_rows + 1) * sizeof(IndexType));
+    write_section(os, position, header.col_idxs_offset,
+                  host_matrix->get_const_col_idxs(), nnz * sizeof(IndexType));
+    write_section(os, position, header.values_offset,
+                  host_matrix->get_const_values(), nnz * sizeof(ValueType));
+}
+
+
+template <typename ValueType, typename IndexType>
+void write_compressed_binary(std::ostream &os,
+                             const matrix::Csr<ValueType, IndexType> *matrix,
+                             binary_value_storage value_storage)
+{
+    using stored_type = truncated_type<ValueType>;
+    auto host_matrix = make_temporary_clone(
+        matrix->get_executor()->get_master(), matrix);
+    const auto num_rows = host_matrix->get_size()[0];
+    const auto nnz = host_matrix->get_num_stored_elements();
+    const auto row_ptrs = host_matrix->get_const_row_ptrs();
+    const auto col_idxs = host_matrix->get_const_col_idxs();
+    const auto values = host_matrix->get_const_values();
+    const auto num_blocks = static_cast<size_type>(
+        ceildiv(num_rows, compressed_rows_per_block));
+    // encode the blocks concurrently, each thread handles a contiguous range
+    const auto num_tasks = std::min<size_type>(
+        get_num_parallel_tasks(num_rows + nnz, min_decode_work),
+        std::max<size_type>(num_blocks, 1));
+    std::vector<std::string> encoded(num_blocks);
+    std::vector<std::exception_ptr> errors(num_tasks);
+    run_parallel(num_tasks, [&](size_type task) {
+        const auto first_block = num_blocks * task / num_tasks;
+        const auto last_block = num_blocks * (task + 1) / num_tasks;
+        try {
+            for (auto block = first_block; block < last_block; ++block) {
+                const auto begin = block * compressed_rows_per_block;
+                const auto end =
+                    std::min<size_type>(begin + compressed_rows_per_block,
+                                        num_rows);
+                encode_rows(encoded[block], row_ptrs, col_idxs, begin, end);
+            }
+        } catch (...) {
+            errors[task] = std::current_exception();
+        }
+    });
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    std::vector<compressed_block> blocks(num_blocks + 1);
+    for (size_type block = 0; block < num_blocks; ++block) {
+        const auto next_row =
+            std::min<size_type>((block + 1) * compressed_rows_per_block,
+                                num_rows);
+        blocks[block + 1].first_nonzero = row_ptrs[next_row];
+        blocks[block + 1].index_offset =
+            blocks[block].index_offset + encoded[block].size();
+    }
+
+    const auto truncate =
+        value_storage == binary_value_storage::single_precision;
+    compressed_header header{};
+    std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+    header.byte_order = binary_byte_order;
+    header.version = binary_version;
+    header.format =
+        static_cast<std::uint32_t>(binary_format::compressed_csr);
+    header.value_type = binary_type_id<ValueType>::value;
+    header.index_type = binary_type_id<IndexType>::value;
+    header.value_storage = static_cast<std::uint32_t>(value_storage);
+    header.num_rows = num_rows;
+    header.num_cols = host_matrix->get_size()[1];
+    header.num_stored_elements = nnz;
+    header.rows_per_block = compressed_rows_per_block;
+    header.blocks_offset = align_offset(sizeof(compressed_header));
+    header.indexes_offset = align_offset(
+        header.blocks_offset + blocks.size() * sizeof(compressed_block));
+    header.values_offset =
+        align_offset(header.indexes_offset + blocks.back().index_offset);
+    std::uint64_t position{};
+    write_section(os, position, 0, &header, sizeof(header));
+    write_section(os, position, header.blocks_offset, blocks.data(),
+                  blocks.size() * sizeof(compressed_block));
+    auto offset = header.indexes_offset;
+    for (const auto &block : encoded) {
+        write_section(os, position, offset, block.data(), block.size());
+        offset = position;
+    }
+    if (truncate) {
+        std::vector<stored_type> stored_values(nnz);
+        std::transform(values, values + nnz, stored_values.begin(),
+                       [](ValueType value) {
+                           return static_cast<stored_type>(value);
+                       });
+        write_section(os, position, header.values_offset,
+                      stored_values.data(), nnz * sizeof(stored_type));
+    } else {
+        write_section(os, position, header.values_offset, values,
+                      nnz * sizeof(ValueType));
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary(
+    const std::string &filename, std::shared_ptr<const Executor> exec)
+{
+    using Csr = matrix::Csr<ValueType, IndexType>;
+    auto file = std::make_shared<mapped_file>(filename);
+    const auto file_size = file->get_size();
+    binary_header header{};
+    if (file_size < sizeof(header)) {
+        throw GKO_STREAM_ERROR(filename + " is not a Ginkgo binary file");
+    }
+    std::memcpy(&header, file->get_const_data(), sizeof(header));
+    if (std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0) {
+        throw GKO_STREAM_ERROR(filename + " is not a Ginkgo binary file");
+    }
+    if (header.byte_order != binary_byte_order) {
+        throw GKO_STREAM_ERROR(filename +
+                               " was written with a different byte order");
+    }
+    const auto compressed =
+        header.format ==
+        static_cast<std::uint32_t>(binary_format::compressed_csr);
+    if (header.version != binary_version ||
+        (header.format != static_cast<std::uint32_t>(binary_format::csr) &&
+         !compressed)) {
+        throw GKO_STREAM_ERROR(filename +
+                               " uses an unsupported binary format version");
+    }
+    if (header.value_type != binary_type_id<ValueType>::value ||
+        header.index_type != binary_type_id<IndexType>::value) {
+        throw GKO_STREAM_ERROR(
+            filename + " stores a different value or index type");
+    }
+    if (compressed) {
+        return read_compressed<ValueType, IndexType>(filename, std::move(file),
+                                                     std::move(exec));
+    }
+    const auto num_rows = header.num_rows;
+    const auto nnz = header.num_stored_elements;
+    // num_rows fits into IndexType, so num_rows + 1 does not overflow
+    if (!fits_index_type<IndexType>(num_rows) ||
+        !fits_index_type<IndexType>(header.num_cols) ||
+        !fits_index_type<IndexType>(nnz) ||
+        !section_fits(file_size, header.row_ptrs_offset, num_rows + 1,
+                      sizeof(IndexType)) ||
+        !section_fits(file_size, header.col_idxs_offset, nnz,
+                      sizeof(IndexType)) ||
+        !section_fits(file_size, header.values_offset, nnz,
+                      sizeof(ValueType))) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+    auto host = exec->get_master();
+    auto row_ptrs =
+        map_array<IndexType>(host, file, header.row_ptrs_offset, num_rows + 1);
+    auto col_idxs =
+        map_array<IndexType>(host, file, header.col_idxs_offset, nnz);
+    if (!valid_csr_indexes(row_ptrs.get_const_data(),
+                           col_idxs.get_const_data(), num_rows,
+                           header.num_cols, nnz)) {
+        throw GKO_STREAM_ERROR(filename + " is truncated or corrupted");
+    }
+    auto result = Csr::create(
+        host, dim<2>{num_rows, header.num_cols},
+        map_array<ValueType>(host, file, header.values_offset, nnz),
+        std::move(col_idxs), std::move(row_ptrs));
+    if (exec != host) {
+        return gko::clone(exec, result);
+    }
+    return result;
+}
+
+
+#define GKO_DECLARE_WRITE_BINARY(ValueType, IndexType)                 \
+    void write_binary(std::ostream &os,                                \
+                      const matrix::Csr<ValueType, IndexType> *matrix)
+#define GKO_DECLARE_READ_BINARY(ValueType, IndexType)                      \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary(        \
+        const std::string &filename, std::shared_ptr<const Executor> exec)
+#define GKO_DECLARE_WRITE_COMPRESSED_BINARY(ValueType, IndexType) \
+    void write_compressed_binary(                                 \
+        std::ostream &os,                                         \
+        const matrix::Csr<ValueType, IndexType> *matrix,          \
+        binary_value_storage value_storage)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_WRITE_COMPRESSED_BINARY);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY);
+
+
+}  // namespace gko
@@ -0,0 +1,91 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_BASE_HOST_OPERATION_HPP_
+#define GKO_CORE_BASE_HOST_OPERATION_HPP_
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+/**
+ * Binds a kernel working on host memory to an Operation, like
+ * GKO_REGISTER_OPERATION does for kernels available on every executor.
+ *
+ * The kernel is only searched in the `omp` and `reference` namespaces, so
+ * host kernels need neither CUDA nor HIP versions. The operation has to be
+ * run on a host executor, e.g. `exec->get_master()`, running it on a device
+ * executor throws NotImplemented.
+ *
+ * @param _name  operation name
+ * @param _kernel  kernel which will be bound to the operation
+ */
+#define GKO_REGISTER_HOST_OPERATION(_name, _kernel)                          \
+    template <typename... Args>                                              \
+    class _name##_operation : public Operation {                             \
+        using counts =                                                       \
+            ::gko::syn::as_list<::gko::syn::range<0, sizeof...(Args)>>;      \
+                                                                             \
+    public:                                                                  \
+        explicit _name##_operation(Args &&... args)                          \
+            : data(std::forward<Args>(args)...)                              \
+        {}                                                                   \
+                                                                             \
+        const char *get_name() const noexcept override                       \
+        {                                                                    \
+            static auto name = [this] {                                      \
+                std::ostringstream oss;                                      \
+                oss << #_kernel << '#' << sizeof...(Args);                   \
+                return oss.str();                                            \
+            }();                                                             \
+            return name.c_str();                                             \
+        }                                                                    \
+                                                                             \
+        GKO_KERNEL_DETAIL_DEFINE_RUN_OVERLOAD(OmpExecutor, omp, _kernel);    \
+        GKO_KERNEL_DETAIL_DEFINE_RUN_OVERLOAD(ReferenceExecutor, reference,  \
+                                              _kernel);                      \
+                                                                             \
+    private:                                                                 \
+        mutable std::tuple<Args &&...> data;                                 \
+    };                                                                       \
+                                                                             \
+    template <typename... Args>                                              \
+    static _name##_operation<Args...> make_##_name(Args &&... args)          \
+    {                                                                        \
+        return _name##_operation<Args...>(std::forward<Args>(args)...);      \
+    }                                                                        \
+    static_assert(true,                                                      \
+                  "This assert is used to counter the false positive extra " \
+                  "semi-colon warnings")
+
+
+#endif  // GKO_CORE_BASE_HOST_OPERATION_HPP_
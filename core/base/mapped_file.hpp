@@ -0,0 +1,160 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_BASE_MAPPED_FILE_HPP_
+#define GKO_CORE_BASE_MAPPED_FILE_HPP_
+
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+#include <ginkgo/config.hpp>
+
+
+#ifdef GKO_HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // GKO_HAVE_SYS_MMAN_H
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+
+
+/**
+ * @internal
+ *
+ * Provides the complete contents of a file as a contiguous block of memory.
+ *
+ * The file is memory-mapped if the platform supports it, and read into memory
+ * otherwise. The mapping is private, so the memory can be modified without
+ * affecting the file: pages are only copied once they are written to.
+ */
+class mapped_file {
+public:
+    /**
+     * Maps the file with the given name into memory.
+     *
+     * @param filename  the name of the file
+     *
+     * @throw StreamError  if the file cannot be opened or mapped
+     */
+    explicit mapped_file(const std::string &filename)
+    {
+#ifdef GKO_HAVE_SYS_MMAN_H
+        const auto fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw GKO_STREAM_ERROR("error when opening file " + filename);
+        }
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) == -1) {
+            ::close(fd);
+            throw GKO_STREAM_ERROR("error when determining size of file " +
+                                   filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ > 0) {
+            auto mapped = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw GKO_STREAM_ERROR("error when mapping file " + filename);
+            }
+            data_ = static_cast<char *>(mapped);
+        }
+        ::close(fd);
+#else
+        std::ifstream stream(filename, std::ios::binary);
+        if (!stream) {
+            throw GKO_STREAM_ERROR("error when opening file " + filename);
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(stream),
+                       std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif  // GKO_HAVE_SYS_MMAN_H
+    }
+
+    mapped_file(const mapped_file &) = delete;
+
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    ~mapped_file()
+    {
+#ifdef GKO_HAVE_SYS_MMAN_H
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+#endif  // GKO_HAVE_SYS_MMAN_H
+    }
+
+    /**
+     * Returns the start of the file contents.
+     *
+     * @return the start of the file contents
+     */
+    char *get_data() noexcept { return data_; }
+
+    /**
+     * @copydoc get_data()
+     */
+    const char *get_const_data() const noexcept { return data_; }
+
+    /**
+     * Returns the size of the file in bytes.
+     *
+     * @return the size of the file in bytes
+     */
+    size_type get_size() const noexcept { return size_; }
+
+private:
+    char *data_{};
+    size_type size_{};
+#ifndef GKO_HAVE_SYS_MMAN_H
+    std::vector<char> buffer_;
+#endif  // GKO_HAVE_SYS_MMAN_H
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_MAPPED_FILE_HPP_
@@ -35,10 +35,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <limits>
 #include <map>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 
 #include <ginkgo/core/base/exception_helpers.hpp>
@@ -46,6 +56,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/utils.hpp>
 
 
+#include "core/base/mapped_file.hpp"
+#include "core/base/parallel_tasks.hpp"
+
+
 namespace gko {
 namespace {
 
@@ -63,6 +77,332 @@ namespace {
     }
 
 
+inline bool is_space(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' ||
+           c == '\f';
+}
+
+
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+
+inline void skip_space(const char *&it, const char *end)
+{
+    while (it != end && is_space(*it)) {
+        ++it;
+    }
+}
+
+
+/**
+ * Skips a whitespace-separated token at the start of `[it, end)` without
+ * interpreting it, skipping leading whitespace.
+ *
+ * @return true iff a token was found
+ */
+inline bool skip_token(const char *&it, const char *end)
+{
+    skip_space(it, end);
+    const auto token_begin = it;
+    while (it != end && !is_space(*it)) {
+        ++it;
+    }
+    return it != token_begin;
+}
+
+
+/**
+ * Skips a whitespace-separated token in a stream without interpreting it,
+ * skipping leading whitespace.
+ *
+ * @return true iff a token was found
+ */
+inline bool skip_token(std::istream &is)
+{
+    using traits = std::istream::traits_type;
+    if (!(is >> std::ws)) {
+        return false;
+    }
+    size_type length = 0;
+    while (is.peek() != traits::eof() &&
+           !is_space(traits::to_char_type(is.peek()))) {
+        is.get();
+        ++length;
+    }
+    return length > 0;
+}
+
+
+/**
+ * Parses a decimal integer at the start of `[it, end)`, skipping leading
+ * whitespace. On success, `it` is advanced past the number.
+ *
+ * @return true iff a complete integer token was found whose magnitude is
+ *         representable in IndexType
+ */
+template <typename IndexType>
+bool parse_index(const char *&it, const char *end, IndexType &value)
+{
+    skip_space(it, end);
+    auto pos = it;
+    bool negative = false;
+    if (pos != end && (*pos == '+' || *pos == '-')) {
+        negative = *pos == '-';
+        ++pos;
+    }
+    if (pos == end || !is_digit(*pos)) {
+        return false;
+    }
+    constexpr auto max_value =
+        static_cast<std::int64_t>(std::numeric_limits<IndexType>::max());
+    std::int64_t result{};
+    for (; pos != end && is_digit(*pos); ++pos) {
+        const auto digit = *pos - '0';
+        if (result > (max_value - digit) / 10) {
+            return false;
+        }
+        result = 10 * result + digit;
+    }
+    if (pos != end && !is_space(*pos)) {
+        return false;
+    }
+    value = static_cast<IndexType>(negative ? -result : result);
+    it = pos;
+    return true;
+}
+
+
+// powers of ten which are exactly representable as double
+constexpr double exact_powers[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+constexpr int max_exact_power = 22;
+
+
+/**
+ * Parses a floating point number at the start of `[it, end)`, skipping
+ * leading whitespace. On success, `it` is advanced past the number.
+ *
+ * Numbers with at most 15 significant digits and a small decimal exponent
+ * are converted exactly by a single multiplication or division, everything
+ * else is handed to std::strtod, so the result always matches the stream
+ * based reader.
+ *
+ * @return true iff a complete floating point token was found
+ */
+inline bool parse_real(const char *&it, const char *end, double &value)
+{
+    constexpr int max_exact_digits = 15;
+    skip_space(it, end);
+    auto token_end = it;
+    while (token_end != end && !is_space(*token_end)) {
+        ++token_end;
+    }
+    if (token_end == it) {
+        return false;
+    }
+    auto pos = it;
+    bool negative = false;
+    if (*pos == '+' || *pos == '-') {
+        negative = *pos == '-';
+        ++pos;
+    }
+    std::uint64_t mantissa{};
+    int num_digits{};
+    int exponent{};
+    bool has_digits = false;
+    for (; pos != token_end && is_digit(*pos); ++pos) {
+        has_digits = true;
+        if (mantissa != 0 || *pos != '0') {
+            mantissa = 10 * mantissa + (*pos - '0');
+            ++num_digits;
+        }
+        if (num_digits > max_exact_digits) {
+            break;
+        }
+    }
+    if (pos != token_end && *pos == '.') {
+        for (++pos; pos != token_end && is_digit(*pos); ++pos) {
+            has_digits = true;
+            if (mantissa != 0 || *pos != '0') {
+                mantissa = 10 * mantissa + (*pos - '0');
+                ++num_digits;
+            }
+            --exponent;
+            if (num_digits > max_exact_digits) {
+                break;
+            }
+        }
+    }
+    if (has_digits && pos != token_end && (*pos == 'e' || *pos == 'E')) {
+        ++pos;
+        bool negative_exponent = false;
+        if (pos != token_end && (*pos == '+' || *pos == '-')) {
+            negative_exponent = *pos == '-';
+            ++pos;
+        }
+        int explicit_exponent{};
+        bool has_exponent_digits = false;
+        for (; pos != token_end && is_digit(*pos) &&
+               explicit_exponent < 10 * max_exact_power;
+             ++pos) {
+            has_exponent_digits = true;
+            explicit_exponent = 10 * explicit_exponent + (*pos - '0');
+        }
+        exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+        if (!has_exponent_digits) {
+            has_digits = false;
+        }
+    }
+    if (has_digits && pos == token_end && num_digits <= max_exact_digits &&
+        exponent >= -max_exact_power && exponent <= max_exact_power) {
+        auto result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / exact_powers[-exponent]
+                              : result * exact_powers[exponent];
+        value = negative ? -result : result;
+        it = token_end;
+        return true;
+    }
+    // slow path, the token needs to be null-terminated for strtod
+    const std::string token(it, token_end);
+    char *parsed_end{};
+    value = std::strtod(token.c_str(), &parsed_end);
+    if (parsed_end != token.c_str() + token.size()) {
+        return false;
+    }
+    it = token_end;
+    return true;
+}
+
+
+/**
+ * Appends the decimal representation of an integer to `out`.
+ */
+inline void format_index(std::string &out, std::int64_t value)
+{
+    char buffer[20];
+    auto pos = buffer + sizeof(buffer);
+    auto magnitude = value < 0 ? -static_cast<std::uint64_t>(value)
+                               : static_cast<std::uint64_t>(value);
+    do {
+        *--pos = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) {
+        out.push_back('-');
+    }
+    out.append(pos, buffer + sizeof(buffer));
+}
+
+
+/**
+ * Appends a floating point number to `out`, formatted the same way
+ * `std::ostream` formats it by default, i.e. like the printf format `%g` with
+ * 6 significant digits.
+ *
+ * The significant digits are computed by a single multiplication or division
+ * by an exactly representable power of ten. Numbers whose scaled value is too
+ * close to a rounding boundary to round it safely, and numbers with a large
+ * exponent, are handed to std::snprintf, so the result always matches the
+ * stream based writer.
+ */
+inline void format_real(std::string &out, double value)
+{
+    constexpr int precision = 6;
+    constexpr double min_scaled = 1e5;
+    constexpr double max_scaled = 1e6;
+    // bound on the rounding error of the scaled value, which is below 1e6
+    constexpr double rounding_tolerance = 1e-9;
+    const auto magnitude = std::abs(value);
+    if (magnitude == 0.0) {
+        out.append(std::signbit(value) ? "-0" : "0");
+        return;
+    }
+    auto exponent = std::isfinite(value)
+                        ? static_cast<int>(std::floor(std::log10(magnitude)))
+                        : 0;
+    auto scale = [&](int estimate, double &scaled) {
+        const auto shift = precision - 1 - estimate;
+        if (shift < -max_exact_power || shift > max_exact_power) {
+            return false;
+        }
+        scaled = shift < 0 ? magnitude / exact_powers[-shift]
+                           : magnitude * exact_powers[shift];
+        return true;
+    };
+    double scaled{};
+    bool exact = std::isfinite(value) && scale(exponent, scaled);
+    // std::log10 may be off by one close to powers of ten
+    if (exact && scaled < min_scaled) {
+        exact = scale(--exponent, scaled);
+    } else if (exact && scaled >= max_scaled) {
+        exact = scale(++exponent, scaled);
+    }
+    auto digits = static_cast<std::int64_t>(scaled);
+    const auto fraction = scaled - static_cast<double>(digits);
+    if (!exact || scaled < min_scaled || scaled >= max_scaled ||
+        std::abs(fraction - 0.5) < rounding_tolerance) {
+        char buffer[32];
+        const auto length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+        out.append(buffer, length);
+        return;
+    }
+    if (fraction > 0.5) {
+        ++digits;
+    }
+    if (digits == static_cast<std::int64_t>(max_scaled)) {
+        digits /= 10;
+        ++exponent;
+    }
+    char digit_chars[precision];
+    for (int i = precision - 1; i >= 0; --i) {
+        digit_chars[i] = static_cast<char>('0' + digits % 10);
+        digits /= 10;
+    }
+    int num_digits = precision;
+    while (num_digits > 1 && digit_chars[num_digits - 1] == '0') {
+        --num_digits;
+    }
+    if (value < 0) {
+        out.push_back('-');
+    }
+    if (exponent < -4 || exponent >= precision) {
+        out.push_back(digit_chars[0]);
+        if (num_digits > 1) {
+            out.push_back('.');
+            out.append(digit_chars + 1, num_digits - 1);
+        }
+        out.append(exponent < 0 ? "e-" : "e+");
+        if (std::abs(exponent) < 10) {
+            out.push_back('0');
+        }
+        format_index(out, std::abs(exponent));
+    } else if (exponent < 0) {
+        out.append("0.");
+        out.append(-exponent - 1, '0');
+        out.append(digit_chars, num_digits);
+    } else if (num_digits <= exponent + 1) {
+        out.append(digit_chars, num_digits);
+        out.append(exponent + 1 - num_digits, '0');
+    } else {
+        out.append(digit_chars, exponent + 1);
+        out.push_back('.');
+        out.append(digit_chars + exponent + 1, num_digits - exponent - 1);
+    }
+}
+
+
+/**
+ * Checks whether a stream formats numbers the way format_index and
+ * format_real do, i.e. with the default flags, precision and width.
+ */
+inline bool has_default_format(const std::ostream &os)
+{
+    return os.flags() == (std::ios_base::dec | std::ios_base::skipws) &&
+           os.precision() == 6 && os.width() == 0;
+}
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -96,10 +436,183 @@ public:
         std::istringstream dimensions_stream(parsed_header.dimensions_line);
         auto data = parsed_header.layout->read_data(
             dimensions_stream, is, parsed_header.entry, parsed_header.modifier);
-        data.ensure_row_major_order();
+        // keep duplicate entries in file order, like the file reader does
+        using nonzero_type =
+            typename matrix_data<ValueType, IndexType>::nonzero_type;
+        auto &nonzeros = data.nonzeros;
+        if (!std::is_sorted(nonzeros.begin(), nonzeros.end(),
+                            row_major_less<nonzero_type>)) {
+            std::stable_sort(nonzeros.begin(), nonzeros.end(),
+                             row_major_less<nonzero_type>);
+        }
         return data;
     }
 
+    /**
+     * Reads a matrix from a character buffer holding the complete file.
+     *
+     * The entries of coordinate files are parsed and sorted concurrently in
+     * line-aligned chunks, other layouts are read through the stream
+     * interface.
+     *
+     * @param begin  the start of the buffer
+     * @param end  the end of the buffer
+     *
+     * @return the matrix data.
+     */
+    matrix_data<ValueType, IndexType> read(const char *begin,
+                                           const char *end) const
+    {
+        auto content_begin = find_content(begin, end);
+        std::istringstream header_stream(std::string(begin, content_begin));
+        auto parsed_header = this->read_header(header_stream);
+        if (parsed_header.layout != &coordinate_layout) {
+            std::istringstream is(std::string(begin, end));
+            return this->read(is);
+        }
+        size_type num_rows{};
+        size_type num_cols{};
+        size_type num_nonzeros{};
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        const auto entry_reader = parsed_header.entry;
+        const auto modifier = parsed_header.modifier;
+        return read_coordinate<matrix_data<ValueType, IndexType>>(
+            content_begin, end, dim<2>{num_rows, num_cols}, num_nonzeros,
+            [&](const char *&it, const char *end, IndexType row,
+                IndexType col, matrix_data<ValueType, IndexType> &data) {
+                ValueType entry{};
+                if (!entry_reader->parse_entry(it, end, entry)) {
+                    return false;
+                }
+                modifier->insert_entry(row, col, entry, data);
+                return true;
+            });
+    }
+
+    /**
+     * Reads the sparsity pattern of a matrix from a stream.
+     *
+     * The values of the entries are skipped without being parsed, the
+     * positions of the entries are read like in read(std::istream &),
+     * including the positions implied by the storage modifier.
+     *
+     * @param is  the input stream.
+     *
+     * @return the sparsity pattern.
+     */
+    matrix_pattern<IndexType> read_pattern(std::istream &is) const
+    {
+        auto parsed_header = this->read_header(is);
+        const auto entry_reader = parsed_header.entry;
+        const auto modifier = parsed_header.modifier;
+        size_type num_rows{};
+        size_type num_cols{};
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            GKO_CHECK_STREAM(
+                dimensions_stream >> num_rows >> num_cols,
+                "error when determining matrix size, expected: rows cols nnz");
+            matrix_pattern<IndexType> pattern(dim<2>{num_rows, num_cols});
+            for (size_type col = 0; col < num_cols; ++col) {
+                for (size_type row = modifier->get_row_start(col);
+                     row < num_rows; ++row) {
+                    if (!entry_reader->skip_entry(is)) {
+                        throw GKO_STREAM_ERROR(
+                            "error when reading matrix entry " +
+                            std::to_string(row) + " ," + std::to_string(col));
+                    }
+                    modifier->insert_pattern_entry(row, col, pattern);
+                }
+            }
+            pattern.ensure_row_major_order();
+            return pattern;
+        }
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        matrix_pattern<IndexType> pattern(dim<2>{num_rows, num_cols});
+        pattern.nonzeros.reserve(
+            modifier->get_reservation_size(num_rows, num_cols, num_nonzeros));
+        for (size_type i = 0; i < num_nonzeros; ++i) {
+            IndexType row{};
+            IndexType col{};
+            GKO_CHECK_STREAM(is >> row >> col,
+                             "error when reading coordinates of matrix entry " +
+                                 std::to_string(i));
+            if (!entry_reader->skip_entry(is)) {
+                throw GKO_STREAM_ERROR("error when reading matrix entry " +
+                                       std::to_string(i));
+            }
+            modifier->insert_pattern_entry(row - 1, col - 1, pattern);
+        }
+        pattern.ensure_row_major_order();
+        return pattern;
+    }
+
+    /**
+     * Reads the sparsity pattern of a matrix from a character buffer holding
+     * the complete file.
+     *
+     * The values of the entries are skipped without being parsed, the
+     * positions of the entries are read like in read(const char *, const char
+     * *), including the positions implied by the storage modifier.
+     *
+     * @param begin  the start of the buffer
+     * @param end  the end of the buffer
+     *
+     * @return the sparsity pattern.
+     */
+    matrix_pattern<IndexType> read_pattern(const char *begin,
+                                           const char *end) const
+    {
+        auto content_begin = find_content(begin, end);
+        std::istringstream header_stream(std::string(begin, content_begin));
+        auto parsed_header = this->read_header(header_stream);
+        const auto entry_reader = parsed_header.entry;
+        const auto modifier = parsed_header.modifier;
+        size_type num_rows{};
+        size_type num_cols{};
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            GKO_CHECK_STREAM(
+                dimensions_stream >> num_rows >> num_cols,
+                "error when determining matrix size, expected: rows cols nnz");
+            matrix_pattern<IndexType> pattern(dim<2>{num_rows, num_cols});
+            auto it = content_begin;
+            for (size_type col = 0; col < num_cols; ++col) {
+                for (size_type row = modifier->get_row_start(col);
+                     row < num_rows; ++row) {
+                    if (!entry_reader->skip_entry(it, end)) {
+                        throw GKO_STREAM_ERROR(
+                            "error when reading matrix entry " +
+                            std::to_string(row) + " ," + std::to_string(col));
+                    }
+                    modifier->insert_pattern_entry(row, col, pattern);
+                }
+            }
+            pattern.ensure_row_major_order();
+            return pattern;
+        }
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        return read_coordinate<matrix_pattern<IndexType>>(
+            content_begin, end, dim<2>{num_rows, num_cols}, num_nonzeros,
+            [&](const char *&it, const char *end, IndexType row,
+                IndexType col, matrix_pattern<IndexType> &pattern) {
+                if (!entry_reader->skip_entry(it, end)) {
+                    return false;
+                }
+                modifier->insert_pattern_entry(row, col, pattern);
+                return true;
+            });
+    }
+
     /**
      * Writes a matrix to a stream.
      *
@@ -125,8 +638,14 @@ private:
      */
     struct entry_format {
         virtual ValueType read_entry(std::istream &is) const = 0;
+        virtual bool parse_entry(const char *&it, const char *end,
+                                 ValueType &value) const = 0;
+        virtual bool skip_entry(const char *&it, const char *end) const = 0;
+        virtual bool skip_entry(std::istream &is) const = 0;
         virtual void write_entry(std::ostream &os,
                                  const ValueType &value) const = 0;
+        virtual void format_entry(std::string &out,
+                                  const ValueType &value) const = 0;
     };
 
     /**
@@ -152,6 +671,53 @@ private:
             return static_cast<ValueType>(result);
         }
 
+        /**
+         * parses entry from a character buffer
+         *
+         * @param it  the current position in the buffer, advanced past the
+         *            entry
+         * @param end  the end of the buffer
+         * @param value  the parsed matrix entry
+         *
+         * @return true iff the entry could be parsed
+         */
+        bool parse_entry(const char *&it, const char *end,
+                         ValueType &value) const override
+        {
+            double result{};
+            if (!parse_real(it, end, result)) {
+                return false;
+            }
+            value = static_cast<ValueType>(result);
+            return true;
+        }
+
+        /**
+         * skips entry in a character buffer without parsing it
+         *
+         * @param it  the current position in the buffer, advanced past the
+         *            entry
+         * @param end  the end of the buffer
+         *
+         * @return true iff an entry was found
+         */
+        bool skip_entry(const char *&it, const char *end) const override
+        {
+            return skip_token(it, end);
+        }
+
+        /**
+         * skips entry in the input stream without parsing it
+         *
+         * @param is  the input stream
+         *
+         * @return true iff an entry was found
+         */
+        bool skip_entry(std::istream &is) const override
+        {
+            return skip_token(is);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -164,6 +730,18 @@ private:
             write_entry_impl<ValueType>(os, value);
         }
 
+        /**
+         * appends entry to a character buffer
+         *
+         * @param out  the buffer
+         * @param value  the matrix entry to be written
+         */
+        void format_entry(std::string &out,
+                          const ValueType &value) const override
+        {
+            format_entry_impl<ValueType>(out, value);
+        }
+
     private:
         template <typename T>
         static std::enable_if_t<is_complex_s<T>::value> write_entry_impl(
@@ -181,6 +759,21 @@ private:
                              "error while writing matrix entry");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value> format_entry_impl(
+            std::string &, const T &)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to write a complex matrix into a real entry format");
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value> format_entry_impl(
+            std::string &out, const T &value)
+        {
+            format_real(out, static_cast<double>(value));
+        }
+
     } real_format{};
 
     /**
@@ -199,6 +792,48 @@ private:
             return read_entry_impl<ValueType>(is);
         }
 
+        /**
+         * parses entry from a character buffer
+         *
+         * @param it  the current position in the buffer, advanced past the
+         *            entry
+         * @param end  the end of the buffer
+         * @param value  the parsed matrix entry
+         *
+         * @return true iff the entry could be parsed
+         */
+        bool parse_entry(const char *&it, const char *end,
+                         ValueType &value) const override
+        {
+            return parse_entry_impl(it, end, value);
+        }
+
+        /**
+         * skips entry in a character buffer without parsing it
+         *
+         * @param it  the current position in the buffer, advanced past the
+         *            entry
+         * @param end  the end of the buffer
+         *
+         * @return true iff both parts of the entry were found
+         */
+        bool skip_entry(const char *&it, const char *end) const override
+        {
+            return skip_token(it, end) && skip_token(it, end);
+        }
+
+        /**
+         * skips entry in the input stream without parsing it
+         *
+         * @param is  the input stream
+         *
+         * @return true iff both parts of the entry were found
+         */
+        bool skip_entry(std::istream &is) const override
+        {
+            return skip_token(is) && skip_token(is);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -213,6 +848,20 @@ private:
                              "error while writing matrix entry");
         }
 
+        /**
+         * appends entry to a character buffer
+         *
+         * @param out  the buffer
+         * @param value  the matrix entry to be written
+         */
+        void format_entry(std::string &out,
+                          const ValueType &value) const override
+        {
+            format_real(out, static_cast<double>(real(value)));
+            out.push_back(' ');
+            format_real(out, static_cast<double>(imag(value)));
+        }
+
     private:
         template <typename T>
         static std::enable_if_t<is_complex_s<T>::value, T> read_entry_impl(
@@ -234,6 +883,29 @@ private:
                 "trying to read a complex matrix into a real storage type");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value, bool> parse_entry_impl(
+            const char *&it, const char *end, T &value)
+        {
+            using real_type = remove_complex<T>;
+            double real{};
+            double imag{};
+            if (!parse_real(it, end, real) || !parse_real(it, end, imag)) {
+                return false;
+            }
+            value = {static_cast<real_type>(real),
+                     static_cast<real_type>(imag)};
+            return true;
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value, bool>
+        parse_entry_impl(const char *&, const char *, T &)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+
     } complex_format{};
 
     /**
@@ -252,6 +924,44 @@ private:
             return one<ValueType>();
         }
 
+        /**
+         * parses entry from a character buffer
+         *
+         * @param  dummy current position in the buffer
+         * @param  dummy end of the buffer
+         * @param value  the matrix entry (one)
+         *
+         * @return true
+         */
+        bool parse_entry(const char *&, const char *,
+                         ValueType &value) const override
+        {
+            value = one<ValueType>();
+            return true;
+        }
+
+        /**
+         * skips entry in a character buffer
+         *
+         * @param  dummy current position in the buffer
+         * @param  dummy end of the buffer
+         *
+         * @return true
+         */
+        bool skip_entry(const char *&, const char *) const override
+        {
+            return true;
+        }
+
+        /**
+         * skips entry in the input stream
+         *
+         * @param  dummy input stream
+         *
+         * @return true
+         */
+        bool skip_entry(std::istream &) const override { return true; }
+
         /**
          * writes entry to the output stream
          *
@@ -260,6 +970,14 @@ private:
          */
         void write_entry(std::ostream &, const ValueType &) const override {}
 
+        /**
+         * appends entry to a character buffer
+         *
+         * @param  dummy buffer
+         * @param  dummy matrix entry to be written
+         */
+        void format_entry(std::string &, const ValueType &) const override {}
+
     } pattern_format{};
 
 
@@ -277,6 +995,10 @@ private:
             const IndexType &row, const IndexType &col, const ValueType &entry,
             matrix_data<ValueType, IndexType> &data) const = 0;
 
+        virtual void insert_pattern_entry(
+            const IndexType &row, const IndexType &col,
+            matrix_pattern<IndexType> &pattern) const = 0;
+
         virtual size_type get_row_start(size_type col) const = 0;
     };
 
@@ -319,6 +1041,20 @@ private:
             data.nonzeros.emplace_back(row, col, entry);
         }
 
+        /**
+         * Insert the position of an entry
+         *
+         * @param row  The row where the entry is to be inserted.
+         * @param col  The column where the entry is to be inserted.
+         * @param pattern  the sparsity pattern of the matrix.
+         */
+        void insert_pattern_entry(
+            const IndexType &row, const IndexType &col,
+            matrix_pattern<IndexType> &pattern) const override
+        {
+            pattern.nonzeros.emplace_back(row, col);
+        }
+
         /**
          * Get the start of the rows
          */
@@ -362,6 +1098,23 @@ private:
             }
         }
 
+        /**
+         * Insert the position of an entry
+         *
+         * @param row  The row where the entry is to be inserted.
+         * @param col  The column where the entry is to be inserted.
+         * @param pattern  the sparsity pattern of the matrix.
+         */
+        void insert_pattern_entry(
+            const IndexType &row, const IndexType &col,
+            matrix_pattern<IndexType> &pattern) const override
+        {
+            pattern.nonzeros.emplace_back(row, col);
+            if (row != col) {
+                pattern.nonzeros.emplace_back(col, row);
+            }
+        }
+
         /**
          * Get the start of the rows
          */
@@ -405,6 +1158,21 @@ private:
             data.nonzeros.emplace_back(col, row, -entry);
         }
 
+        /**
+         * Insert the position of an entry
+         *
+         * @param row  The row where the entry is to be inserted.
+         * @param col  The column where the entry is to be inserted.
+         * @param pattern  the sparsity pattern of the matrix.
+         */
+        void insert_pattern_entry(
+            const IndexType &row, const IndexType &col,
+            matrix_pattern<IndexType> &pattern) const override
+        {
+            pattern.nonzeros.emplace_back(row, col);
+            pattern.nonzeros.emplace_back(col, row);
+        }
+
         /**
          * Get the start of the rows
          */
@@ -452,6 +1220,23 @@ private:
             }
         }
 
+        /**
+         * Insert the position of an entry
+         *
+         * @param row  The row where the entry is to be inserted.
+         * @param col  The column where the entry is to be inserted.
+         * @param pattern  the sparsity pattern of the matrix.
+         */
+        void insert_pattern_entry(
+            const IndexType &row, const IndexType &col,
+            matrix_pattern<IndexType> &pattern) const override
+        {
+            pattern.nonzeros.emplace_back(row, col);
+            if (row != col) {
+                pattern.nonzeros.emplace_back(col, row);
+            }
+        }
+
         /**
          * Get the start of the rows
          */
@@ -559,12 +1344,59 @@ private:
             GKO_CHECK_STREAM(os << data.size[0] << ' ' << data.size[1] << ' '
                                 << data.nonzeros.size() << '\n',
                              "error when writing size information");
-            for (const auto &nonzero : data.nonzeros) {
-                GKO_CHECK_STREAM(
-                    os << nonzero.row + 1 << ' ' << nonzero.column + 1 << ' ',
-                    "error when writing matrix index");
-                entry_writer->write_entry(os, nonzero.value);
-                GKO_CHECK_STREAM(os << '\n', "error when writing matrix data");
+            if (!has_default_format(os)) {
+                // the stream's own formatting settings need to be respected
+                for (const auto &nonzero : data.nonzeros) {
+                    GKO_CHECK_STREAM(os << nonzero.row + 1 << ' '
+                                        << nonzero.column + 1 << ' ',
+                                     "error when writing matrix index");
+                    entry_writer->write_entry(os, nonzero.value);
+                    GKO_CHECK_STREAM(os << '\n',
+                                     "error when writing matrix data");
+                }
+                return;
+            }
+            // the entries are formatted concurrently into one buffer per
+            // thread, in rounds of bounded size, and written in order
+            const auto num_nonzeros = data.nonzeros.size();
+            const auto num_chunks =
+                get_num_parallel_tasks(num_nonzeros, min_chunk_entries);
+            const auto chunk_size =
+                std::min<size_type>(ceildiv(num_nonzeros, num_chunks),
+                                    size_type{max_chunk_entries});
+            std::vector<std::string> buffers(num_chunks);
+            std::vector<std::exception_ptr> errors(num_chunks);
+            for (size_type round_begin = 0; round_begin < num_nonzeros;
+                 round_begin += num_chunks * chunk_size) {
+                run_parallel(num_chunks, [&](size_type i) {
+                    const auto begin = std::min<size_type>(
+                        round_begin + i * chunk_size, num_nonzeros);
+                    const auto end =
+                        std::min<size_type>(begin + chunk_size, num_nonzeros);
+                    auto &buffer = buffers[i];
+                    buffer.clear();
+                    try {
+                        for (auto nz = begin; nz < end; ++nz) {
+                            const auto &nonzero = data.nonzeros[nz];
+                            format_index(buffer, nonzero.row + 1);
+                            buffer.push_back(' ');
+                            format_index(buffer, nonzero.column + 1);
+                            buffer.push_back(' ');
+                            entry_writer->format_entry(buffer, nonzero.value);
+                            buffer.push_back('\n');
+                        }
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                    }
+                });
+                for (size_type i = 0; i < num_chunks; ++i) {
+                    if (errors[i]) {
+                        std::rethrow_exception(errors[i]);
+                    }
+                    GKO_CHECK_STREAM(
+                        os.write(buffers[i].data(), buffers[i].size()),
+                        "error when writing matrix data");
+                }
             }
         }
 
@@ -651,6 +1483,242 @@ private:
     } array_layout{};
 
 
+    /**
+     * the minimum number of bytes parsed by a single thread
+     */
+    static constexpr size_type min_chunk_size = size_type{1} << 16;
+
+    /**
+     * the minimum number of entries formatted by a single thread
+     */
+    static constexpr size_type min_chunk_entries = size_type{1} << 13;
+
+    /**
+     * the maximum number of entries formatted by a single thread at once,
+     * which bounds the size of the buffers
+     */
+    static constexpr size_type max_chunk_entries = size_type{1} << 18;
+
+    /**
+     * a part of the coordinate entries that is parsed by a single thread
+     */
+    template <typename Data>
+    struct chunk {
+        const char *begin{};
+        const char *end{};
+        Data data{};
+        size_type num_entries{};
+        // the number of entries after which parsing stops
+        size_type max_entries{std::numeric_limits<size_type>::max()};
+        bool failed{};
+        bool failed_coordinates{};
+        std::exception_ptr error{};
+    };
+
+    /**
+     * orders nonzeros by their row and column index
+     */
+    template <typename Nonzero>
+    static bool row_major_less(const Nonzero &x, const Nonzero &y)
+    {
+        return std::tie(x.row, x.column) < std::tie(y.row, y.column);
+    }
+
+    /**
+     * finds the start of the matrix entries, i.e., the position after the
+     * dimensions line
+     *
+     * @param begin  the start of the file
+     * @param end  the end of the file
+     *
+     * @return the start of the first line following the dimensions line
+     */
+    static const char *find_content(const char *begin, const char *end)
+    {
+        auto next_line = [end](const char *it) {
+            it = std::find(it, end, '\n');
+            return it == end ? end : it + 1;
+        };
+        auto it = begin;
+        // skip empty lines and the description line
+        while (it != end && *it == '\n') {
+            ++it;
+        }
+        it = next_line(it);
+        // skip comments
+        while (it != end && *it == '%') {
+            it = next_line(it);
+        }
+        // skip the dimensions line
+        return next_line(it);
+    }
+
+    /**
+     * parses all entries of a chunk into its data
+     *
+     * @param c  the chunk to parse
+     * @param parse_entry  reads the rest of an entry following its coordinates
+     *                     and inserts it into the data, see read_coordinate
+     */
+    template <typename Data, typename EntryParser>
+    static void parse_chunk(chunk<Data> &c, EntryParser parse_entry) noexcept
+    {
+        try {
+            auto &nonzeros = c.data.nonzeros;
+            nonzeros.reserve((c.end - c.begin) / 16);
+            auto it = c.begin;
+            while (c.num_entries < c.max_entries) {
+                skip_space(it, c.end);
+                if (it == c.end) {
+                    break;
+                }
+                if (*it == '%') {
+                    it = std::find(it, c.end, '\n');
+                    continue;
+                }
+                IndexType row{};
+                IndexType col{};
+                if (!parse_index(it, c.end, row) ||
+                    !parse_index(it, c.end, col)) {
+                    c.failed = true;
+                    c.failed_coordinates = true;
+                    break;
+                }
+                if (!parse_entry(it, c.end, row - 1, col - 1, c.data)) {
+                    c.failed = true;
+                    break;
+                }
+                ++c.num_entries;
+            }
+            std::stable_sort(nonzeros.begin(), nonzeros.end(),
+                             row_major_less<typename Data::nonzero_type>);
+        } catch (...) {
+            c.error = std::current_exception();
+        }
+    }
+
+    /**
+     * reads the entries of a coordinate file, which are parsed and sorted
+     * concurrently in line-aligned chunks
+     *
+     * @tparam Data  the type of the resulting data (matrix_data or
+     *               matrix_pattern)
+     * @tparam EntryParser  a functor with the signature
+     *                      `bool(const char *&it, const char *end, IndexType
+     *                      row, IndexType col, Data &data)`, which reads the
+     *                      rest of the entry at the (zero-based) coordinates
+     *                      and inserts it into data, returning false if the
+     *                      entry is malformed
+     *
+     * @param begin  the start of the entries
+     * @param end  the end of the buffer
+     * @param size  the size of the matrix
+     * @param num_nonzeros  the number of entries stored in the file
+     * @param parse_entry  the entry parser
+     *
+     * @return the data sorted in row-major order
+     */
+    template <typename Data, typename EntryParser>
+    static Data read_coordinate(const char *begin, const char *end,
+                                dim<2> size, size_type num_nonzeros,
+                                EntryParser parse_entry)
+    {
+        using nonzero_type = typename Data::nonzero_type;
+        // split the entries into line-aligned chunks
+        const auto content_size = static_cast<size_type>(end - begin);
+        auto num_chunks = get_num_parallel_tasks(content_size, min_chunk_size);
+        std::vector<chunk<Data>> chunks(num_chunks);
+        auto chunk_begin = begin;
+        for (size_type i = 0; i < num_chunks; ++i) {
+            auto chunk_end = i + 1 == num_chunks
+                                 ? end
+                                 : begin + content_size / num_chunks * (i + 1);
+            chunk_end = std::max(chunk_begin, chunk_end);
+            chunk_end = std::find(chunk_end, end, '\n');
+            chunk_end = chunk_end == end ? end : chunk_end + 1;
+            chunks[i].begin = chunk_begin;
+            chunks[i].end = chunk_end;
+            chunk_begin = chunk_end;
+        }
+        run_parallel(num_chunks, [&](size_type i) {
+            parse_chunk(chunks[i], parse_entry);
+        });
+
+        // like the stream reader, ignore everything following the number of
+        // entries stated in the header: the chunk containing the last of
+        // them is parsed again up to that entry, later chunks are dropped
+        size_type num_entries{};
+        for (size_type i = 0; i < num_chunks; ++i) {
+            auto &c = chunks[i];
+            if (num_entries + c.num_entries < num_nonzeros) {
+                num_entries += c.num_entries;
+                continue;
+            }
+            if (num_entries + c.num_entries > num_nonzeros || c.failed ||
+                c.error) {
+                chunk<Data> truncated{};
+                truncated.begin = c.begin;
+                truncated.end = c.end;
+                truncated.max_entries = num_nonzeros - num_entries;
+                parse_chunk(truncated, parse_entry);
+                c = std::move(truncated);
+            }
+            num_chunks = i + 1;
+            chunks.resize(num_chunks);
+            break;
+        }
+
+        // check for errors and compute the output position of every chunk
+        std::vector<size_type> offsets(num_chunks + 1);
+        num_entries = 0;
+        for (size_type i = 0; i < num_chunks; ++i) {
+            const auto &c = chunks[i];
+            if (c.error) {
+                std::rethrow_exception(c.error);
+            }
+            if (c.failed) {
+                throw GKO_STREAM_ERROR(
+                    (c.failed_coordinates
+                         ? "error when reading coordinates of matrix entry "
+                         : "error when reading matrix entry ") +
+                    std::to_string(num_entries + c.num_entries));
+            }
+            num_entries += c.num_entries;
+            offsets[i + 1] = offsets[i] + c.data.nonzeros.size();
+        }
+        if (num_entries < num_nonzeros) {
+            throw GKO_STREAM_ERROR(
+                "error when reading coordinates of matrix entry " +
+                std::to_string(num_entries));
+        }
+
+        Data data(size);
+        data.nonzeros.resize(offsets[num_chunks]);
+        run_parallel(num_chunks, [&](size_type i) {
+            std::copy(chunks[i].data.nonzeros.begin(),
+                      chunks[i].data.nonzeros.end(),
+                      data.nonzeros.begin() + offsets[i]);
+        });
+        chunks.clear();
+        // the chunks are sorted, merge them pairwise in parallel. Merging is
+        // stable, so the result is the same as sorting the whole data at once
+        auto nonzeros = data.nonzeros.begin();
+        for (size_type width = 1; width < num_chunks; width *= 2) {
+            const auto num_merges = ceildiv(num_chunks, 2 * width);
+            run_parallel(num_merges, [&](size_type merge) {
+                const auto first = 2 * width * merge;
+                const auto middle = std::min(first + width, num_chunks);
+                const auto last = std::min(first + 2 * width, num_chunks);
+                std::inplace_merge(nonzeros + offsets[first],
+                                   nonzeros + offsets[middle],
+                                   nonzeros + offsets[last],
+                                   row_major_less<nonzero_type>);
+            });
+        }
+        return data;
+    }
+
+
     /**
      * the constructors establishes the mapping between specification strings to
      * classes representing algorithms
@@ -760,6 +1828,55 @@ matrix_data<ValueType, IndexType> read_raw(std::istream &is)
 }
 
 
+/**
+ * Reads raw data from a file, parsing it in parallel.
+ *
+ * @param filename  the name of the file
+ *
+ * @return matrix_data  the matrix data.
+ */
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_raw(const std::string &filename)
+{
+    const mapped_file file(filename);
+    const auto begin = file.get_const_data();
+    return mtx_io<ValueType, IndexType>::get().read(begin,
+                                                    begin + file.get_size());
+}
+
+
+/**
+ * Reads the sparsity pattern from the stream.
+ *
+ * @param is  the input stream
+ *
+ * @return matrix_pattern  the sparsity pattern.
+ */
+template <typename IndexType>
+matrix_pattern<IndexType> read_pattern_raw(std::istream &is)
+{
+    // the value type only determines how entries are parsed, not skipped
+    return mtx_io<default_precision, IndexType>::get().read_pattern(is);
+}
+
+
+/**
+ * Reads the sparsity pattern from a file, parsing it in parallel.
+ *
+ * @param filename  the name of the file
+ *
+ * @return matrix_pattern  the sparsity pattern.
+ */
+template <typename IndexType>
+matrix_pattern<IndexType> read_pattern_raw(const std::string &filename)
+{
+    const mapped_file file(filename);
+    const auto begin = file.get_const_data();
+    return mtx_io<default_precision, IndexType>::get().read_pattern(
+        begin, begin + file.get_size());
+}
+
+
 /**
  * Writes raw data to the stream.
  *
@@ -780,14 +1897,48 @@ void write_raw(std::ostream &os, const matrix_data<ValueType, IndexType> &data,
 }
 
 
+/**
+ * Writes raw data to a file.
+ *
+ * @param filename  the name of the file
+ * @param data  the data to be written.
+ * @param layout  the layout type which the data should be written in.
+ */
+template <typename ValueType, typename IndexType>
+void write_raw(const std::string &filename,
+               const matrix_data<ValueType, IndexType> &data,
+               layout_type layout)
+{
+    std::ofstream os(filename, std::ios::binary);
+    GKO_CHECK_STREAM(os, "error when opening file " + filename);
+    write_raw(os, data, layout);
+    os.close();
+    GKO_CHECK_STREAM(os, "error when writing file " + filename);
+}
+
+
 #define GKO_DECLARE_READ_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_raw(std::istream &is)
+#define GKO_DECLARE_READ_RAW_FROM_FILE(ValueType, IndexType) \
+    matrix_data<ValueType, IndexType> read_raw(const std::string &filename)
 #define GKO_DECLARE_WRITE_RAW(ValueType, IndexType)               \
     void write_raw(std::ostream &os,                              \
                    const matrix_data<ValueType, IndexType> &data, \
                    layout_type layout)
+#define GKO_DECLARE_WRITE_RAW_TO_FILE(ValueType, IndexType)       \
+    void write_raw(const std::string &filename,                   \
+                   const matrix_data<ValueType, IndexType> &data, \
+                   layout_type layout)
+#define GKO_DECLARE_READ_PATTERN_RAW(IndexType) \
+    matrix_pattern<IndexType> read_pattern_raw(std::istream &is)
+#define GKO_DECLARE_READ_PATTERN_RAW_FROM_FILE(IndexType) \
+    matrix_pattern<IndexType> read_pattern_raw(const std::string &filename)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW_FROM_FILE);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_READ_PATTERN_RAW);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_READ_PATTERN_RAW_FROM_FILE);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW_TO_FILE);
 
 
 }  // namespace gko
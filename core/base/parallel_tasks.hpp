@@ -0,0 +1,93 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_BASE_PARALLEL_TASKS_HPP_
+#define GKO_CORE_BASE_PARALLEL_TASKS_HPP_
+
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+
+
+/**
+ * @internal
+ *
+ * Runs `fn(0), ..., fn(num_tasks - 1)` concurrently, each on its own thread.
+ * `fn` must not throw.
+ */
+template <typename Function>
+void run_parallel(size_type num_tasks, Function fn)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(num_tasks);
+    for (size_type task = 1; task < num_tasks; ++task) {
+        threads.emplace_back(fn, task);
+    }
+    fn(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Returns the number of tasks a piece of work should be split into, i.e. at
+ * most one task per hardware thread, and only as many as can be given at
+ * least `min_work_per_task` units of work each.
+ *
+ * @param work  the total amount of work
+ * @param min_work_per_task  the minimal amount of work per task
+ *
+ * @return the number of tasks, at least 1
+ */
+inline size_type get_num_parallel_tasks(size_type work,
+                                        size_type min_work_per_task)
+{
+    return std::max<size_type>(
+        1, std::min<size_type>(std::thread::hardware_concurrency(),
+                               work / min_work_per_task));
+}
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_PARALLEL_TASKS_HPP_
@@ -0,0 +1,585 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_BASE_SERIALIZATION_HPP_
+#define GKO_CORE_BASE_SERIALIZATION_HPP_
+
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/factorization/factor_serialization.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/parallel_tasks.hpp"
+
+
+namespace gko {
+
+
+constexpr char binary_magic[8] = {'G', 'K', 'O', 'B', 'I', 'N', 'A', 'R'};
+constexpr std::uint32_t binary_byte_order = 0x01020304;
+constexpr std::uint32_t binary_version = 1;
+
+
+/**
+ * @internal
+ *
+ * Identifies the kind of object stored in a binary file, further formats can
+ * be added without changing the header layout.
+ */
+enum class binary_format : std::uint32_t {
+    csr = 1,
+    jacobi = 2,
+    ilu = 3,
+    par_ilu = 4,
+    par_ilut = 5,
+    par_ict = 6,
+    isai = 7,
+    compressed_csr = 8
+};
+
+
+/**
+ * @internal
+ *
+ * Maps the value and index types to the identifiers stored in binary headers.
+ */
+template <typename T>
+struct binary_type_id {};
+
+template <>
+struct binary_type_id<float> : std::integral_constant<std::uint32_t, 1> {};
+
+template <>
+struct binary_type_id<double> : std::integral_constant<std::uint32_t, 2> {};
+
+template <>
+struct binary_type_id<std::complex<float>>
+    : std::integral_constant<std::uint32_t, 3> {};
+
+template <>
+struct binary_type_id<std::complex<double>>
+    : std::integral_constant<std::uint32_t, 4> {};
+
+template <>
+struct binary_type_id<int32> : std::integral_constant<std::uint32_t, 5> {};
+
+template <>
+struct binary_type_id<int64> : std::integral_constant<std::uint32_t, 6> {};
+
+
+/**
+ * @internal
+ *
+ * The header at the start of each serialized preconditioner or
+ * factorization. The checksum identifies the system matrix the object was
+ * generated from.
+ */
+struct binary_object_header {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint32_t format;
+    std::uint32_t value_type;
+    std::uint32_t index_type;
+    std::uint32_t reserved;
+    std::uint64_t num_rows;
+    std::uint64_t num_cols;
+    std::uint64_t checksum;
+};
+
+static_assert(std::is_standard_layout<binary_object_header>::value &&
+                  sizeof(binary_object_header) == 56,
+              "binary_object_header must not contain padding");
+
+
+/**
+ * @internal
+ *
+ * Computes a 64-bit FNV-1a checksum of the CSR representation of a matrix,
+ * covering its dimensions, sparsity pattern and values.
+ *
+ * @param matrix  the matrix, it needs to be convertible to
+ *                matrix::Csr<ValueType, IndexType>
+ *
+ * @return the checksum of the matrix
+ */
+template <typename ValueType, typename IndexType>
+std::uint64_t compute_checksum(const LinOp *matrix)
+{
+    auto host_matrix = copy_and_convert_to<matrix::Csr<ValueType, IndexType>>(
+        matrix->get_executor()->get_master(), matrix);
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    auto hash_bytes = [&hash](const void *data, size_type size) {
+        auto bytes = static_cast<const unsigned char *>(data);
+        for (size_type i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+    };
+    const std::uint64_t size[2]{host_matrix->get_size()[0],
+                                host_matrix->get_size()[1]};
+    const auto nnz = host_matrix->get_num_stored_elements();
+    hash_bytes(size, sizeof(size));
+    hash_bytes(host_matrix->get_const_row_ptrs(),
+               (size[0] + 1) * sizeof(IndexType));
+    hash_bytes(host_matrix->get_const_col_idxs(), nnz * sizeof(IndexType));
+    hash_bytes(host_matrix->get_const_values(), nnz * sizeof(ValueType));
+    return hash;
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the raw bytes of a trivially copyable value to a stream.
+ */
+template <typename T>
+void write_binary_value(std::ostream &os, const T &value)
+{
+    if (!os.write(reinterpret_cast<const char *>(&value), sizeof(T))) {
+        throw GKO_STREAM_ERROR("error when writing binary data");
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Reads the raw bytes of a trivially copyable value from a stream.
+ */
+template <typename T>
+T read_binary_value(std::istream &is)
+{
+    T value;
+    if (!is.read(reinterpret_cast<char *>(&value), sizeof(T))) {
+        throw GKO_STREAM_ERROR("unexpected end of binary data");
+    }
+    return value;
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the number of elements, followed by the elements stored in host
+ * memory.
+ */
+template <typename T>
+void write_binary_data(std::ostream &os, const T *data, size_type num_elems)
+{
+    write_binary_value(os, static_cast<std::uint64_t>(num_elems));
+    if (!os.write(reinterpret_cast<const char *>(data),
+                  num_elems * sizeof(T))) {
+        throw GKO_STREAM_ERROR("error when writing binary data");
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the number of elements of an array, followed by its elements. The
+ * array may reside on any executor.
+ */
+template <typename T>
+void write_binary_array(std::ostream &os, const Array<T> &array)
+{
+    const Array<T> host_array{array.get_executor()->get_master(), array};
+    write_binary_data(os, host_array.get_const_data(),
+                      host_array.get_num_elems());
+}
+
+
+/**
+ * @internal
+ *
+ * Returns the number of bytes left in a stream, or -1 if the stream does not
+ * support seeking.
+ */
+inline std::streamoff remaining_binary_size(std::istream &is)
+{
+    const auto pos = is.tellg();
+    if (pos == std::istream::pos_type(-1)) {
+        is.clear();
+        return -1;
+    }
+    is.seekg(0, std::ios::end);
+    const auto end = is.tellg();
+    is.clear();
+    is.seekg(pos);
+    if (end == std::istream::pos_type(-1) || !is) {
+        is.clear();
+        is.seekg(pos);
+        return -1;
+    }
+    return end - pos;
+}
+
+
+/**
+ * @internal
+ *
+ * Reads an array written by write_binary_array and moves it to `exec`.
+ *
+ * The element count is taken from the stream, so it is checked against the
+ * remaining stream size before allocating memory. For streams that cannot
+ * seek, the elements are read in chunks of bounded size instead, so that a
+ * corrupted count fails at the end of the data.
+ */
+template <typename T>
+Array<T> read_binary_array(std::istream &is,
+                           std::shared_ptr<const Executor> exec)
+{
+    const auto num_elems = read_binary_value<std::uint64_t>(is);
+    const auto remaining = remaining_binary_size(is);
+    if (remaining >= 0) {
+        if (num_elems > static_cast<std::uint64_t>(remaining) / sizeof(T)) {
+            throw GKO_STREAM_ERROR("unexpected end of binary data");
+        }
+        Array<T> host_array{exec->get_master(), num_elems};
+        if (!is.read(reinterpret_cast<char *>(host_array.get_data()),
+                     num_elems * sizeof(T))) {
+            throw GKO_STREAM_ERROR("unexpected end of binary data");
+        }
+        return Array<T>{std::move(exec), std::move(host_array)};
+    }
+    constexpr std::uint64_t chunk_size = (std::uint64_t{1} << 20) / sizeof(T);
+    std::vector<T> elems;
+    while (elems.size() < num_elems) {
+        const auto begin = elems.size();
+        const auto count = std::min(chunk_size, num_elems - begin);
+        elems.resize(begin + count);
+        if (!is.read(reinterpret_cast<char *>(elems.data() + begin),
+                     count * sizeof(T))) {
+            throw GKO_STREAM_ERROR("unexpected end of binary data");
+        }
+    }
+    return Array<T>{std::move(exec), elems.begin(), elems.end()};
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the header of a serialized object generated from `system_matrix`.
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_header(std::ostream &os, binary_format format,
+                         const LinOp *system_matrix)
+{
+    binary_object_header header{};
+    std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+    header.byte_order = binary_byte_order;
+    header.version = binary_version;
+    header.format = static_cast<std::uint32_t>(format);
+    header.value_type = binary_type_id<ValueType>::value;
+    header.index_type = binary_type_id<IndexType>::value;
+    header.num_rows = system_matrix->get_size()[0];
+    header.num_cols = system_matrix->get_size()[1];
+    header.checksum = compute_checksum<ValueType, IndexType>(system_matrix);
+    write_binary_value(os, header);
+}
+
+
+/**
+ * @internal
+ *
+ * Reads the header of a serialized object and checks that it stores an
+ * object of the expected format and types, generated from `system_matrix`.
+ *
+ * @throw StreamError  if the header does not match
+ */
+template <typename ValueType, typename IndexType>
+void read_binary_header(std::istream &is, binary_format format,
+                        const LinOp *system_matrix)
+{
+    binary_object_header header{};
+    if (!is.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0) {
+        throw GKO_STREAM_ERROR("the data is not in Ginkgo's binary format");
+    }
+    if (header.byte_order != binary_byte_order) {
+        throw GKO_STREAM_ERROR("the data was written with a different byte "
+                               "order");
+    }
+    if (header.version != binary_version ||
+        header.format != static_cast<std::uint32_t>(format)) {
+        throw GKO_STREAM_ERROR("the data stores a different kind of object or "
+                               "uses an unsupported format version");
+    }
+    if (header.value_type != binary_type_id<ValueType>::value ||
+        header.index_type != binary_type_id<IndexType>::value) {
+        throw GKO_STREAM_ERROR("the data stores a different value or index "
+                               "type");
+    }
+    if (header.num_rows != system_matrix->get_size()[0] ||
+        header.num_cols != system_matrix->get_size()[1] ||
+        header.checksum !=
+            compute_checksum<ValueType, IndexType>(system_matrix)) {
+        throw GKO_STREAM_ERROR("the data was generated from a different "
+                               "system matrix");
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the dimensions, row pointers, column indexes and values of a CSR
+ * matrix.
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream &os,
+                      const matrix::Csr<ValueType, IndexType> *matrix)
+{
+    auto host_matrix = make_temporary_clone(
+        matrix->get_executor()->get_master(), matrix);
+    const auto num_rows = host_matrix->get_size()[0];
+    const auto nnz = host_matrix->get_num_stored_elements();
+    write_binary_value(os, static_cast<std::uint64_t>(num_rows));
+    write_binary_value(os,
+                       static_cast<std::uint64_t>(host_matrix->get_size()[1]));
+    write_binary_data(os, host_matrix->get_const_row_ptrs(), num_rows + 1);
+    write_binary_data(os, host_matrix->get_const_col_idxs(), nnz);
+    write_binary_data(os, host_matrix->get_const_values(), nnz);
+}
+
+
+/**
+ * @internal
+ *
+ * Checks that the row pointers start at zero, are non-decreasing and end at
+ * `nnz`, and that all column indexes lie in `[0, num_cols)`, so that arrays
+ * read from a file or stream form a valid CSR matrix.
+ *
+ * @param row_ptrs  the num_rows + 1 row pointers, stored in host memory
+ * @param col_idxs  the nnz column indexes, stored in host memory
+ */
+template <typename IndexType>
+bool valid_csr_indexes(const IndexType *row_ptrs, const IndexType *col_idxs,
+                       std::uint64_t num_rows, std::uint64_t num_cols,
+                       std::uint64_t nnz)
+{
+    // the minimal number of rows and nonzeros checked by a single thread
+    constexpr size_type min_work_per_task = size_type{1} << 16;
+    if (row_ptrs[0] != 0 ||
+        static_cast<std::uint64_t>(row_ptrs[num_rows]) != nnz) {
+        return false;
+    }
+    // each thread checks a contiguous range of rows and their nonzeros
+    const auto num_tasks = std::min<size_type>(
+        get_num_parallel_tasks(num_rows + nnz, min_work_per_task),
+        std::max<std::uint64_t>(num_rows, 1));
+    std::vector<unsigned char> task_valid(num_tasks, true);
+    run_parallel(num_tasks, [&](size_type task) {
+        const auto first_row = num_rows * task / num_tasks;
+        const auto last_row = num_rows * (task + 1) / num_tasks;
+        for (auto row = first_row; row < last_row; ++row) {
+            if (row_ptrs[row] > row_ptrs[row + 1]) {
+                task_valid[task] = false;
+                return;
+            }
+        }
+        // another range may be invalid, so the nonzero range is clamped to
+        // the column index array
+        const auto max_nz = static_cast<IndexType>(nnz);
+        const auto begin =
+            std::min(std::max<IndexType>(row_ptrs[first_row], 0), max_nz);
+        const auto end = std::min(std::max(begin, row_ptrs[last_row]), max_nz);
+        for (auto nz = begin; nz < end; ++nz) {
+            if (col_idxs[nz] < 0 ||
+                static_cast<std::uint64_t>(col_idxs[nz]) >= num_cols) {
+                task_valid[task] = false;
+                return;
+            }
+        }
+    });
+    return std::find(task_valid.begin(), task_valid.end(), false) ==
+           task_valid.end();
+}
+
+
+/**
+ * @internal
+ *
+ * Reads a CSR matrix written by write_binary_csr and checks that it forms a
+ * valid CSR matrix.
+ *
+ * @param strategy  the strategy used by the matrix
+ *
+ * @throw StreamError  if the data is corrupted
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::istream &is, std::shared_ptr<const Executor> exec,
+    std::shared_ptr<typename matrix::Csr<ValueType, IndexType>::strategy_type>
+        strategy)
+{
+    const auto num_rows = read_binary_value<std::uint64_t>(is);
+    const auto num_cols = read_binary_value<std::uint64_t>(is);
+    // the indexes are validated on the host before moving them to exec
+    const auto host = exec->get_master();
+    auto row_ptrs = read_binary_array<IndexType>(is, host);
+    auto col_idxs = read_binary_array<IndexType>(is, host);
+    auto values = read_binary_array<ValueType>(is, exec);
+    if (row_ptrs.get_num_elems() == 0 ||
+        row_ptrs.get_num_elems() - 1 != num_rows ||
+        col_idxs.get_num_elems() != values.get_num_elems() ||
+        !valid_csr_indexes(row_ptrs.get_const_data(),
+                           col_idxs.get_const_data(), num_rows, num_cols,
+                           col_idxs.get_num_elems())) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, num_cols}, std::move(values),
+        Array<IndexType>{exec, std::move(col_idxs)},
+        Array<IndexType>{exec, std::move(row_ptrs)}, std::move(strategy));
+}
+
+
+/**
+ * @internal
+ *
+ * Writes the header and both factors of a factorization generated from
+ * `system_matrix`.
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_factors(std::ostream &os, binary_format format,
+                          const Composition<ValueType> *factors,
+                          const LinOp *system_matrix)
+{
+    using Csr = matrix::Csr<ValueType, IndexType>;
+    write_binary_header<ValueType, IndexType>(os, format, system_matrix);
+    for (const auto &factor : factors->get_operators()) {
+        write_binary_csr(os, as<Csr>(factor.get()));
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Reads a factorization written by write_binary_factors.
+ *
+ * @param first_strategy  the strategy used by the first factor
+ * @param second_strategy  the strategy used by the second factor
+ *
+ * @return a composition of both factors
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>> read_binary_factors(
+    std::istream &is, binary_format format,
+    std::shared_ptr<const Executor> exec, const LinOp *system_matrix,
+    std::shared_ptr<typename matrix::Csr<ValueType, IndexType>::strategy_type>
+        first_strategy,
+    std::shared_ptr<typename matrix::Csr<ValueType, IndexType>::strategy_type>
+        second_strategy)
+{
+    read_binary_header<ValueType, IndexType>(is, format, system_matrix);
+    std::shared_ptr<const LinOp> first =
+        read_binary_csr<ValueType, IndexType>(is, exec, first_strategy);
+    std::shared_ptr<const LinOp> second =
+        read_binary_csr<ValueType, IndexType>(is, exec, second_strategy);
+    if (first->get_size() != system_matrix->get_size() ||
+        second->get_size() != system_matrix->get_size()) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    return Composition<ValueType>::create(std::move(first), std::move(second));
+}
+
+
+/**
+ * @internal
+ *
+ * Describes how a factorization using EnableFactorSerialization is stored:
+ * `format` identifies it in the binary header, and `second_strategy` returns
+ * the strategy of its second factor from the factorization's parameters. It
+ * needs to be specialized for each such factorization.
+ */
+template <typename Factorization>
+struct factor_serialization_traits;
+
+
+namespace factorization {
+
+
+template <typename ConcreteFactorization>
+void EnableFactorSerialization<ConcreteFactorization>::save(
+    std::ostream &os, const LinOp *system_matrix) const
+{
+    using value_type = typename ConcreteFactorization::value_type;
+    using index_type = typename ConcreteFactorization::index_type;
+    write_binary_factors<value_type, index_type>(
+        os, factor_serialization_traits<ConcreteFactorization>::format,
+        static_cast<const ConcreteFactorization *>(this), system_matrix);
+}
+
+
+template <typename ConcreteFactorization>
+void EnableFactorSerialization<ConcreteFactorization>::read_factors(
+    std::istream &is, const LinOp *system_matrix)
+{
+    using value_type = typename ConcreteFactorization::value_type;
+    using index_type = typename ConcreteFactorization::index_type;
+    using traits = factor_serialization_traits<ConcreteFactorization>;
+    auto self = static_cast<ConcreteFactorization *>(this);
+    const auto &parameters = self->get_parameters();
+    read_binary_factors<value_type, index_type>(
+        is, traits::format, self->get_executor(), system_matrix,
+        parameters.l_strategy, traits::second_strategy(parameters))
+        ->move_to(self);
+}
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_SERIALIZATION_HPP_
@@ -36,12 +36,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/components/fill_array.hpp"
 #include "core/components/precision_conversion.hpp"
 #include "core/components/prefix_sum.hpp"
+#include "core/factorization/cholesky_kernels.hpp"
 #include "core/factorization/factorization_kernels.hpp"
+#include "core/factorization/ic_kernels.hpp"
 #include "core/factorization/ilu_kernels.hpp"
+#include "core/factorization/lu_kernels.hpp"
 #include "core/factorization/par_ict_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
 #include "core/factorization/par_ilut_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
+#include "core/matrix/csr_assembler_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/diagonal_kernels.hpp"
@@ -49,16 +53,22 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/matrix/stencil_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/preconditioner/polynomial_kernels.hpp"
+#include "core/preconditioner/schwarz_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
 #include "core/solver/bicgstab_kernels.hpp"
+#include "core/solver/cb_gmres_kernels.hpp"
 #include "core/solver/cg_kernels.hpp"
 #include "core/solver/cgs_kernels.hpp"
 #include "core/solver/fcg_kernels.hpp"
 #include "core/solver/gmres_kernels.hpp"
+#include "core/solver/idr_kernels.hpp"
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/lower_trs_kernels.hpp"
+#include "core/solver/minres_kernels.hpp"
 #include "core/solver/upper_trs_kernels.hpp"
 #include "core/stop/criterion_kernels.hpp"
 #include "core/stop/residual_norm_kernels.hpp"
@@ -426,6 +436,60 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL);
 }  // namespace bicgstab
 
 
+namespace idr {
+
+
+template <typename ValueType>
+GKO_DECLARE_IDR_INITIALIZE_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_INITIALIZE_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_IDR_STEP_1_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_1_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_IDR_STEP_2_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_2_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_IDR_STEP_3_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_3_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_IDR_COMPUTE_OMEGA_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_COMPUTE_OMEGA_KERNEL);
+
+
+}  // namespace idr
+
+
+namespace minres {
+
+
+template <typename ValueType>
+GKO_DECLARE_MINRES_INITIALIZE_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_INITIALIZE_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_MINRES_STEP_1_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_STEP_1_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_MINRES_STEP_2_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_STEP_2_KERNEL);
+
+
+}  // namespace minres
+
+
 namespace cgs {
 
 
@@ -453,6 +517,29 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CGS_STEP_3_KERNEL);
 }  // namespace cgs
 
 
+namespace cb_gmres {
+
+
+template <typename ValueType, typename StorageType>
+GKO_DECLARE_CB_GMRES_INITIALIZE_2_KERNEL(ValueType, StorageType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(
+    GKO_DECLARE_CB_GMRES_INITIALIZE_2_KERNEL);
+
+template <typename ValueType, typename StorageType>
+GKO_DECLARE_CB_GMRES_STEP_1_KERNEL(ValueType, StorageType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(GKO_DECLARE_CB_GMRES_STEP_1_KERNEL);
+
+template <typename ValueType, typename StorageType>
+GKO_DECLARE_CB_GMRES_STEP_2_KERNEL(ValueType, StorageType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(GKO_DECLARE_CB_GMRES_STEP_2_KERNEL);
+
+
+}  // namespace cb_gmres
+
+
 namespace gmres {
 
 
@@ -540,6 +627,66 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
 }  // namespace sparsity_csr
 
 
+namespace stencil {
+
+
+template <typename ValueType>
+GKO_DECLARE_STENCIL_SPMV_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_STENCIL_CONVERT_TO_CSR_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_CONVERT_TO_CSR_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+
+
+namespace csr_assembler {
+
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CSR_ASSEMBLER_COUNT_NONZEROS_PER_ROW_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_COUNT_NONZEROS_PER_ROW_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CSR_ASSEMBLER_FILL_IN_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_FILL_IN_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CSR_ASSEMBLER_SORT_BY_COLUMN_AND_ENTRY_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_SORT_BY_COLUMN_AND_ENTRY_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CSR_ASSEMBLER_SUM_DUPLICATES_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_SUM_DUPLICATES_KERNEL);
+
+
+}  // namespace csr_assembler
+
+
 namespace csr {
 
 
@@ -670,6 +817,12 @@ GKO_DECLARE_CSR_EXTRACT_DIAGONAL(ValueType, IndexType)
 GKO_NOT_COMPILED(GKO_HOOK_MODULE);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
 
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL);
+
 
 }  // namespace csr
 
@@ -887,6 +1040,65 @@ GKO_NOT_COMPILED(GKO_HOOK_MODULE);
 }  // namespace jacobi
 
 
+namespace polynomial {
+
+
+template <typename ValueType>
+GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL);
+
+template <typename ValueType>
+GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL(ValueType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL);
+
+
+}  // namespace polynomial
+
+
+namespace schwarz {
+
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_SCHWARZ_PARTITION_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_PARTITION_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_SCHWARZ_APPLY_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SCHWARZ_APPLY_KERNEL);
+
+
+}  // namespace schwarz
+
+
 namespace isai {
 
 
@@ -908,6 +1120,12 @@ GKO_NOT_COMPILED(GKO_HOOK_MODULE);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
 
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_ISAI_GENERATE_GENERAL_INVERSE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_GENERATE_GENERAL_INVERSE_KERNEL);
+
 
 }  // namespace isai
 
@@ -962,6 +1180,48 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
 }  // namespace ilu_factorization
 
 
+namespace lu_factorization {
+
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_LU_INITIALIZE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_INITIALIZE_KERNEL);
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_LU_FACTORIZE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_FACTORIZE_KERNEL);
+
+
+}  // namespace lu_factorization
+
+
+namespace cholesky_factorization {
+
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_CHOLESKY_FACTORIZE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CHOLESKY_FACTORIZE_KERNEL);
+
+
+}  // namespace cholesky_factorization
+
+
+namespace ic_factorization {
+
+
+template <typename ValueType, typename IndexType>
+GKO_DECLARE_IC_COMPUTE_KERNEL(ValueType, IndexType)
+GKO_NOT_COMPILED(GKO_HOOK_MODULE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC_COMPUTE_KERNEL);
+
+
+}  // namespace ic_factorization
+
+
 namespace par_ict_factorization {
 
 
@@ -49,4 +49,5 @@ version version_info::get_omp_version() noexcept
 
 #define GKO_HOOK_MODULE omp
 #include "core/device_hooks/common_kernels.inc.cpp"
+#include "core/device_hooks/host_kernels.inc.cpp"
 #undef GKO_HOOK_MODULE
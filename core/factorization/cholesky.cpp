@@ -0,0 +1,114 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/cholesky.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/factorization/cholesky_kernels.hpp"
+#include "core/factorization/lu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace cholesky_factorization {
+
+
+GKO_REGISTER_OPERATION(initialize, lu_factorization::initialize);
+GKO_REGISTER_OPERATION(factorize, cholesky_factorization::factorize);
+
+
+}  // namespace cholesky_factorization
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>>
+Cholesky<ValueType, IndexType>::generate_l_lt(
+    const std::shared_ptr<const LinOp> &system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+
+    // Converts the system matrix to CSR.
+    // Throws an exception if it is not convertible.
+    auto local_system_matrix = matrix_type::create(exec);
+    as<ConvertibleTo<matrix_type>>(system_matrix.get())
+        ->convert_to(local_system_matrix.get());
+    // If necessary, sort it
+    if (!parameters_.skip_sorting) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    // Symbolic factorization: sparsity pattern of L and schedule
+    const auto num_rows = local_system_matrix->get_size()[0];
+    elimination_forest<IndexType> forest{exec, num_rows};
+    std::shared_ptr<matrix_type> l_factor =
+        symbolic_cholesky(local_system_matrix.get(), forest);
+
+    // Numerical factorization
+    exec->run(cholesky_factorization::make_initialize(
+        local_system_matrix.get(), l_factor.get()));
+    Array<bool> breakdowns{exec, num_rows};
+    exec->run(cholesky_factorization::make_factorize(forest, l_factor.get(),
+                                                     breakdowns.get_data()));
+    const auto breakdown_row = find_first_breakdown(breakdowns);
+    if (breakdown_row < num_rows) {
+        throw NumericalBreakdown(__FILE__, __LINE__, __func__, breakdown_row,
+                                 "the diagonal entry is not positive or not "
+                                 "finite, the matrix is not positive "
+                                 "definite");
+    }
+
+    l_factor->set_strategy(parameters_.l_strategy);
+    auto lt_factor = share(as<matrix_type>(l_factor->conj_transpose()));
+    lt_factor->set_strategy(parameters_.lt_strategy);
+
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(lt_factor));
+}
+
+
+#define GKO_DECLARE_CHOLESKY(ValueType, IndexType) \
+    class Cholesky<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY);
+
+
+}  // namespace factorization
+}  // namespace gko
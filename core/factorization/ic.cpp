@@ -0,0 +1,110 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/ic.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/factorization/factorization_kernels.hpp"
+#include "core/factorization/ic_kernels.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace ic_factorization {
+
+
+GKO_REGISTER_OPERATION(compute, ic_factorization::compute);
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l,
+                       factorization::initialize_row_ptrs_l);
+GKO_REGISTER_OPERATION(initialize_l, factorization::initialize_l);
+
+
+}  // namespace ic_factorization
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>> Ic<ValueType, IndexType>::generate_l_lt(
+    const std::shared_ptr<const LinOp> &system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+
+    // Converts the system matrix to CSR.
+    // Throws an exception if it is not convertible.
+    auto local_system_matrix = matrix_type::create(exec);
+    as<ConvertibleTo<matrix_type>>(system_matrix.get())
+        ->convert_to(local_system_matrix.get());
+    // If necessary, sort it
+    if (!parameters_.skip_sorting) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    // Extract the lower triangle, a missing diagonal entry is set to one
+    const auto num_rows = local_system_matrix->get_size()[0];
+    Array<IndexType> l_row_ptrs{exec, num_rows + 1};
+    exec->run(ic_factorization::make_initialize_row_ptrs_l(
+        local_system_matrix.get(), l_row_ptrs.get_data()));
+    const auto l_nnz = static_cast<size_type>(
+        exec->copy_val_to_host(l_row_ptrs.get_const_data() + num_rows));
+    std::shared_ptr<matrix_type> l_factor = matrix_type::create(
+        exec, local_system_matrix->get_size(), Array<ValueType>{exec, l_nnz},
+        Array<IndexType>{exec, l_nnz}, std::move(l_row_ptrs));
+    exec->run(ic_factorization::make_initialize_l(local_system_matrix.get(),
+                                                  l_factor.get(), false));
+
+    // Compute the incomplete factor in-place on the pattern of L
+    exec->run(ic_factorization::make_compute(l_factor.get()));
+
+    l_factor->set_strategy(parameters_.l_strategy);
+    auto lt_factor = share(as<matrix_type>(l_factor->conj_transpose()));
+    lt_factor->set_strategy(parameters_.lt_strategy);
+
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(lt_factor));
+}
+
+
+#define GKO_DECLARE_IC(ValueType, IndexType) class Ic<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC);
+
+
+}  // namespace factorization
+}  // namespace gko
@@ -40,12 +40,30 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/exception_helpers.hpp>
 
 
+#include "core/base/serialization.hpp"
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/ilu_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
 
 
 namespace gko {
+
+
+template <typename ValueType, typename IndexType>
+struct factor_serialization_traits<factorization::Ilu<ValueType, IndexType>> {
+    static constexpr binary_format format = binary_format::ilu;
+
+    static std::shared_ptr<
+        typename matrix::Csr<ValueType, IndexType>::strategy_type>
+    second_strategy(const typename factorization::Ilu<
+                    ValueType, IndexType>::parameters_type &parameters)
+    {
+        return parameters.u_strategy;
+    }
+};
+
+
 namespace factorization {
 namespace ilu_factorization {
 
@@ -63,7 +81,7 @@ GKO_REGISTER_OPERATION(initialize_l_u, factorization::initialize_l_u);
 
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
-    const std::shared_ptr<const LinOp> &system_matrix) const
+    const std::shared_ptr<const LinOp> &system_matrix)
 {
     GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
 
@@ -79,6 +97,17 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
     exec->run(ilu_factorization::make_add_diagonal_elements(
         local_system_matrix.get(), false));
 
+    // Remember the pattern to validate the matrices passed to update_values.
+    // The views are copied since they are assigned as lvalues.
+    const auto row_ptrs_view = Array<IndexType>::view(
+        exec, local_system_matrix->get_size()[0] + 1,
+        local_system_matrix->get_row_ptrs());
+    const auto col_idxs_view = Array<IndexType>::view(
+        exec, local_system_matrix->get_num_stored_elements(),
+        local_system_matrix->get_col_idxs());
+    pattern_row_ptrs_ = row_ptrs_view;
+    pattern_col_idxs_ = col_idxs_view;
+
     // Compute LU factorization
     exec->run(ilu_factorization::make_compute_ilu(local_system_matrix.get()));
 
@@ -118,9 +147,55 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Ilu<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+    // The factors were created by this object, their values are overwritten
+    // in place as documented in the header.
+    auto l_factor = std::const_pointer_cast<matrix_type>(get_l_factor());
+    auto u_factor = std::const_pointer_cast<matrix_type>(get_u_factor());
+
+    auto local_system_matrix = matrix_type::create(exec);
+    as<ConvertibleTo<matrix_type>>(system_matrix.get())
+        ->convert_to(local_system_matrix.get());
+    // This is a no-op unless the diagonal is missing in the new matrix
+    exec->run(ilu_factorization::make_add_diagonal_elements(
+        local_system_matrix.get(), false));
+    const auto num_rows = local_system_matrix->get_size()[0];
+    // The full comparison with the factors is only needed if the pattern
+    // differs from the one the factors were generated from, e.g. if the
+    // entries are stored in a different order or the factors were loaded.
+    const auto mismatch_row =
+        has_pattern(local_system_matrix.get(), pattern_row_ptrs_,
+                    pattern_col_idxs_)
+            ? num_rows
+            : find_l_u_pattern_mismatch(local_system_matrix.get(),
+                                        l_factor.get(), u_factor.get());
+    if (mismatch_row != num_rows) {
+        throw ValueMismatch(__FILE__, __LINE__, __func__, mismatch_row,
+                            num_rows,
+                            "the sparsity pattern of the system matrix "
+                            "differs from the factors in this row");
+    }
+
+    exec->run(ilu_factorization::make_compute_ilu(local_system_matrix.get()));
+    exec->run(ilu_factorization::make_initialize_l_u(
+        local_system_matrix.get(), l_factor.get(), u_factor.get()));
+}
+
+
 #define GKO_DECLARE_ILU(ValueType, IndexType) class Ilu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU);
 
 
+#define GKO_DECLARE_ILU_SERIALIZATION(ValueType, IndexType) \
+    class EnableFactorSerialization<Ilu<ValueType, IndexType>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU_SERIALIZATION);
+
+
 }  // namespace factorization
 }  // namespace gko
@@ -0,0 +1,139 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/lu.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/factorization/factorization_kernels.hpp"
+#include "core/factorization/lu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace lu_factorization {
+
+
+GKO_REGISTER_OPERATION(initialize, lu_factorization::initialize);
+GKO_REGISTER_OPERATION(factorize, lu_factorization::factorize);
+GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
+                       factorization::initialize_row_ptrs_l_u);
+GKO_REGISTER_OPERATION(initialize_l_u, factorization::initialize_l_u);
+
+
+}  // namespace lu_factorization
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>> Lu<ValueType, IndexType>::generate_l_u(
+    const std::shared_ptr<const LinOp> &system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+
+    // Converts the system matrix to CSR.
+    // Throws an exception if it is not convertible.
+    auto local_system_matrix = matrix_type::create(exec);
+    as<ConvertibleTo<matrix_type>>(system_matrix.get())
+        ->convert_to(local_system_matrix.get());
+    // If necessary, sort it
+    if (!parameters_.skip_sorting) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    // Symbolic factorization: sparsity pattern of L + U and schedule
+    const auto matrix_size = local_system_matrix->get_size();
+    const auto num_rows = matrix_size[0];
+    elimination_forest<IndexType> forest{exec, num_rows};
+    auto factors = symbolic_lu(local_system_matrix.get(), forest);
+
+    // Numerical factorization
+    exec->run(lu_factorization::make_initialize(local_system_matrix.get(),
+                                                factors.get()));
+    Array<bool> breakdowns{exec, num_rows};
+    exec->run(lu_factorization::make_factorize(forest, factors.get(),
+                                               breakdowns.get_data()));
+    const auto breakdown_row = find_first_breakdown(breakdowns);
+    if (breakdown_row < num_rows) {
+        throw NumericalBreakdown(__FILE__, __LINE__, __func__, breakdown_row,
+                                 "the pivot is zero or not finite, the "
+                                 "matrix requires pivoting");
+    }
+
+    // Separate L and U factors: nnz
+    Array<IndexType> l_row_ptrs{exec, num_rows + 1};
+    Array<IndexType> u_row_ptrs{exec, num_rows + 1};
+    exec->run(lu_factorization::make_initialize_row_ptrs_l_u(
+        factors.get(), l_row_ptrs.get_data(), u_row_ptrs.get_data()));
+
+    // Get nnz from device memory
+    auto l_nnz = static_cast<size_type>(
+        exec->copy_val_to_host(l_row_ptrs.get_data() + num_rows));
+    auto u_nnz = static_cast<size_type>(
+        exec->copy_val_to_host(u_row_ptrs.get_data() + num_rows));
+
+    // Init arrays
+    Array<IndexType> l_col_idxs{exec, l_nnz};
+    Array<ValueType> l_vals{exec, l_nnz};
+    std::shared_ptr<matrix_type> l_factor = matrix_type::create(
+        exec, matrix_size, std::move(l_vals), std::move(l_col_idxs),
+        std::move(l_row_ptrs), parameters_.l_strategy);
+    Array<IndexType> u_col_idxs{exec, u_nnz};
+    Array<ValueType> u_vals{exec, u_nnz};
+    std::shared_ptr<matrix_type> u_factor = matrix_type::create(
+        exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
+        std::move(u_row_ptrs), parameters_.u_strategy);
+
+    // Separate L and U: columns and values
+    exec->run(lu_factorization::make_initialize_l_u(
+        factors.get(), l_factor.get(), u_factor.get()));
+
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(u_factor));
+}
+
+
+#define GKO_DECLARE_LU(ValueType, IndexType) class Lu<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU);
+
+
+}  // namespace factorization
+}  // namespace gko
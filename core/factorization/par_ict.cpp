@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include "core/base/serialization.hpp"
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/par_ict_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
@@ -54,6 +55,22 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 namespace gko {
+
+
+template <typename ValueType, typename IndexType>
+struct factor_serialization_traits<factorization::ParIct<ValueType, IndexType>> {
+    static constexpr binary_format format = binary_format::par_ict;
+
+    static std::shared_ptr<
+        typename matrix::Csr<ValueType, IndexType>::strategy_type>
+    second_strategy(const typename factorization::ParIct<
+                    ValueType, IndexType>::parameters_type &parameters)
+    {
+        return parameters.lt_strategy;
+    }
+};
+
+
 namespace factorization {
 namespace par_ict_factorization {
 
@@ -231,6 +248,54 @@ ParIct<ValueType, IndexType>::generate_l_lt(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIct<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+    using CooBuilder = matrix::CooBuilder<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+    // convert and/or sort the matrix if necessary
+    auto csr_system_matrix =
+        copy_and_convert_to<CsrMatrix>(exec, system_matrix);
+    if (!parameters_.skip_sorting) {
+        auto sorted_system_matrix = clone(csr_system_matrix);
+        sorted_system_matrix->sort_by_column_index();
+        csr_system_matrix = std::move(sorted_system_matrix);
+    }
+
+    // The factors were created by this object and are only exposed as const,
+    // so their values can be overwritten in place.
+    auto l = std::const_pointer_cast<matrix_type>(get_l_factor());
+    auto lt = std::const_pointer_cast<matrix_type>(get_lt_factor());
+    const auto l_nnz = l->get_num_stored_elements();
+    auto l_coo = CooMatrix::create(exec, l->get_size());
+    {
+        CooBuilder l_builder{l_coo.get()};
+        // resize arrays that will be filled
+        l_builder.get_row_idx_array().resize_and_reset(l_nnz);
+        // update arrays that will be aliased
+        l_builder.get_col_idx_array() =
+            Array<IndexType>::view(exec, l_nnz, l->get_col_idxs());
+        l_builder.get_value_array() =
+            Array<ValueType>::view(exec, l_nnz, l->get_values());
+    }
+    exec->run(make_convert_to_coo(l.get(), l_coo.get()));
+
+    // the current factor serves as the initial guess for the fixed-point
+    // iteration on the unchanged sparsity pattern
+    for (size_type it = 0; it < parameters_.iterations; ++it) {
+        exec->run(
+            make_compute_factor(csr_system_matrix.get(), l.get(), l_coo.get()));
+    }
+    exec->run(make_csr_conj_transpose(l.get(), lt.get()));
+}
+
+
 template <typename ValueType, typename IndexType>
 void ParIctState<ValueType, IndexType>::iterate()
 {
@@ -301,5 +366,11 @@ void ParIctState<ValueType, IndexType>::iterate()
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ICT);
 
 
+#define GKO_DECLARE_PAR_ICT_SERIALIZATION(ValueType, IndexType) \
+    class EnableFactorSerialization<ParIct<ValueType, IndexType>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ICT_SERIALIZATION);
+
+
 }  // namespace factorization
 }  // namespace gko
@@ -44,12 +44,30 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include "core/base/serialization.hpp"
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
 #include "core/matrix/csr_kernels.hpp"
 
 
 namespace gko {
+
+
+template <typename ValueType, typename IndexType>
+struct factor_serialization_traits<factorization::ParIlu<ValueType, IndexType>> {
+    static constexpr binary_format format = binary_format::par_ilu;
+
+    static std::shared_ptr<
+        typename matrix::Csr<ValueType, IndexType>::strategy_type>
+    second_strategy(const typename factorization::ParIlu<
+                    ValueType, IndexType>::parameters_type &parameters)
+    {
+        return parameters.u_strategy;
+    }
+};
+
+
 namespace factorization {
 namespace par_ilu_factorization {
 
@@ -72,7 +90,7 @@ std::unique_ptr<Composition<ValueType>>
 ParIlu<ValueType, IndexType>::generate_l_u(
     const std::shared_ptr<const LinOp> &system_matrix, bool skip_sorting,
     std::shared_ptr<typename l_matrix_type::strategy_type> l_strategy,
-    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy) const
+    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy)
 {
     using CsrMatrix = matrix::Csr<ValueType, IndexType>;
     using CooMatrix = matrix::Coo<ValueType, IndexType>;
@@ -96,6 +114,17 @@ ParIlu<ValueType, IndexType>::generate_l_u(
     exec->run(par_ilu_factorization::make_add_diagonal_elements(
         csr_system_matrix, true));
 
+    // Remember the pattern to validate the matrices passed to update_values.
+    // The views are copied since they are assigned as lvalues.
+    const auto row_ptrs_view =
+        Array<IndexType>::view(exec, csr_system_matrix->get_size()[0] + 1,
+                               csr_system_matrix->get_row_ptrs());
+    const auto col_idxs_view = Array<IndexType>::view(
+        exec, csr_system_matrix->get_num_stored_elements(),
+        csr_system_matrix->get_col_idxs());
+    pattern_row_ptrs_ = row_ptrs_view;
+    pattern_col_idxs_ = col_idxs_view;
+
     const auto matrix_size = csr_system_matrix->get_size();
     const auto number_rows = matrix_size[0];
     Array<IndexType> l_row_ptrs{exec, number_rows + 1};
@@ -171,10 +200,74 @@ ParIlu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIlu<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+    // The factors were created by this object, their values are overwritten
+    // in place as documented in the header.
+    auto l_factor = std::const_pointer_cast<l_matrix_type>(get_l_factor());
+    auto u_factor = std::const_pointer_cast<u_matrix_type>(get_u_factor());
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(system_matrix.get())
+        ->convert_to(csr_system_matrix.get());
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
+    }
+    // This is a no-op unless the diagonal is missing in the new matrix
+    exec->run(par_ilu_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
+    const auto num_rows = csr_system_matrix->get_size()[0];
+    // The full comparison with the factors is only needed if the pattern
+    // differs from the one the factors were generated from, e.g. if the
+    // entries are stored in a different order or the factors were loaded.
+    const auto mismatch_row =
+        has_pattern(csr_system_matrix.get(), pattern_row_ptrs_,
+                    pattern_col_idxs_)
+            ? num_rows
+            : find_l_u_pattern_mismatch(csr_system_matrix.get(),
+                                        l_factor.get(), u_factor.get());
+    if (mismatch_row != num_rows) {
+        throw ValueMismatch(__FILE__, __LINE__, __func__, mismatch_row,
+                            num_rows,
+                            "the sparsity pattern of the system matrix "
+                            "differs from the factors in this row");
+    }
+
+    exec->run(par_ilu_factorization::make_initialize_l_u(
+        csr_system_matrix.get(), l_factor.get(), u_factor.get()));
+
+    auto u_factor_transpose_lin_op = u_factor->transpose();
+    auto u_factor_transpose =
+        static_cast<u_matrix_type *>(u_factor_transpose_lin_op.get());
+    auto coo_system_matrix = CooMatrix::create(exec);
+    csr_system_matrix->move_to(coo_system_matrix.get());
+
+    exec->run(par_ilu_factorization::make_compute_l_u_factors(
+        parameters_.iterations, coo_system_matrix.get(), l_factor.get(),
+        u_factor_transpose));
+    exec->run(par_ilu_factorization::make_csr_transpose(u_factor_transpose,
+                                                        u_factor.get()));
+}
+
+
 #define GKO_DECLARE_PAR_ILU(ValueType, IndexType) \
     class ParIlu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILU);
 
 
+#define GKO_DECLARE_PAR_ILU_SERIALIZATION(ValueType, IndexType) \
+    class EnableFactorSerialization<ParIlu<ValueType, IndexType>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILU_SERIALIZATION);
+
+
 }  // namespace factorization
 }  // namespace gko
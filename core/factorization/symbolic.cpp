@@ -0,0 +1,480 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/symbolic.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+namespace gko {
+namespace factorization {
+namespace {
+
+
+/**
+ * Computes the strictly lower triangular part of the symmetrized sparsity
+ * pattern S(A + A^T). The rows may contain duplicate entries.
+ */
+template <typename IndexType>
+void symmetrize_lower(size_type num_rows, const IndexType *row_ptrs,
+                      const IndexType *col_idxs,
+                      std::vector<IndexType> &lower_ptrs,
+                      std::vector<IndexType> &lower_cols)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    lower_ptrs.assign(num_rows + 1, 0);
+    for (IndexType row = 0; row < size; ++row) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            const auto col = col_idxs[nz];
+            if (col < row) {
+                ++lower_ptrs[row + 1];
+            } else if (col > row) {
+                ++lower_ptrs[col + 1];
+            }
+        }
+    }
+    std::partial_sum(lower_ptrs.begin(), lower_ptrs.end(), lower_ptrs.begin());
+    lower_cols.resize(lower_ptrs.back());
+    std::vector<IndexType> fill(lower_ptrs.begin(), lower_ptrs.end() - 1);
+    for (IndexType row = 0; row < size; ++row) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            const auto col = col_idxs[nz];
+            if (col < row) {
+                lower_cols[fill[row]++] = col;
+            } else if (col > row) {
+                lower_cols[fill[col]++] = row;
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes the elimination forest using Liu's algorithm with path compression.
+ */
+template <typename IndexType>
+void compute_parents(size_type num_rows,
+                     const std::vector<IndexType> &lower_ptrs,
+                     const std::vector<IndexType> &lower_cols,
+                     IndexType *parents)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    std::vector<IndexType> ancestors(num_rows, size);
+    for (IndexType row = 0; row < size; ++row) {
+        parents[row] = size;
+        for (auto nz = lower_ptrs[row]; nz < lower_ptrs[row + 1]; ++nz) {
+            auto node = lower_cols[nz];
+            while (ancestors[node] != size && ancestors[node] != row) {
+                const auto next = ancestors[node];
+                ancestors[node] = row;
+                node = next;
+            }
+            if (ancestors[node] == size) {
+                ancestors[node] = row;
+                parents[node] = row;
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes the (sorted) strictly lower triangular sparsity pattern of the
+ * factor. The pattern of each row is given by the union of the paths from the
+ * nonzero columns of the row to the row itself in the elimination forest.
+ */
+template <typename IndexType>
+void compute_factor_pattern(size_type num_rows,
+                            const std::vector<IndexType> &lower_ptrs,
+                            const std::vector<IndexType> &lower_cols,
+                            const IndexType *parents,
+                            std::vector<IndexType> &factor_ptrs,
+                            std::vector<IndexType> &factor_cols)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    std::vector<IndexType> markers(num_rows, size);
+    factor_ptrs.assign(num_rows + 1, 0);
+    for (IndexType row = 0; row < size; ++row) {
+        markers[row] = row;
+        for (auto nz = lower_ptrs[row]; nz < lower_ptrs[row + 1]; ++nz) {
+            for (auto node = lower_cols[nz]; markers[node] != row;
+                 node = parents[node]) {
+                markers[node] = row;
+                ++factor_ptrs[row + 1];
+            }
+        }
+    }
+    std::partial_sum(factor_ptrs.begin(), factor_ptrs.end(),
+                     factor_ptrs.begin());
+    factor_cols.resize(factor_ptrs.back());
+    std::fill(markers.begin(), markers.end(), size);
+    for (IndexType row = 0; row < size; ++row) {
+        auto out_nz = factor_ptrs[row];
+        markers[row] = row;
+        for (auto nz = lower_ptrs[row]; nz < lower_ptrs[row + 1]; ++nz) {
+            for (auto node = lower_cols[nz]; markers[node] != row;
+                 node = parents[node]) {
+                markers[node] = row;
+                factor_cols[out_nz++] = node;
+            }
+        }
+        std::sort(factor_cols.begin() + factor_ptrs[row],
+                  factor_cols.begin() + factor_ptrs[row + 1]);
+    }
+}
+
+
+/**
+ * Groups the nodes into chains with the same sparsity pattern and sorts the
+ * chains into levels by their height in the elimination forest.
+ *
+ * @param col_counts  the number of nonzeros in each column of the lower
+ *                    triangular factor, including the diagonal.
+ */
+template <typename IndexType>
+void compute_schedule(size_type num_rows, const IndexType *parents,
+                      const std::vector<IndexType> &col_counts,
+                      elimination_forest<IndexType> &forest)
+{
+    const auto host_exec = forest.parents.get_executor()->get_master();
+    const auto size = static_cast<IndexType>(num_rows);
+    std::vector<IndexType> num_children(num_rows + 1, 0);
+    for (IndexType node = 0; node < size; ++node) {
+        ++num_children[parents[node]];
+    }
+    // node i joins the chain of node i - 1 if it is its only child and
+    // the column of i - 1 has the same pattern as the column of i below i
+    std::vector<IndexType> chain_ptrs;
+    std::vector<IndexType> chain_ids(num_rows);
+    chain_ptrs.push_back(0);
+    for (IndexType node = 0; node < size; ++node) {
+        const auto prev = node - 1;
+        if (node > 0 &&
+            !(parents[prev] == node && num_children[node] == 1 &&
+              col_counts[prev] == col_counts[node] + 1)) {
+            chain_ptrs.push_back(node);
+        }
+        chain_ids[node] = chain_ptrs.size() - 1;
+    }
+    if (num_rows > 0) {
+        chain_ptrs.push_back(size);
+    }
+    const auto num_chains = chain_ptrs.size() - 1;
+    // parents always have a larger index than their children
+    std::vector<IndexType> levels(num_chains, 0);
+    IndexType num_levels = num_chains > 0 ? 1 : 0;
+    for (size_type chain = 0; chain < num_chains; ++chain) {
+        const auto parent = parents[chain_ptrs[chain + 1] - 1];
+        if (parent != size) {
+            auto &parent_level = levels[chain_ids[parent]];
+            parent_level = std::max(parent_level, levels[chain] + 1);
+            num_levels = std::max(num_levels, parent_level + 1);
+        }
+    }
+    Array<IndexType> level_ptrs{host_exec, static_cast<size_type>(num_levels) +
+                                               1};
+    Array<IndexType> level_nodes{host_exec, num_chains};
+    auto level_ptrs_data = level_ptrs.get_data();
+    std::fill_n(level_ptrs_data, num_levels + 1, 0);
+    for (auto level : levels) {
+        ++level_ptrs_data[level + 1];
+    }
+    std::partial_sum(level_ptrs_data, level_ptrs_data + num_levels + 1,
+                     level_ptrs_data);
+    std::vector<IndexType> fill(level_ptrs_data, level_ptrs_data + num_levels);
+    for (size_type chain = 0; chain < num_chains; ++chain) {
+        level_nodes.get_data()[fill[levels[chain]]++] = chain;
+    }
+    const Array<IndexType> chain_ptr_array{
+        host_exec, chain_ptrs.begin(), chain_ptrs.end()};
+    forest.chain_ptrs = chain_ptr_array;
+    forest.level_ptrs = level_ptrs;
+    forest.level_nodes = level_nodes;
+}
+
+
+/**
+ * Runs the complete symbolic analysis: computes the elimination forest, the
+ * strictly lower triangular pattern of the factor and the factorization
+ * schedule.
+ */
+template <typename ValueType, typename IndexType>
+void symbolic_analysis(const matrix::Csr<ValueType, IndexType> *mtx,
+                       elimination_forest<IndexType> &forest,
+                       std::vector<IndexType> &factor_ptrs,
+                       std::vector<IndexType> &factor_cols)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(mtx);
+    const auto host_exec = mtx->get_executor()->get_master();
+    const auto host_mtx = make_temporary_clone(host_exec, mtx);
+    const auto num_rows = host_mtx->get_size()[0];
+    std::vector<IndexType> lower_ptrs;
+    std::vector<IndexType> lower_cols;
+    symmetrize_lower(num_rows, host_mtx->get_const_row_ptrs(),
+                     host_mtx->get_const_col_idxs(), lower_ptrs, lower_cols);
+    Array<IndexType> parents{host_exec, num_rows};
+    compute_parents(num_rows, lower_ptrs, lower_cols, parents.get_data());
+    compute_factor_pattern(num_rows, lower_ptrs, lower_cols,
+                           parents.get_const_data(), factor_ptrs,
+                           factor_cols);
+    std::vector<IndexType> col_counts(num_rows, 1);
+    for (auto col : factor_cols) {
+        ++col_counts[col];
+    }
+    forest.parents = parents;
+    compute_schedule(num_rows, parents.get_const_data(), col_counts, forest);
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_lu(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    elimination_forest<IndexType> &forest)
+{
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+    const auto exec = mtx->get_executor();
+    const auto host_exec = exec->get_master();
+    const auto size = mtx->get_size();
+    const auto num_rows = static_cast<IndexType>(size[0]);
+    std::vector<IndexType> l_ptrs;
+    std::vector<IndexType> l_cols;
+    symbolic_analysis(mtx, forest, l_ptrs, l_cols);
+    // the pattern of U is the transpose of the pattern of L
+    Array<IndexType> row_ptrs{host_exec, size[0] + 1};
+    auto row_ptrs_data = row_ptrs.get_data();
+    std::fill_n(row_ptrs_data, size[0] + 1, 0);
+    for (IndexType row = 0; row < num_rows; ++row) {
+        row_ptrs_data[row + 1] += l_ptrs[row + 1] - l_ptrs[row] + 1;
+        for (auto nz = l_ptrs[row]; nz < l_ptrs[row + 1]; ++nz) {
+            ++row_ptrs_data[l_cols[nz] + 1];
+        }
+    }
+    std::partial_sum(row_ptrs_data, row_ptrs_data + num_rows + 1,
+                     row_ptrs_data);
+    const auto nnz = static_cast<size_type>(row_ptrs_data[num_rows]);
+    Array<IndexType> col_idxs{host_exec, nnz};
+    Array<ValueType> values{host_exec, nnz};
+    auto col_idxs_data = col_idxs.get_data();
+    std::fill_n(values.get_data(), nnz, zero<ValueType>());
+    std::vector<IndexType> u_fill(num_rows);
+    for (IndexType row = 0; row < num_rows; ++row) {
+        auto out_nz = std::copy(l_cols.begin() + l_ptrs[row],
+                                l_cols.begin() + l_ptrs[row + 1],
+                                col_idxs_data + row_ptrs_data[row]);
+        *out_nz = row;
+        u_fill[row] = out_nz - col_idxs_data + 1;
+    }
+    // rows are visited in ascending order, so the U part is sorted
+    for (IndexType row = 0; row < num_rows; ++row) {
+        for (auto nz = l_ptrs[row]; nz < l_ptrs[row + 1]; ++nz) {
+            col_idxs_data[u_fill[l_cols[nz]]++] = row;
+        }
+    }
+    auto host_factors =
+        matrix_type::create(host_exec, size, std::move(values),
+                            std::move(col_idxs), std::move(row_ptrs));
+    return gko::clone(exec, host_factors.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_cholesky(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    elimination_forest<IndexType> &forest)
+{
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+    const auto exec = mtx->get_executor();
+    const auto host_exec = exec->get_master();
+    const auto size = mtx->get_size();
+    const auto num_rows = static_cast<IndexType>(size[0]);
+    std::vector<IndexType> l_ptrs;
+    std::vector<IndexType> l_cols;
+    symbolic_analysis(mtx, forest, l_ptrs, l_cols);
+    const auto nnz = l_cols.size() + size[0];
+    Array<IndexType> row_ptrs{host_exec, size[0] + 1};
+    Array<IndexType> col_idxs{host_exec, nnz};
+    Array<ValueType> values{host_exec, nnz};
+    auto row_ptrs_data = row_ptrs.get_data();
+    auto col_idxs_data = col_idxs.get_data();
+    std::fill_n(values.get_data(), nnz, zero<ValueType>());
+    row_ptrs_data[0] = 0;
+    for (IndexType row = 0; row < num_rows; ++row) {
+        auto out_nz = std::copy(l_cols.begin() + l_ptrs[row],
+                                l_cols.begin() + l_ptrs[row + 1],
+                                col_idxs_data + row_ptrs_data[row]);
+        *out_nz = row;
+        row_ptrs_data[row + 1] = out_nz - col_idxs_data + 1;
+    }
+    auto host_factor =
+        matrix_type::create(host_exec, size, std::move(values),
+                            std::move(col_idxs), std::move(row_ptrs));
+    return gko::clone(exec, host_factor.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type find_l_u_pattern_mismatch(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    const matrix::Csr<ValueType, IndexType> *l_factor,
+    const matrix::Csr<ValueType, IndexType> *u_factor)
+{
+    const auto num_rows = mtx->get_size()[0];
+    if (l_factor->get_size() != mtx->get_size() ||
+        u_factor->get_size() != mtx->get_size()) {
+        return 0;
+    }
+    const auto host_exec = mtx->get_executor()->get_master();
+    const auto host_mtx = make_temporary_clone(host_exec, mtx);
+    const auto host_l = make_temporary_clone(host_exec, l_factor);
+    const auto host_u = make_temporary_clone(host_exec, u_factor);
+    const auto row_ptrs = host_mtx->get_const_row_ptrs();
+    const auto col_idxs = host_mtx->get_const_col_idxs();
+    const auto l_ptrs = host_l->get_const_row_ptrs();
+    const auto l_cols = host_l->get_const_col_idxs();
+    const auto u_ptrs = host_u->get_const_row_ptrs();
+    const auto u_cols = host_u->get_const_col_idxs();
+    std::vector<IndexType> expected_l;
+    std::vector<IndexType> expected_u;
+    std::vector<IndexType> actual;
+    // compares the entries of a factor row with the expected (sorted) columns
+    auto row_matches = [&](const IndexType *begin, const IndexType *end,
+                           const std::vector<IndexType> &expected) {
+        actual.assign(begin, end);
+        std::sort(actual.begin(), actual.end());
+        return actual == expected;
+    };
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto diag = static_cast<IndexType>(row);
+        expected_l.assign(1, diag);
+        expected_u.assign(1, diag);
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            if (col_idxs[nz] < diag) {
+                expected_l.push_back(col_idxs[nz]);
+            } else if (col_idxs[nz] > diag) {
+                expected_u.push_back(col_idxs[nz]);
+            }
+        }
+        std::sort(expected_l.begin(), expected_l.end());
+        std::sort(expected_u.begin(), expected_u.end());
+        if (!row_matches(l_cols + l_ptrs[row], l_cols + l_ptrs[row + 1],
+                         expected_l) ||
+            !row_matches(u_cols + u_ptrs[row], u_cols + u_ptrs[row + 1],
+                         expected_u)) {
+            return row;
+        }
+    }
+    return num_rows;
+}
+
+
+template <typename ValueType, typename IndexType>
+bool has_pattern(const matrix::Csr<ValueType, IndexType> *mtx,
+                 const Array<IndexType> &row_ptrs,
+                 const Array<IndexType> &col_idxs)
+{
+    const auto num_rows = mtx->get_size()[0];
+    const auto nnz = mtx->get_num_stored_elements();
+    if (row_ptrs.get_num_elems() != num_rows + 1 ||
+        col_idxs.get_num_elems() != nnz) {
+        return false;
+    }
+    const auto exec = mtx->get_executor();
+    const auto host_exec = exec->get_master();
+    auto mtx_row_ptrs = mtx->get_const_row_ptrs();
+    auto mtx_col_idxs = mtx->get_const_col_idxs();
+    Array<IndexType> host_row_ptrs{host_exec};
+    Array<IndexType> host_col_idxs{host_exec};
+    if (exec != host_exec) {
+        host_row_ptrs.resize_and_reset(num_rows + 1);
+        host_col_idxs.resize_and_reset(nnz);
+        host_exec->copy_from(exec.get(), num_rows + 1, mtx_row_ptrs,
+                             host_row_ptrs.get_data());
+        host_exec->copy_from(exec.get(), nnz, mtx_col_idxs,
+                             host_col_idxs.get_data());
+        mtx_row_ptrs = host_row_ptrs.get_const_data();
+        mtx_col_idxs = host_col_idxs.get_const_data();
+    }
+    return std::equal(mtx_row_ptrs, mtx_row_ptrs + num_rows + 1,
+                      row_ptrs.get_const_data()) &&
+           std::equal(mtx_col_idxs, mtx_col_idxs + nnz,
+                      col_idxs.get_const_data());
+}
+
+
+size_type find_first_breakdown(const Array<bool> &breakdowns)
+{
+    const Array<bool> host_breakdowns{
+        breakdowns.get_executor()->get_master(), breakdowns};
+    const auto begin = host_breakdowns.get_const_data();
+    const auto end = begin + host_breakdowns.get_num_elems();
+    return std::find(begin, end, true) - begin;
+}
+
+
+#define GKO_DECLARE_SYMBOLIC_LU(ValueType, IndexType)           \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_lu( \
+        const matrix::Csr<ValueType, IndexType> *mtx,               \
+        elimination_forest<IndexType> &forest)
+#define GKO_DECLARE_SYMBOLIC_CHOLESKY(ValueType, IndexType)           \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_cholesky( \
+        const matrix::Csr<ValueType, IndexType> *mtx,                     \
+        elimination_forest<IndexType> &forest)
+#define GKO_DECLARE_FIND_L_U_PATTERN_MISMATCH(ValueType, IndexType)  \
+    size_type find_l_u_pattern_mismatch(                             \
+        const matrix::Csr<ValueType, IndexType> *mtx,                \
+        const matrix::Csr<ValueType, IndexType> *l_factor,           \
+        const matrix::Csr<ValueType, IndexType> *u_factor)
+#define GKO_DECLARE_HAS_PATTERN(ValueType, IndexType)              \
+    bool has_pattern(const matrix::Csr<ValueType, IndexType> *mtx, \
+                     const Array<IndexType> &row_ptrs,             \
+                     const Array<IndexType> &col_idxs)
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMBOLIC_LU);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMBOLIC_CHOLESKY);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FIND_L_U_PATTERN_MISMATCH);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_HAS_PATTERN);
+
+
+}  // namespace factorization
+}  // namespace gko
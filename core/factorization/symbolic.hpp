@@ -0,0 +1,221 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_FACTORIZATION_SYMBOLIC_HPP_
+#define GKO_CORE_FACTORIZATION_SYMBOLIC_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * @internal
+ *
+ * Stores the elimination forest of a (structurally symmetric) sparse matrix
+ * together with the schedule used by the numerical factorization.
+ *
+ * Consecutive nodes of the forest are grouped into chains, i.e. paths of nodes
+ * whose rows in the factor share the same sparsity pattern. The chains are
+ * then sorted into levels by their height in the forest: all chains within a
+ * level are independent of each other and can be factorized concurrently, as
+ * long as all previous levels are completed. The chains only serve as a
+ * schedule, their rows are still factorized one at a time.
+ *
+ * @tparam IndexType  the type used to store the node indices
+ */
+template <typename IndexType>
+struct elimination_forest {
+    /**
+     * Creates an empty elimination forest for a matrix with num_rows rows.
+     */
+    elimination_forest(std::shared_ptr<const Executor> exec, size_type num_rows)
+        : parents{exec, num_rows},
+          chain_ptrs{exec, 1},
+          level_ptrs{exec, 1},
+          level_nodes{exec}
+    {}
+
+    /**
+     * Returns the number of chains in the forest.
+     */
+    size_type get_num_chains() const noexcept
+    {
+        return chain_ptrs.get_num_elems() - 1;
+    }
+
+    /**
+     * Returns the number of levels in the forest.
+     */
+    size_type get_num_levels() const noexcept
+    {
+        return level_ptrs.get_num_elems() - 1;
+    }
+
+    /**
+     * The parent of each node, or the number of rows for the roots.
+     */
+    Array<IndexType> parents;
+
+    /**
+     * The chains are given by the node ranges
+     * [chain_ptrs[i], chain_ptrs[i + 1]).
+     */
+    Array<IndexType> chain_ptrs;
+
+    /**
+     * The chains of level i are given by
+     * level_nodes[level_ptrs[i]], ..., level_nodes[level_ptrs[i + 1] - 1].
+     */
+    Array<IndexType> level_ptrs;
+
+    /**
+     * The chains sorted by level, starting from the leaves.
+     */
+    Array<IndexType> level_nodes;
+};
+
+
+/**
+ * @internal
+ *
+ * Computes the sparsity pattern of the complete LU factorization (without
+ * pivoting) of the given matrix, based on the elimination forest of its
+ * symmetrized sparsity pattern $\mathcal S(A + A^T)$.
+ *
+ * @param mtx  the matrix to analyze, it needs to have sorted column indices.
+ * @param forest  the elimination forest and supernodal schedule of mtx
+ *
+ * @return the combined factor $L + U - I$ with the sparsity pattern of the
+ *         complete factorization (sorted) and all values set to zero. It is
+ *         allocated on the executor of mtx.
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_lu(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    elimination_forest<IndexType> &forest);
+
+
+/**
+ * @internal
+ *
+ * Computes the sparsity pattern of the lower triangular factor of the complete
+ * Cholesky factorization of the given matrix. Only the symmetrized sparsity
+ * pattern of mtx is taken into account, so it suffices to store one triangle.
+ *
+ * @param mtx  the matrix to analyze, it needs to have sorted column indices.
+ * @param forest  the elimination forest and supernodal schedule of mtx
+ *
+ * @return the lower triangular factor $L$ with the sparsity pattern of the
+ *         complete factorization (sorted) and all values set to zero. It is
+ *         allocated on the executor of mtx.
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> symbolic_cholesky(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    elimination_forest<IndexType> &forest);
+
+
+/**
+ * @internal
+ *
+ * Compares the sparsity pattern of the factors L and U with the pattern the
+ * incomplete factorization computes for the given matrix: L contains the
+ * strictly lower and U the strictly upper triangular entries of mtx, and both
+ * store the full diagonal. The order of the entries within each row is not
+ * taken into account.
+ *
+ * @param mtx  the matrix whose pattern is expected
+ * @param l_factor  the lower triangular factor
+ * @param u_factor  the upper triangular factor
+ *
+ * @return the first row in which the pattern of the factors differs from the
+ *         expected pattern, or the number of rows of mtx if they match.
+ */
+template <typename ValueType, typename IndexType>
+size_type find_l_u_pattern_mismatch(
+    const matrix::Csr<ValueType, IndexType> *mtx,
+    const matrix::Csr<ValueType, IndexType> *l_factor,
+    const matrix::Csr<ValueType, IndexType> *u_factor);
+
+
+/**
+ * @internal
+ *
+ * Checks whether the matrix has exactly the given sparsity pattern, including
+ * the order of the entries within each row. Only the index arrays of mtx are
+ * copied to the master executor, which makes this a cheap check for the
+ * common case of an unchanged pattern; find_l_u_pattern_mismatch needs to be
+ * used to locate the difference otherwise.
+ *
+ * @param mtx  the matrix to check
+ * @param row_ptrs  the expected row pointers, stored on the master executor
+ * @param col_idxs  the expected column indexes, stored on the master executor
+ *
+ * @return true if the row pointers and column indexes of mtx are equal to
+ *         row_ptrs and col_idxs, false otherwise.
+ */
+template <typename ValueType, typename IndexType>
+bool has_pattern(const matrix::Csr<ValueType, IndexType> *mtx,
+                 const Array<IndexType> &row_ptrs,
+                 const Array<IndexType> &col_idxs);
+
+
+/**
+ * @internal
+ *
+ * Finds the first row flagged by the numerical phase of a complete
+ * factorization, i.e. the first row whose pivot broke down.
+ *
+ * @param breakdowns  the flags written by the factorize kernel, one per row,
+ *                    they may reside on any executor
+ *
+ * @return the first flagged row, or the number of rows if there is none.
+ */
+size_type find_first_breakdown(const Array<bool> &breakdowns);
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_SYMBOLIC_HPP_
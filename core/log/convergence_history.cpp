@@ -0,0 +1,272 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/convergence_history.hpp>
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+template <typename ValueType>
+ConvergenceHistory<ValueType>::ConvergenceHistory(
+    std::shared_ptr<const gko::Executor> exec, absolute_type reduction_factor,
+    size_type max_history, absolute_type smoothing,
+    const mask_type &enabled_events)
+    : Logger(exec, enabled_events),
+      reduction_factor_{reduction_factor},
+      smoothing_{std::min(std::max(smoothing, absolute_type{}),
+                          absolute_type{1})},
+      history_(std::max(max_history, size_type{1})),
+      start_time_{std::chrono::steady_clock::now()}
+{}
+
+
+template <typename ValueType>
+remove_complex<ValueType> ConvergenceHistory<ValueType>::get_max_norm(
+    const LinOp *residual, const LinOp *residual_norm) const
+{
+    auto norm = dynamic_cast<const NormVector *>(residual_norm);
+    if (norm == nullptr) {
+        auto dense_r = dynamic_cast<const matrix::Dense<ValueType> *>(residual);
+        if (dense_r == nullptr) {
+            return -one<absolute_type>();
+        }
+        const auto exec = dense_r->get_executor();
+        const dim<2> norm_size{1, dense_r->get_size()[1]};
+        if (norm_ == nullptr || norm_->get_executor() != exec ||
+            norm_->get_size() != norm_size) {
+            norm_ = NormVector::create(exec, norm_size);
+        }
+        dense_r->compute_norm2(norm_.get());
+        norm = norm_.get();
+    }
+    const auto master = norm->get_executor()->get_master();
+    if (norm->get_executor() != master) {
+        if (host_norm_ == nullptr ||
+            host_norm_->get_size() != norm->get_size()) {
+            host_norm_ = NormVector::create(master, norm->get_size());
+        }
+        host_norm_->copy_from(norm);
+        norm = host_norm_.get();
+    }
+    auto max_norm = zero<absolute_type>();
+    for (size_type i = 0; i < norm->get_size()[1]; ++i) {
+        max_norm = std::max(max_norm, norm->at(0, i));
+    }
+    return max_norm;
+}
+
+
+template <typename ValueType>
+void ConvergenceHistory<ValueType>::on_iteration_complete(
+    const LinOp *, const size_type &num_iterations, const LinOp *residual,
+    const LinOp *, const LinOp *residual_norm) const
+{
+    const auto norm = this->get_max_norm(residual, residual_norm);
+    if (norm < zero<absolute_type>()) {
+        // neither a residual nor a norm of the expected type is available
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto capacity = history_.size();
+    if (num_entries_ > 0) {
+        auto &last = history_[(num_entries_ - 1) % capacity];
+        if (num_iterations == last.iteration) {
+            // some solvers report intermediate residuals within an iteration
+            last.residual_norm = norm;
+            return;
+        }
+        if (num_iterations > last.iteration) {
+            if (norm > zero<absolute_type>() &&
+                last.residual_norm > zero<absolute_type>()) {
+                const auto rate =
+                    (std::log(norm) - std::log(last.residual_norm)) /
+                    static_cast<absolute_type>(num_iterations -
+                                               last.iteration);
+                log_rate_ =
+                    has_rate_ ? log_rate_ + smoothing_ * (rate - log_rate_)
+                              : rate;
+                has_rate_ = true;
+            }
+        } else {
+            // a new solve started
+            num_entries_ = 0;
+        }
+    }
+    if (num_entries_ == 0 || num_iterations == 0) {
+        num_entries_ = 0;
+        initial_norm_ = norm;
+        log_rate_ = zero<absolute_type>();
+        has_rate_ = false;
+        start_time_ = now;
+    }
+    history_[num_entries_ % capacity] =
+        entry{num_iterations, norm,
+              std::chrono::duration_cast<std::chrono::nanoseconds>(now -
+                                                                   start_time_)
+                  .count()};
+    num_entries_++;
+}
+
+
+template <typename ValueType>
+std::vector<typename ConvergenceHistory<ValueType>::entry>
+ConvergenceHistory<ValueType>::get_history() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto capacity = history_.size();
+    const auto first = num_entries_ > capacity ? num_entries_ - capacity : 0;
+    std::vector<entry> result;
+    result.reserve(num_entries_ - first);
+    for (auto i = first; i < num_entries_; ++i) {
+        result.push_back(history_[i % capacity]);
+    }
+    return result;
+}
+
+
+template <typename ValueType>
+size_type ConvergenceHistory<ValueType>::get_num_iterations() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_entries_ > 0
+               ? history_[(num_entries_ - 1) % history_.size()].iteration
+               : 0;
+}
+
+
+template <typename ValueType>
+remove_complex<ValueType>
+ConvergenceHistory<ValueType>::get_initial_residual_norm() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return initial_norm_;
+}
+
+
+template <typename ValueType>
+remove_complex<ValueType> ConvergenceHistory<ValueType>::get_residual_norm()
+    const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_entries_ > 0
+               ? history_[(num_entries_ - 1) % history_.size()].residual_norm
+               : zero<absolute_type>();
+}
+
+
+template <typename ValueType>
+remove_complex<ValueType> ConvergenceHistory<ValueType>::get_convergence_rate()
+    const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return has_rate_ ? std::exp(log_rate_) : one<absolute_type>();
+}
+
+
+template <typename ValueType>
+size_type ConvergenceHistory<ValueType>::get_projected_iterations_impl() const
+{
+    constexpr auto never = std::numeric_limits<size_type>::max();
+    if (num_entries_ == 0) {
+        return never;
+    }
+    const auto target = reduction_factor_ * initial_norm_;
+    const auto current =
+        history_[(num_entries_ - 1) % history_.size()].residual_norm;
+    if (current <= target) {
+        return 0;
+    }
+    if (!has_rate_ || !(log_rate_ < zero<absolute_type>()) ||
+        target <= zero<absolute_type>()) {
+        return never;
+    }
+    const auto iterations = std::ceil(static_cast<double>(
+        (std::log(target) - std::log(current)) / log_rate_));
+    return iterations < static_cast<double>(never)
+               ? static_cast<size_type>(iterations)
+               : never;
+}
+
+
+template <typename ValueType>
+size_type ConvergenceHistory<ValueType>::get_projected_iterations() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return this->get_projected_iterations_impl();
+}
+
+
+template <typename ValueType>
+std::chrono::nanoseconds ConvergenceHistory<ValueType>::get_projected_time()
+    const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto iterations = this->get_projected_iterations_impl();
+    if (iterations == 0) {
+        return std::chrono::nanoseconds{0};
+    }
+    const auto capacity = history_.size();
+    const auto &first =
+        history_[num_entries_ > capacity ? num_entries_ % capacity : 0];
+    const auto &last = history_[(num_entries_ - 1) % capacity];
+    if (iterations == std::numeric_limits<size_type>::max() ||
+        last.iteration == first.iteration) {
+        return std::chrono::nanoseconds::max();
+    }
+    const auto time_per_iteration =
+        static_cast<double>(last.time - first.time) /
+        static_cast<double>(last.iteration - first.iteration);
+    const auto time = time_per_iteration * static_cast<double>(iterations);
+    return time < static_cast<double>(std::chrono::nanoseconds::max().count())
+               ? std::chrono::nanoseconds{static_cast<int64>(time)}
+               : std::chrono::nanoseconds::max();
+}
+
+
+#define GKO_DECLARE_CONVERGENCE_HISTORY(_type) class ConvergenceHistory<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CONVERGENCE_HISTORY);
+
+
+}  // namespace log
+}  // namespace gko
@@ -0,0 +1,405 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/perf_counters.hpp>
+
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+
+#ifdef GKO_HAVE_LINUX_PERF_EVENT_H
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // GKO_HAVE_LINUX_PERF_EVENT_H
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+constexpr uint64 cache_line_bytes = 64;
+
+
+#ifdef GKO_HAVE_LINUX_PERF_EVENT_H
+
+
+int open_counter(uint32 type, uint64 config, int pid, int cpu, bool core)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    if (core) {
+        // user space counting is allowed with the default paranoid level
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // a counter of the calling thread also counts the threads it creates
+        attr.inherit = pid == 0;
+    }
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, pid, cpu, -1, 0));
+}
+
+
+uint64 read_counter(int fd)
+{
+    // value, time enabled, time running
+    uint64 data[3]{};
+    if (read(fd, data, sizeof(data)) != sizeof(data)) {
+        return 0;
+    }
+    // the counter was multiplexed with others, extrapolate its value
+    if (data[2] > 0 && data[2] < data[1]) {
+        return static_cast<uint64>(static_cast<double>(data[0]) * data[1] /
+                                   data[2]);
+    }
+    return data[0];
+}
+
+
+std::string read_line(const std::string &path)
+{
+    std::ifstream stream{path};
+    std::string line;
+    std::getline(stream, line);
+    return line;
+}
+
+
+/*
+ * Translates an event description like `event=0x04,umask=0x03` into the
+ * config value of the PMU, using the bit positions of each field given in
+ * the format directory (e.g. `config:8-15`).
+ */
+bool parse_event(const std::string &pmu, const std::string &event,
+                 uint64 &config)
+{
+    const auto description = read_line(pmu + "/events/" + event);
+    if (description.empty()) {
+        return false;
+    }
+    config = 0;
+    std::istringstream terms{description};
+    std::string term;
+    try {
+        while (std::getline(terms, term, ',')) {
+            const auto eq = term.find('=');
+            const auto field = term.substr(0, eq);
+            const uint64 value =
+                eq == std::string::npos
+                    ? 1
+                    : std::stoull(term.substr(eq + 1), nullptr, 0);
+            const auto format = read_line(pmu + "/format/" + field);
+            const auto colon = format.find(':');
+            if (colon == std::string::npos ||
+                format.compare(0, colon, "config") != 0) {
+                return false;
+            }
+            config |= value << std::stoi(format.substr(colon + 1));
+        }
+    } catch (const std::exception &) {
+        return false;
+    }
+    return true;
+}
+
+
+/*
+ * Opens a core counter on every CPU, so that all threads are counted, no
+ * matter when they were created. This requires a `perf_event_paranoid` level
+ * of at most 0, otherwise the counter is only opened for the calling thread
+ * and the threads it creates afterwards.
+ */
+std::vector<int> open_core_counter(uint64 config)
+{
+    std::vector<int> fds;
+    const auto num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+    for (long cpu = 0; cpu < num_cpus; ++cpu) {
+        // offline CPUs cannot be opened and are skipped
+        const auto fd = open_counter(PERF_TYPE_HARDWARE, config, -1,
+                                     static_cast<int>(cpu), true);
+        if (fd >= 0) {
+            fds.push_back(fd);
+        }
+    }
+    if (fds.empty()) {
+        const auto fd = open_counter(PERF_TYPE_HARDWARE, config, 0, -1, true);
+        if (fd >= 0) {
+            fds.push_back(fd);
+        }
+    }
+    return fds;
+}
+
+
+/*
+ * Opens the CAS (column access strobe) read and write counters of all
+ * integrated memory controllers. Each CAS command transfers one cache line.
+ */
+std::vector<int> open_uncore_counters()
+{
+    std::vector<int> fds;
+    const std::string devices = "/sys/bus/event_source/devices";
+    auto dir = opendir(devices.c_str());
+    if (dir == nullptr) {
+        return fds;
+    }
+    while (auto entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name.compare(0, 10, "uncore_imc") != 0) {
+            continue;
+        }
+        const auto pmu = devices + "/" + name;
+        const auto type = read_line(pmu + "/type");
+        if (type.empty()) {
+            continue;
+        }
+        // uncore counters exist once per socket, the mask lists one CPU of
+        // each socket
+        std::istringstream cpus{read_line(pmu + "/cpumask")};
+        std::string cpu;
+        while (std::getline(cpus, cpu, ',')) {
+            for (auto event : {"cas_count_read", "cas_count_write"}) {
+                uint64 config{};
+                if (!parse_event(pmu, event, config)) {
+                    continue;
+                }
+                try {
+                    const auto fd =
+                        open_counter(std::stoul(type), config, -1,
+                                     std::stoi(cpu), false);
+                    if (fd >= 0) {
+                        fds.push_back(fd);
+                    }
+                } catch (const std::exception &) {
+                }
+            }
+        }
+    }
+    closedir(dir);
+    return fds;
+}
+
+
+#endif  // GKO_HAVE_LINUX_PERF_EVENT_H
+
+
+uint64 difference(uint64 end, uint64 start)
+{
+    // extrapolated values of multiplexed counters are not always monotonic
+    return end > start ? end - start : 0;
+}
+
+
+}  // namespace
+
+
+PerfCounters::PerfCounters(std::shared_ptr<const gko::Executor> exec,
+                           const mask_type &enabled_events)
+    : Logger(exec, enabled_events)
+{
+#ifdef GKO_HAVE_LINUX_PERF_EVENT_H
+    const uint64 configs[] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
+    for (size_type i = 0; i < core_fds_.size(); ++i) {
+        core_fds_[i] = open_core_counter(configs[i]);
+    }
+    uncore_fds_ = open_uncore_counters();
+#endif  // GKO_HAVE_LINUX_PERF_EVENT_H
+}
+
+
+PerfCounters::~PerfCounters()
+{
+#ifdef GKO_HAVE_LINUX_PERF_EVENT_H
+    for (const auto &fds : core_fds_) {
+        for (auto fd : fds) {
+            close(fd);
+        }
+    }
+    for (auto fd : uncore_fds_) {
+        close(fd);
+    }
+#endif  // GKO_HAVE_LINUX_PERF_EVENT_H
+}
+
+
+bool PerfCounters::has_core_counters() const noexcept
+{
+    return std::any_of(
+        core_fds_.begin(), core_fds_.end(),
+        [](const std::vector<int> &fds) { return !fds.empty(); });
+}
+
+
+bool PerfCounters::has_uncore_counters() const noexcept
+{
+    return !uncore_fds_.empty();
+}
+
+
+PerfCounters::counter_values PerfCounters::read_counters() const
+{
+    counter_values values{};
+#ifdef GKO_HAVE_LINUX_PERF_EVENT_H
+    for (size_type i = 0; i < core_fds_.size(); ++i) {
+        for (auto fd : core_fds_[i]) {
+            values[i] += read_counter(fd);
+        }
+    }
+    for (auto fd : uncore_fds_) {
+        values[num_counters - 1] += read_counter(fd) * cache_line_bytes;
+    }
+#endif  // GKO_HAVE_LINUX_PERF_EVENT_H
+    return values;
+}
+
+
+void PerfCounters::on_operation_launched(const Executor *exec,
+                                         const Operation *operation) const
+{
+    exec->synchronize();
+    std::lock_guard<std::mutex> guard{mutex_};
+    // operations launched from different threads may overlap, so every
+    // thread has its own stack of running operations
+    auto &open = open_[std::this_thread::get_id()];
+    // read the counters last to exclude the logger's overhead
+    open.push_back({operation->get_name(), {}, {}});
+    open.back().start = std::chrono::steady_clock::now();
+    open.back().values = this->read_counters();
+}
+
+
+void PerfCounters::on_operation_completed(const Executor *exec,
+                                          const Operation *) const
+{
+    exec->synchronize();
+    const auto values = this->read_counters();
+    const auto end = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto open = open_.find(std::this_thread::get_id());
+    if (open == open_.end() || open->second.empty()) {
+        // the logger was added while the operation was already running
+        return;
+    }
+    const auto &start = open->second.back();
+    auto &counters = counters_[start.name];
+    counters.num_calls++;
+    counters.time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         end - start.start)
+                         .count();
+    counters.cycles += difference(values[0], start.values[0]);
+    counters.instructions += difference(values[1], start.values[1]);
+    counters.llc_references += difference(values[2], start.values[2]);
+    const auto llc_misses = difference(values[3], start.values[3]);
+    counters.llc_misses += llc_misses;
+    counters.memory_bytes +=
+        this->has_uncore_counters() ? difference(values[4], start.values[4])
+                                    : llc_misses * cache_line_bytes;
+    open->second.pop_back();
+}
+
+
+std::map<std::string, PerfCounters::kernel_counters>
+PerfCounters::get_counters() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return counters_;
+}
+
+
+void PerfCounters::reset()
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    counters_.clear();
+}
+
+
+void PerfCounters::write(std::ostream &os) const
+{
+    const auto counters = this->get_counters();
+    size_type name_width = 9;
+    for (const auto &entry : counters) {
+        name_width = std::max(name_width, entry.first.size());
+    }
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::left << std::setw(name_width) << "operation" << std::right
+       << std::setw(10) << "calls" << std::setw(14) << "time [ms]"
+       << std::setw(8) << "IPC" << std::setw(12) << "LLC miss %"
+       << std::setw(14) << "memory [MB]" << std::setw(12) << "GB/s" << '\n';
+    os << std::fixed;
+    for (const auto &entry : counters) {
+        const auto &c = entry.second;
+        const auto ipc = c.cycles > 0 ? static_cast<double>(c.instructions) /
+                                            static_cast<double>(c.cycles)
+                                      : 0.0;
+        const auto miss_rate =
+            c.llc_references > 0
+                ? 100.0 * static_cast<double>(c.llc_misses) /
+                      static_cast<double>(c.llc_references)
+                : 0.0;
+        // bytes per nanosecond equals gigabytes per second
+        const auto bandwidth = c.time > 0
+                                   ? static_cast<double>(c.memory_bytes) /
+                                         static_cast<double>(c.time)
+                                   : 0.0;
+        os << std::left << std::setw(name_width) << entry.first << std::right
+           << std::setw(10) << c.num_calls << std::setprecision(3)
+           << std::setw(14) << c.time * 1e-6 << std::setprecision(2)
+           << std::setw(8) << ipc << std::setw(12) << miss_rate
+           << std::setw(14) << c.memory_bytes * 1e-6 << std::setw(12)
+           << bandwidth << '\n';
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+
+}  // namespace log
+}  // namespace gko
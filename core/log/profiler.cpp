@@ -0,0 +1,466 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/log/profiler.hpp>
+
+
+#include <algorithm>
+#include <complex>
+#include <iomanip>
+#include <map>
+#include <string>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+std::atomic<uint64> next_profiler_id{1};
+
+
+template <typename ValueType, typename IndexType>
+bool estimate_sparse_apply(const LinOp *A, size_type num_rhs,
+                           size_type &bytes, size_type &flops)
+{
+    size_type nnz{};
+    size_type index_bytes{};
+    const auto num_rows = A->get_size()[0];
+    if (auto csr = dynamic_cast<const matrix::Csr<ValueType, IndexType> *>(A)) {
+        nnz = csr->get_num_stored_elements();
+        index_bytes = (nnz + num_rows + 1) * sizeof(IndexType);
+    } else if (auto coo =
+                   dynamic_cast<const matrix::Coo<ValueType, IndexType> *>(A)) {
+        nnz = coo->get_num_stored_elements();
+        index_bytes = 2 * nnz * sizeof(IndexType);
+    } else if (auto ell =
+                   dynamic_cast<const matrix::Ell<ValueType, IndexType> *>(A)) {
+        nnz = ell->get_num_stored_elements();
+        index_bytes = nnz * sizeof(IndexType);
+    } else {
+        return false;
+    }
+    bytes += nnz * sizeof(ValueType) + index_bytes;
+    flops += 2 * nnz * num_rhs;
+    return true;
+}
+
+
+template <typename ValueType>
+bool estimate_apply(const LinOp *A, const LinOp *b, const LinOp *x,
+                    bool advanced, size_type &bytes, size_type &flops)
+{
+    using Vector = matrix::Dense<ValueType>;
+    if (dynamic_cast<const Vector *>(b) == nullptr ||
+        dynamic_cast<const Vector *>(x) == nullptr) {
+        return false;
+    }
+    const auto num_rows = A->get_size()[0];
+    const auto num_cols = A->get_size()[1];
+    const auto num_rhs = b->get_size()[1];
+    bytes = 0;
+    flops = 0;
+    if (dynamic_cast<const Vector *>(A) != nullptr) {
+        bytes += num_rows * num_cols * sizeof(ValueType);
+        flops += 2 * num_rows * num_cols * num_rhs;
+    } else if (!estimate_sparse_apply<ValueType, int32>(A, num_rhs, bytes,
+                                                        flops) &&
+               !estimate_sparse_apply<ValueType, int64>(A, num_rhs, bytes,
+                                                        flops)) {
+        return false;
+    }
+    // b is read, x is written (and read for the advanced apply)
+    bytes += (num_cols + (advanced ? 2 : 1) * num_rows) * num_rhs *
+             sizeof(ValueType);
+    if (advanced) {
+        flops += 3 * num_rows * num_rhs;
+    }
+    return true;
+}
+
+
+void estimate_apply(const LinOp *A, const LinOp *b, const LinOp *x,
+                    bool advanced, size_type &bytes, size_type &flops)
+{
+    if (!estimate_apply<float>(A, b, x, advanced, bytes, flops) &&
+        !estimate_apply<double>(A, b, x, advanced, bytes, flops) &&
+        !estimate_apply<std::complex<float>>(A, b, x, advanced, bytes,
+                                             flops) &&
+        !estimate_apply<std::complex<double>>(A, b, x, advanced, bytes,
+                                              flops)) {
+        bytes = 0;
+        flops = 0;
+    }
+}
+
+
+const char *kind_name(Profiler::range_kind kind)
+{
+    switch (kind) {
+    case Profiler::range_kind::operation:
+        return "operation";
+    case Profiler::range_kind::apply:
+        return "apply";
+    case Profiler::range_kind::generate:
+        return "generate";
+    default:
+        return "copy";
+    }
+}
+
+
+void write_json_string(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\';
+        }
+        os << c;
+    }
+    os << '"';
+}
+
+
+// writes a time in nanoseconds as microseconds without losing precision
+void write_microseconds(std::ostream &os, int64 time)
+{
+    os << time / 1000 << '.' << std::setw(3) << std::setfill('0')
+       << time % 1000 << std::setfill(' ');
+}
+
+
+}  // namespace
+
+
+Profiler::Profiler(std::shared_ptr<const gko::Executor> exec,
+                   size_type ring_capacity, const mask_type &enabled_events)
+    : Logger(exec, enabled_events),
+      id_{next_profiler_id++},
+      ring_capacity_{std::max(ring_capacity, size_type{1})},
+      start_time_{std::chrono::steady_clock::now()}
+{}
+
+
+Profiler::thread_buffer &Profiler::get_thread_buffer() const
+{
+    // most events come from the same thread and profiler, so only the
+    // first event of a thread needs to look up its buffer
+    thread_local uint64 cached_id{};
+    thread_local thread_buffer *cached_buffer{};
+    if (cached_id == id_) {
+        return *cached_buffer;
+    }
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto tid = std::this_thread::get_id();
+    auto it = std::find_if(
+        buffers_.begin(), buffers_.end(),
+        [&](const std::pair<std::thread::id, std::unique_ptr<thread_buffer>>
+                &entry) { return entry.first == tid; });
+    if (it == buffers_.end()) {
+        std::unique_ptr<thread_buffer> buffer{new thread_buffer};
+        buffer->thread = static_cast<uint32>(buffers_.size());
+        buffer->ring.resize(ring_capacity_);
+        buffers_.emplace_back(tid, std::move(buffer));
+        it = buffers_.end() - 1;
+    }
+    cached_id = id_;
+    cached_buffer = it->second.get();
+    return *cached_buffer;
+}
+
+
+int64 Profiler::now() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start_time_)
+        .count();
+}
+
+
+void Profiler::begin(const char *name, const std::type_info *type,
+                     range_kind kind) const
+{
+    auto &buffer = this->get_thread_buffer();
+    buffer.open.push_back({name, type, kind, this->now()});
+}
+
+
+void Profiler::end(size_type bytes, size_type flops) const
+{
+    const auto end_time = this->now();
+    auto &buffer = this->get_thread_buffer();
+    if (buffer.open.empty()) {
+        // the profiler was added while the range was already running
+        return;
+    }
+    const auto &open = buffer.open.back();
+    const auto num_ranges = buffer.num_ranges.load(std::memory_order_relaxed);
+    buffer.ring[num_ranges % ring_capacity_] =
+        range{open.name,
+              open.type,
+              open.kind,
+              buffer.thread,
+              static_cast<uint32>(buffer.open.size() - 1),
+              open.start,
+              end_time,
+              bytes,
+              flops};
+    buffer.num_ranges.store(num_ranges + 1, std::memory_order_release);
+    buffer.open.pop_back();
+}
+
+
+void Profiler::on_copy_started(const Executor *from, const Executor *to,
+                               const uintptr &, const uintptr &,
+                               const size_type &) const
+{
+    from->synchronize();
+    to->synchronize();
+    this->begin("copy", nullptr, range_kind::copy);
+}
+
+
+void Profiler::on_copy_completed(const Executor *from, const Executor *to,
+                                 const uintptr &, const uintptr &,
+                                 const size_type &num_bytes) const
+{
+    from->synchronize();
+    to->synchronize();
+    // the data is read once and written once
+    this->end(2 * num_bytes);
+}
+
+
+void Profiler::on_operation_launched(const Executor *exec,
+                                     const Operation *operation) const
+{
+    exec->synchronize();
+    this->begin(operation->get_name(), nullptr, range_kind::operation);
+}
+
+
+void Profiler::on_operation_completed(const Executor *exec,
+                                      const Operation *) const
+{
+    exec->synchronize();
+    this->end();
+}
+
+
+void Profiler::on_linop_apply_started(const LinOp *A, const LinOp *,
+                                      const LinOp *) const
+{
+    A->get_executor()->synchronize();
+    this->begin(nullptr, &typeid(*A), range_kind::apply);
+}
+
+
+void Profiler::on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                        const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    size_type bytes{};
+    size_type flops{};
+    estimate_apply(A, b, x, false, bytes, flops);
+    this->end(bytes, flops);
+}
+
+
+void Profiler::on_linop_advanced_apply_started(const LinOp *A, const LinOp *,
+                                               const LinOp *, const LinOp *,
+                                               const LinOp *) const
+{
+    A->get_executor()->synchronize();
+    this->begin(nullptr, &typeid(*A), range_kind::apply);
+}
+
+
+void Profiler::on_linop_advanced_apply_completed(const LinOp *A,
+                                                 const LinOp *,
+                                                 const LinOp *b, const LinOp *,
+                                                 const LinOp *x) const
+{
+    A->get_executor()->synchronize();
+    size_type bytes{};
+    size_type flops{};
+    estimate_apply(A, b, x, true, bytes, flops);
+    this->end(bytes, flops);
+}
+
+
+void Profiler::on_linop_factory_generate_started(const LinOpFactory *factory,
+                                                 const LinOp *) const
+{
+    this->begin(nullptr, &typeid(*factory), range_kind::generate);
+}
+
+
+void Profiler::on_linop_factory_generate_completed(const LinOpFactory *factory,
+                                                   const LinOp *,
+                                                   const LinOp *) const
+{
+    factory->get_executor()->synchronize();
+    this->end();
+}
+
+
+std::vector<Profiler::range> Profiler::get_ranges() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    std::vector<range> result;
+    for (const auto &entry : buffers_) {
+        const auto &buffer = *entry.second;
+        const auto num_ranges =
+            buffer.num_ranges.load(std::memory_order_acquire);
+        const auto num_stored = std::min(num_ranges, ring_capacity_);
+        const auto begin = result.size();
+        for (auto i = num_ranges - num_stored; i < num_ranges; ++i) {
+            result.push_back(buffer.ring[i % ring_capacity_]);
+        }
+        // ranges are stored when they end, so parents follow their children
+        std::stable_sort(result.begin() + begin, result.end(),
+                         [](const range &a, const range &b) {
+                             return a.start < b.start ||
+                                    (a.start == b.start && a.depth < b.depth);
+                         });
+    }
+    return result;
+}
+
+
+size_type Profiler::get_num_dropped_ranges() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    size_type num_dropped{};
+    for (const auto &entry : buffers_) {
+        const auto num_ranges =
+            entry.second->num_ranges.load(std::memory_order_acquire);
+        if (num_ranges > ring_capacity_) {
+            num_dropped += num_ranges - ring_capacity_;
+        }
+    }
+    return num_dropped;
+}
+
+
+std::string Profiler::get_range_name(const range &r)
+{
+    if (r.name != nullptr) {
+        return r.name;
+    }
+    return name_demangling::get_type_name(*r.type);
+}
+
+
+void Profiler::write_chrome_trace(std::ostream &os) const
+{
+    const auto ranges = this->get_ranges();
+    // demangle every type only once
+    std::map<const std::type_info *, std::string> type_names;
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto &r : ranges) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "{\"name\":";
+        if (r.name != nullptr) {
+            write_json_string(os, r.name);
+        } else {
+            auto it = type_names.find(r.type);
+            if (it == type_names.end()) {
+                it = type_names.emplace(r.type, get_range_name(r)).first;
+            }
+            write_json_string(os, it->second);
+        }
+        os << ",\"cat\":\"" << kind_name(r.kind)
+           << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << r.thread << ",\"ts\":";
+        write_microseconds(os, r.start);
+        os << ",\"dur\":";
+        write_microseconds(os, r.end - r.start);
+        os << ",\"args\":{\"bytes\":" << r.bytes << ",\"flops\":" << r.flops
+           << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+
+void Profiler::write_folded_stacks(std::ostream &os) const
+{
+    const auto ranges = this->get_ranges();
+    std::map<std::string, int64> self_times;
+    // the call stacks leading to the currently open ranges
+    std::vector<std::string> stack;
+    std::vector<int64> stack_self_time;
+    auto flush = [&](size_type depth) {
+        while (stack.size() > depth) {
+            self_times[stack.back()] += stack_self_time.back();
+            stack.pop_back();
+            stack_self_time.pop_back();
+        }
+    };
+    uint32 thread{};
+    for (const auto &r : ranges) {
+        if (r.thread != thread) {
+            flush(0);
+            thread = r.thread;
+        }
+        flush(std::min<size_type>(r.depth, stack.size()));
+        const auto duration = r.end - r.start;
+        auto name = get_range_name(r);
+        std::replace(name.begin(), name.end(), ';', ':');
+        if (stack.empty()) {
+            stack.push_back(std::move(name));
+        } else {
+            stack_self_time.back() -= duration;
+            stack.push_back(stack.back() + ";" + name);
+        }
+        stack_self_time.push_back(duration);
+    }
+    flush(0);
+    for (const auto &entry : self_times) {
+        os << entry.first << ' ' << entry.second << '\n';
+    }
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/log/record.hpp>
 
 
+#include <complex>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/stop/criterion.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
@@ -40,11 +43,59 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace gko {
 namespace log {
+namespace {
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> try_compute_norm(const LinOp *residual)
+{
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+    auto dense_residual =
+        dynamic_cast<const matrix::Dense<ValueType> *>(residual);
+    if (dense_residual == nullptr) {
+        return nullptr;
+    }
+    auto norm = NormVector::create(residual->get_executor(),
+                                   dim<2>{1, residual->get_size()[1]});
+    dense_residual->compute_norm2(norm.get());
+    return std::move(norm);
+}
+
+
+/**
+ * Returns the residual norm if available, otherwise computes it from the
+ * residual if this is a dense vector and keeps it alive in `storage`.
+ */
+const LinOp *get_residual_norm(const LinOp *residual,
+                               const LinOp *residual_norm,
+                               std::unique_ptr<LinOp> &storage)
+{
+    if (residual_norm != nullptr || residual == nullptr) {
+        return residual_norm;
+    }
+    storage = try_compute_norm<float>(residual);
+    if (storage == nullptr) {
+        storage = try_compute_norm<double>(residual);
+    }
+    if (storage == nullptr) {
+        storage = try_compute_norm<std::complex<float>>(residual);
+    }
+    if (storage == nullptr) {
+        storage = try_compute_norm<std::complex<double>>(residual);
+    }
+    return storage.get();
+}
+
+
+}  // namespace
 
 
 void Record::on_allocation_started(const Executor *exec,
                                    const size_type &num_bytes) const
 {
+    if (!this->is_sampled(Logger::allocation_started)) {
+        return;
+    }
     append_deque(data_.allocation_started,
                  (std::unique_ptr<executor_data>(
                      new executor_data{exec, num_bytes, 0})));
@@ -55,6 +106,9 @@ void Record::on_allocation_completed(const Executor *exec,
                                      const size_type &num_bytes,
                                      const uintptr &location) const
 {
+    if (!this->is_sampled(Logger::allocation_completed)) {
+        return;
+    }
     append_deque(data_.allocation_completed,
                  (std::unique_ptr<executor_data>(
                      new executor_data{exec, num_bytes, location})));
@@ -64,6 +118,9 @@ void Record::on_allocation_completed(const Executor *exec,
 void Record::on_free_started(const Executor *exec,
                              const uintptr &location) const
 {
+    if (!this->is_sampled(Logger::free_started)) {
+        return;
+    }
     append_deque(
         data_.free_started,
         (std::unique_ptr<executor_data>(new executor_data{exec, 0, location})));
@@ -73,6 +130,9 @@ void Record::on_free_started(const Executor *exec,
 void Record::on_free_completed(const Executor *exec,
                                const uintptr &location) const
 {
+    if (!this->is_sampled(Logger::free_completed)) {
+        return;
+    }
     append_deque(
         data_.free_completed,
         (std::unique_ptr<executor_data>(new executor_data{exec, 0, location})));
@@ -84,6 +144,9 @@ void Record::on_copy_started(const Executor *from, const Executor *to,
                              const uintptr &location_to,
                              const size_type &num_bytes) const
 {
+    if (!this->is_sampled(Logger::copy_started)) {
+        return;
+    }
     using tuple = std::tuple<executor_data, executor_data>;
     append_deque(
         data_.copy_started,
@@ -97,6 +160,9 @@ void Record::on_copy_completed(const Executor *from, const Executor *to,
                                const uintptr &location_to,
                                const size_type &num_bytes) const
 {
+    if (!this->is_sampled(Logger::copy_completed)) {
+        return;
+    }
     using tuple = std::tuple<executor_data, executor_data>;
     append_deque(
         data_.copy_completed,
@@ -108,6 +174,9 @@ void Record::on_copy_completed(const Executor *from, const Executor *to,
 void Record::on_operation_launched(const Executor *exec,
                                    const Operation *operation) const
 {
+    if (!this->is_sampled(Logger::operation_launched)) {
+        return;
+    }
     append_deque(
         data_.operation_launched,
         (std::unique_ptr<operation_data>(new operation_data{exec, operation})));
@@ -117,6 +186,9 @@ void Record::on_operation_launched(const Executor *exec,
 void Record::on_operation_completed(const Executor *exec,
                                     const Operation *operation) const
 {
+    if (!this->is_sampled(Logger::operation_completed)) {
+        return;
+    }
     append_deque(
         data_.operation_completed,
         (std::unique_ptr<operation_data>(new operation_data{exec, operation})));
@@ -126,6 +198,9 @@ void Record::on_operation_completed(const Executor *exec,
 void Record::on_polymorphic_object_create_started(
     const Executor *exec, const PolymorphicObject *po) const
 {
+    if (!this->is_sampled(Logger::polymorphic_object_create_started)) {
+        return;
+    }
     append_deque(data_.polymorphic_object_create_started,
                  (std::unique_ptr<polymorphic_object_data>(
                      new polymorphic_object_data{exec, po})));
@@ -136,6 +211,9 @@ void Record::on_polymorphic_object_create_completed(
     const Executor *exec, const PolymorphicObject *input,
     const PolymorphicObject *output) const
 {
+    if (!this->is_sampled(Logger::polymorphic_object_create_completed)) {
+        return;
+    }
     append_deque(data_.polymorphic_object_create_completed,
                  (std::unique_ptr<polymorphic_object_data>(
                      new polymorphic_object_data{exec, input, output})));
@@ -146,6 +224,9 @@ void Record::on_polymorphic_object_copy_started(
     const Executor *exec, const PolymorphicObject *from,
     const PolymorphicObject *to) const
 {
+    if (!this->is_sampled(Logger::polymorphic_object_copy_started)) {
+        return;
+    }
     append_deque(data_.polymorphic_object_copy_started,
                  (std::unique_ptr<polymorphic_object_data>(
                      new polymorphic_object_data{exec, from, to})));
@@ -156,6 +237,9 @@ void Record::on_polymorphic_object_copy_completed(
     const Executor *exec, const PolymorphicObject *from,
     const PolymorphicObject *to) const
 {
+    if (!this->is_sampled(Logger::polymorphic_object_copy_completed)) {
+        return;
+    }
     append_deque(data_.polymorphic_object_copy_completed,
                  (std::unique_ptr<polymorphic_object_data>(
                      new polymorphic_object_data{exec, from, to})));
@@ -165,6 +249,9 @@ void Record::on_polymorphic_object_copy_completed(
 void Record::on_polymorphic_object_deleted(const Executor *exec,
                                            const PolymorphicObject *po) const
 {
+    if (!this->is_sampled(Logger::polymorphic_object_deleted)) {
+        return;
+    }
     append_deque(data_.polymorphic_object_deleted,
                  (std::unique_ptr<polymorphic_object_data>(
                      new polymorphic_object_data{exec, po})));
@@ -174,6 +261,9 @@ void Record::on_polymorphic_object_deleted(const Executor *exec,
 void Record::on_linop_apply_started(const LinOp *A, const LinOp *b,
                                     const LinOp *x) const
 {
+    if (!this->is_sampled(Logger::linop_apply_started)) {
+        return;
+    }
     append_deque(data_.linop_apply_started,
                  (std::unique_ptr<linop_data>(
                      new linop_data{A, nullptr, b, nullptr, x})));
@@ -183,6 +273,9 @@ void Record::on_linop_apply_started(const LinOp *A, const LinOp *b,
 void Record::on_linop_apply_completed(const LinOp *A, const LinOp *b,
                                       const LinOp *x) const
 {
+    if (!this->is_sampled(Logger::linop_apply_completed)) {
+        return;
+    }
     append_deque(data_.linop_apply_completed,
                  (std::unique_ptr<linop_data>(
                      new linop_data{A, nullptr, b, nullptr, x})));
@@ -193,6 +286,9 @@ void Record::on_linop_advanced_apply_started(const LinOp *A, const LinOp *alpha,
                                              const LinOp *b, const LinOp *beta,
                                              const LinOp *x) const
 {
+    if (!this->is_sampled(Logger::linop_advanced_apply_started)) {
+        return;
+    }
     append_deque(
         data_.linop_advanced_apply_started,
         (std::unique_ptr<linop_data>(new linop_data{A, alpha, b, beta, x})));
@@ -205,6 +301,9 @@ void Record::on_linop_advanced_apply_completed(const LinOp *A,
                                                const LinOp *beta,
                                                const LinOp *x) const
 {
+    if (!this->is_sampled(Logger::linop_advanced_apply_completed)) {
+        return;
+    }
     append_deque(
         data_.linop_advanced_apply_completed,
         (std::unique_ptr<linop_data>(new linop_data{A, alpha, b, beta, x})));
@@ -214,6 +313,9 @@ void Record::on_linop_advanced_apply_completed(const LinOp *A,
 void Record::on_linop_factory_generate_started(const LinOpFactory *factory,
                                                const LinOp *input) const
 {
+    if (!this->is_sampled(Logger::linop_factory_generate_started)) {
+        return;
+    }
     append_deque(data_.linop_factory_generate_started,
                  (std::unique_ptr<linop_factory_data>(
                      new linop_factory_data{factory, input, nullptr})));
@@ -224,6 +326,9 @@ void Record::on_linop_factory_generate_completed(const LinOpFactory *factory,
                                                  const LinOp *input,
                                                  const LinOp *output) const
 {
+    if (!this->is_sampled(Logger::linop_factory_generate_completed)) {
+        return;
+    }
     append_deque(data_.linop_factory_generate_completed,
                  (std::unique_ptr<linop_factory_data>(
                      new linop_factory_data{factory, input, output})));
@@ -235,6 +340,16 @@ void Record::on_criterion_check_started(
     const LinOp *residual, const LinOp *residual_norm, const LinOp *solution,
     const uint8 &stopping_id, const bool &set_finalized) const
 {
+    if (!this->is_sampled(Logger::criterion_check_started)) {
+        return;
+    }
+    std::unique_ptr<LinOp> norm_storage;
+    if (!store_vectors_) {
+        residual_norm =
+            get_residual_norm(residual, residual_norm, norm_storage);
+        residual = nullptr;
+        solution = nullptr;
+    }
     append_deque(data_.criterion_check_started,
                  (std::unique_ptr<criterion_data>(new criterion_data{
                      criterion, num_iterations, residual, residual_norm,
@@ -249,6 +364,16 @@ void Record::on_criterion_check_completed(
     const Array<stopping_status> *status, const bool &oneChanged,
     const bool &converged) const
 {
+    if (!this->is_sampled(Logger::criterion_check_completed)) {
+        return;
+    }
+    std::unique_ptr<LinOp> norm_storage;
+    if (!store_vectors_) {
+        residual_norm =
+            get_residual_norm(residual, residual_norm, norm_storage);
+        residual = nullptr;
+        solution = nullptr;
+    }
     append_deque(
         data_.criterion_check_completed,
         (std::unique_ptr<criterion_data>(new criterion_data{
@@ -262,6 +387,16 @@ void Record::on_iteration_complete(const LinOp *solver,
                                    const LinOp *residual, const LinOp *solution,
                                    const LinOp *residual_norm) const
 {
+    if (!this->is_sampled(Logger::iteration_complete)) {
+        return;
+    }
+    std::unique_ptr<LinOp> norm_storage;
+    if (!store_vectors_) {
+        residual_norm =
+            get_residual_norm(residual, residual_norm, norm_storage);
+        residual = nullptr;
+        solution = nullptr;
+    }
     append_deque(
         data_.iteration_completed,
         (std::unique_ptr<iteration_complete_data>(new iteration_complete_data{
@@ -435,8 +435,10 @@ void Stream<ValueType>::on_iteration_complete(const LinOp *solver,
         << demangle_name(solution) << " and residual_norm "
         << demangle_name(residual_norm) << std::endl;
     if (verbose_) {
-        os_ << demangle_name(residual)
-            << as<gko::matrix::Dense<ValueType>>(residual) << std::endl;
+        if (residual != nullptr) {
+            os_ << demangle_name(residual)
+                << as<gko::matrix::Dense<ValueType>>(residual) << std::endl;
+        }
         if (solution != nullptr) {
             os_ << demangle_name(solution)
                 << as<gko::matrix::Dense<ValueType>>(solution) << std::endl;
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
+#include "core/base/host_operation.hpp"
 #include "core/components/fill_array.hpp"
 #include "core/matrix/csr_kernels.hpp"
 
@@ -80,12 +81,35 @@ GKO_REGISTER_OPERATION(sort_by_column_index, csr::sort_by_column_index);
 GKO_REGISTER_OPERATION(is_sorted_by_column_index,
                        csr::is_sorted_by_column_index);
 GKO_REGISTER_OPERATION(extract_diagonal, csr::extract_diagonal);
+GKO_REGISTER_OPERATION(update_values, csr::update_values);
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_HOST_OPERATION(find_value_slots, csr::find_value_slots);
+GKO_REGISTER_HOST_OPERATION(build_value_map, csr::build_value_map);
+GKO_REGISTER_HOST_OPERATION(write_matrix_data, csr::write_matrix_data);
 
 
 }  // namespace csr
 
 
+namespace {
+
+
+// returns `array` if it is stored on `exec`, otherwise a copy of it in `buffer`
+template <typename T>
+const Array<T> &on_executor(std::shared_ptr<const Executor> exec,
+                            const Array<T> &array, Array<T> &buffer)
+{
+    if (array.get_executor() == exec) {
+        return array;
+    }
+    buffer = Array<T>{exec, array};
+    return buffer;
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
 {
@@ -338,16 +362,8 @@ void Csr<ValueType, IndexType>::write(mat_data &data) const
     }
 
     data = {tmp->get_size(), {}};
-
-    for (size_type row = 0; row < tmp->get_size()[0]; ++row) {
-        const auto start = tmp->row_ptrs_.get_const_data()[row];
-        const auto end = tmp->row_ptrs_.get_const_data()[row + 1];
-        for (auto i = start; i < end; ++i) {
-            const auto col = tmp->col_idxs_.get_const_data()[i];
-            const auto val = tmp->values_.get_const_data()[i];
-            data.nonzeros.emplace_back(row, col, val);
-        }
-    }
+    this->get_executor()->get_master()->run(
+        csr::make_write_matrix_data(tmp, data));
 }
 
 
@@ -482,6 +498,82 @@ Csr<ValueType, IndexType>::extract_diagonal() const
 }
 
 
+template <typename ValueType, typename IndexType>
+typename Csr<ValueType, IndexType>::value_map
+Csr<ValueType, IndexType>::build_value_map(const Array<index_type> &rows,
+                                           const Array<index_type> &cols) const
+{
+    GKO_ASSERT_EQ(rows.get_num_elems(), cols.get_num_elems());
+    auto exec = this->get_executor();
+    auto host = exec->get_master();
+    const auto num_contributions = rows.get_num_elems();
+    Array<index_type> row_buffer{host};
+    Array<index_type> col_buffer{host};
+    const auto &host_rows = on_executor(host, rows, row_buffer);
+    const auto &host_cols = on_executor(host, cols, col_buffer);
+    const auto row_data = host_rows.get_const_data();
+    const auto col_data = host_cols.get_const_data();
+    for (size_type i = 0; i < num_contributions; ++i) {
+        GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(row_data[i]),
+                             this->get_size()[0]);
+        GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(col_data[i]),
+                             this->get_size()[1]);
+    }
+    // the mapping is a one-time setup, so it is always computed on the host
+    auto host_mtx = make_temporary_clone(host, this);
+    Array<index_type> slots{host, num_contributions};
+    host->run(csr::make_find_value_slots(host_mtx.get(), host_rows, host_cols,
+                                         slots.get_data()));
+    const auto slot_data = slots.get_const_data();
+    for (size_type i = 0; i < num_contributions; ++i) {
+        if (slot_data[i] < 0) {
+            throw ValueMismatch(__FILE__, __LINE__, __func__, row_data[i],
+                                col_data[i],
+                                "position is not part of the sparsity pattern");
+        }
+    }
+    value_map map{
+        Array<index_type>{host, this->get_num_stored_elements() + 1},
+        Array<index_type>{host, num_contributions}};
+    host->run(csr::make_build_value_map(host_mtx.get(), slots,
+                                        map.slot_ptrs.get_data(),
+                                        map.contribution_idxs.get_data()));
+    if (host != exec) {
+        return value_map{Array<index_type>{exec, map.slot_ptrs},
+                         Array<index_type>{exec, map.contribution_idxs}};
+    }
+    return map;
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::update_values(
+    const value_map &map, const Array<value_type> &contributions)
+{
+    GKO_ASSERT_EQ(map.slot_ptrs.get_num_elems(),
+                  this->get_num_stored_elements() + 1);
+    GKO_ASSERT_EQ(map.contribution_idxs.get_num_elems(),
+                  contributions.get_num_elems());
+    auto exec = this->get_executor();
+    Array<index_type> slot_ptr_buffer{exec};
+    Array<index_type> contribution_idx_buffer{exec};
+    Array<value_type> contribution_buffer{exec};
+    exec->run(csr::make_update_values(
+        on_executor(exec, map.slot_ptrs, slot_ptr_buffer),
+        on_executor(exec, map.contribution_idxs, contribution_idx_buffer),
+        on_executor(exec, contributions, contribution_buffer), this));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::update_values(
+    const Array<index_type> &rows, const Array<index_type> &cols,
+    const Array<value_type> &contributions)
+{
+    this->update_values(this->build_value_map(rows, cols), contributions);
+}
+
+
 #define GKO_DECLARE_CSR_MATRIX(ValueType, IndexType) \
     class Csr<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_MATRIX);
@@ -0,0 +1,191 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/components/fill_array.hpp"
+#include "core/components/prefix_sum.hpp"
+#include "core/matrix/csr_assembler_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace csr_assembler {
+
+
+GKO_REGISTER_OPERATION(count_nonzeros_per_row,
+                       csr_assembler::count_nonzeros_per_row);
+GKO_REGISTER_OPERATION(fill_in, csr_assembler::fill_in);
+GKO_REGISTER_OPERATION(sort_by_column_and_entry,
+                       csr_assembler::sort_by_column_and_entry);
+GKO_REGISTER_OPERATION(sum_duplicates, csr_assembler::sum_duplicates);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_OPERATION(prefix_sum, components::prefix_sum);
+
+
+}  // namespace csr_assembler
+
+
+template <typename ValueType, typename IndexType>
+CsrAssembler<ValueType, IndexType>::CsrAssembler(
+    std::shared_ptr<const Executor> exec, const dim<2> &size,
+    bool sum_duplicates)
+    : exec_{std::move(exec)},
+      size_{size},
+      sum_duplicates_{sum_duplicates},
+      num_entries_{}
+{}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::insert(size_type num_entries,
+                                                const index_type *rows,
+                                                const index_type *cols,
+                                                const value_type *values)
+{
+    auto host = exec_->get_master();
+    this->insert(Array<index_type>(host, rows, rows + num_entries),
+                 Array<index_type>(host, cols, cols + num_entries),
+                 Array<value_type>(host, values, values + num_entries));
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::insert(Array<index_type> rows,
+                                                Array<index_type> cols,
+                                                Array<value_type> values)
+{
+    GKO_ASSERT_EQ(rows.get_num_elems(), cols.get_num_elems());
+    GKO_ASSERT_EQ(rows.get_num_elems(), values.get_num_elems());
+    auto host = exec_->get_master();
+    chunk c{Array<index_type>{host, std::move(rows)},
+            Array<index_type>{host, std::move(cols)},
+            Array<value_type>{host, std::move(values)}};
+    this->check_bounds(c);
+    std::lock_guard<std::mutex> guard{mutex_};
+    num_entries_ += c.rows.get_num_elems();
+    chunks_.push_back(std::move(c));
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type CsrAssembler<ValueType, IndexType>::get_num_entries() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_entries_;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Csr<ValueType, IndexType>>
+CsrAssembler<ValueType, IndexType>::finalize(
+    std::shared_ptr<typename matrix_type::strategy_type> strategy)
+{
+    std::vector<chunk> chunks;
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        chunks.swap(chunks_);
+        num_entries_ = 0;
+    }
+    auto host = exec_->get_master();
+    const auto num_rows = size_[0];
+    Array<index_type> row_ptrs{host, num_rows + 1};
+    host->run(csr_assembler::make_fill_array(row_ptrs.get_data(), num_rows + 1,
+                                             zero<index_type>()));
+    for (const auto &c : chunks) {
+        host->run(csr_assembler::make_count_nonzeros_per_row(
+            c.rows, c.values, row_ptrs.get_data()));
+    }
+    host->run(csr_assembler::make_prefix_sum(row_ptrs.get_data(),
+                                             num_rows + 1));
+    const auto nnz = static_cast<size_type>(row_ptrs.get_data()[num_rows]);
+    Array<index_type> col_idxs{host, nnz};
+    Array<value_type> values{host, nnz};
+    Array<index_type> row_cursors{row_ptrs};
+    // the index of every nonzero in the sequence of all inserted entries
+    Array<int64> entry_idxs{host, nnz};
+    int64 first_entry{};
+    for (auto &c : chunks) {
+        host->run(csr_assembler::make_fill_in(
+            c.rows, c.cols, c.values, first_entry, row_cursors.get_data(),
+            col_idxs.get_data(), values.get_data(), entry_idxs.get_data()));
+        first_entry += static_cast<int64>(c.rows.get_num_elems());
+        // release every chunk as soon as possible to reduce the peak memory
+        c.rows.clear();
+        c.cols.clear();
+        c.values.clear();
+    }
+    row_cursors.clear();
+    auto result = matrix_type::create(host, size_, std::move(values),
+                                      std::move(col_idxs), std::move(row_ptrs),
+                                      std::move(strategy));
+    // duplicates keep the order in which they were inserted, independent of
+    // the order in which they were scattered, so their sum is reproducible
+    host->run(csr_assembler::make_sort_by_column_and_entry(
+        result.get(), entry_idxs.get_const_data()));
+    entry_idxs.clear();
+    if (sum_duplicates_) {
+        host->run(csr_assembler::make_sum_duplicates(result.get()));
+    }
+    if (host != exec_) {
+        return gko::clone(exec_, result);
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::check_bounds(const chunk &c) const
+{
+    const auto rows = c.rows.get_const_data();
+    const auto cols = c.cols.get_const_data();
+    for (size_type i = 0; i < c.rows.get_num_elems(); ++i) {
+        GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(rows[i]), size_[0]);
+        GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(cols[i]), size_[1]);
+    }
+}
+
+
+#define GKO_DECLARE_CSR_ASSEMBLER(ValueType, IndexType) \
+    class CsrAssembler<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ASSEMBLER);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,133 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_CSR_ASSEMBLER_KERNELS_HPP_
+#define GKO_CORE_MATRIX_CSR_ASSEMBLER_KERNELS_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_CSR_ASSEMBLER_COUNT_NONZEROS_PER_ROW_KERNEL(ValueType,   \
+                                                                IndexType)   \
+    void count_nonzeros_per_row(std::shared_ptr<const DefaultExecutor> exec, \
+                                const Array<IndexType> &rows,                \
+                                const Array<ValueType> &values,              \
+                                IndexType *row_nnz)
+
+#define GKO_DECLARE_CSR_ASSEMBLER_FILL_IN_KERNEL(ValueType, IndexType) \
+    void fill_in(std::shared_ptr<const DefaultExecutor> exec,          \
+                 const Array<IndexType> &rows,                         \
+                 const Array<IndexType> &cols,                         \
+                 const Array<ValueType> &values, int64 first_entry,    \
+                 IndexType *row_cursors, IndexType *col_idxs,          \
+                 ValueType *csr_values, int64 *entry_idxs)
+
+#define GKO_DECLARE_CSR_ASSEMBLER_SORT_BY_COLUMN_AND_ENTRY_KERNEL(ValueType, \
+                                                                  IndexType) \
+    void sort_by_column_and_entry(                                           \
+        std::shared_ptr<const DefaultExecutor> exec,                         \
+        matrix::Csr<ValueType, IndexType> *mtx, const int64 *entry_idxs)
+
+#define GKO_DECLARE_CSR_ASSEMBLER_SUM_DUPLICATES_KERNEL(ValueType, IndexType) \
+    void sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,          \
+                        matrix::Csr<ValueType, IndexType> *mtx)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                      \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_CSR_ASSEMBLER_COUNT_NONZEROS_PER_ROW_KERNEL(ValueType,    \
+                                                            IndexType);   \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_CSR_ASSEMBLER_FILL_IN_KERNEL(ValueType, IndexType);       \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_CSR_ASSEMBLER_SORT_BY_COLUMN_AND_ENTRY_KERNEL(ValueType,  \
+                                                              IndexType); \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_CSR_ASSEMBLER_SUM_DUPLICATES_KERNEL(ValueType, IndexType)
+
+
+namespace omp {
+namespace csr_assembler {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace csr_assembler
+}  // namespace omp
+
+
+namespace cuda {
+namespace csr_assembler {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace csr_assembler
+}  // namespace cuda
+
+
+namespace reference {
+namespace csr_assembler {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace csr_assembler
+}  // namespace reference
+
+
+namespace hip {
+namespace csr_assembler {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace csr_assembler
+}  // namespace hip
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_CSR_ASSEMBLER_KERNELS_HPP_
@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
@@ -180,6 +181,30 @@ namespace kernels {
                           const matrix::Csr<ValueType, IndexType> *orig, \
                           matrix::Diagonal<ValueType> *diag)
 
+#define GKO_DECLARE_CSR_FIND_VALUE_SLOTS_KERNEL(ValueType, IndexType)      \
+    void find_value_slots(std::shared_ptr<const DefaultExecutor> exec,     \
+                          const matrix::Csr<ValueType, IndexType> *source, \
+                          const Array<IndexType> &rows,                    \
+                          const Array<IndexType> &cols, IndexType *slots)
+
+#define GKO_DECLARE_CSR_BUILD_VALUE_MAP_KERNEL(ValueType, IndexType)      \
+    void build_value_map(std::shared_ptr<const DefaultExecutor> exec,     \
+                         const matrix::Csr<ValueType, IndexType> *source, \
+                         const Array<IndexType> &slots,                   \
+                         IndexType *slot_ptrs, IndexType *contribution_idxs)
+
+#define GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL(ValueType, IndexType)  \
+    void update_values(std::shared_ptr<const DefaultExecutor> exec, \
+                       const Array<IndexType> &slot_ptrs,           \
+                       const Array<IndexType> &contribution_idxs,   \
+                       const Array<ValueType> &contributions,       \
+                       matrix::Csr<ValueType, IndexType> *mtx)
+
+#define GKO_DECLARE_CSR_WRITE_MATRIX_DATA_KERNEL(ValueType, IndexType)      \
+    void write_matrix_data(std::shared_ptr<const DefaultExecutor> exec,     \
+                           const matrix::Csr<ValueType, IndexType> *source, \
+                           matrix_data<ValueType, IndexType> &data)
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                         \
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_SPMV_KERNEL(ValueType, IndexType);                       \
@@ -224,13 +249,27 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                        \
     GKO_DECLARE_CSR_IS_SORTED_BY_COLUMN_INDEX(ValueType, IndexType);         \
     template <typename ValueType, typename IndexType>                        \
-    GKO_DECLARE_CSR_EXTRACT_DIAGONAL(ValueType, IndexType)
+    GKO_DECLARE_CSR_EXTRACT_DIAGONAL(ValueType, IndexType);                  \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL(ValueType, IndexType)
+
+
+// kernels working on host memory, they are run on the master executor and
+// only exist for the host executors
+#define GKO_DECLARE_ALL_HOST_AS_TEMPLATES                             \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_CSR_FIND_VALUE_SLOTS_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_CSR_BUILD_VALUE_MAP_KERNEL(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_CSR_WRITE_MATRIX_DATA_KERNEL(ValueType, IndexType)
 
 
 namespace omp {
 namespace csr {
 
 GKO_DECLARE_ALL_AS_TEMPLATES;
+GKO_DECLARE_ALL_HOST_AS_TEMPLATES;
 
 }  // namespace csr
 }  // namespace omp
@@ -249,6 +288,7 @@ namespace reference {
 namespace csr {
 
 GKO_DECLARE_ALL_AS_TEMPLATES;
+GKO_DECLARE_ALL_HOST_AS_TEMPLATES;
 
 }  // namespace csr
 }  // namespace reference
@@ -264,6 +304,7 @@ GKO_DECLARE_ALL_AS_TEMPLATES;
 
 
 #undef GKO_DECLARE_ALL_AS_TEMPLATES
+#undef GKO_DECLARE_ALL_HOST_AS_TEMPLATES
 
 
 }  // namespace kernels
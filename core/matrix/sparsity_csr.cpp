@@ -116,6 +116,29 @@ void SparsityCsr<ValueType, IndexType>::read(const mat_data &data)
 }
 
 
+template <typename ValueType, typename IndexType>
+void SparsityCsr<ValueType, IndexType>::read(const pattern_data &data)
+{
+    const auto nnz = data.nonzeros.size();
+    auto tmp =
+        SparsityCsr::create(this->get_executor()->get_master(), data.size, nnz);
+    auto row_ptrs = tmp->get_row_ptrs();
+    auto col_idxs = tmp->get_col_idxs();
+    tmp->get_value()[0] = one<ValueType>();
+    size_type ind = 0;
+    row_ptrs[0] = 0;
+    for (size_type row = 0; row < data.size[0]; ++row) {
+        for (; ind < nnz &&
+               static_cast<size_type>(data.nonzeros[ind].row) <= row;
+             ++ind) {
+            col_idxs[ind] = data.nonzeros[ind].column;
+        }
+        row_ptrs[row + 1] = ind;
+    }
+    tmp->move_to(this);
+}
+
+
 template <typename ValueType, typename IndexType>
 void SparsityCsr<ValueType, IndexType>::write(mat_data &data) const
 {
@@ -0,0 +1,170 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/matrix/stencil_kernels.hpp"
+#include "core/matrix/stencil_utils.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace stencil {
+
+
+GKO_REGISTER_OPERATION(spmv, stencil::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, stencil::advanced_spmv);
+GKO_REGISTER_OPERATION(convert_to_csr, stencil::convert_to_csr);
+GKO_REGISTER_OPERATION(extract_diagonal, stencil::extract_diagonal);
+
+
+}  // namespace stencil
+
+
+template <typename ValueType>
+void Stencil<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    this->get_executor()->run(stencil::make_spmv(
+        this, as<Dense<ValueType>>(b), as<Dense<ValueType>>(x)));
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                    const LinOp *beta, LinOp *x) const
+{
+    this->get_executor()->run(stencil::make_advanced_spmv(
+        as<Dense<ValueType>>(alpha), this, as<Dense<ValueType>>(b),
+        as<Dense<ValueType>>(beta), as<Dense<ValueType>>(x)));
+}
+
+
+namespace {
+
+
+template <typename ValueType, typename IndexType>
+inline void convert_to_csr_impl(const Stencil<ValueType> *source,
+                                Csr<ValueType, IndexType> *result)
+{
+    auto exec = source->get_executor();
+    const auto nnz = detail::compute_stencil_nnz(
+        source->get_grid_size(),
+        detail::get_stencil_offsets(source->get_num_dimensions(),
+                                    source->get_shape()));
+    auto tmp = Csr<ValueType, IndexType>::create(
+        exec, source->get_size(), nnz, result->get_strategy());
+    exec->run(stencil::make_convert_to_csr(source, tmp.get()));
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename MatrixData>
+inline void write_impl(const Stencil<ValueType> *source, MatrixData &data)
+{
+    using index_type = typename MatrixData::index_type;
+    auto tmp = Csr<ValueType, index_type>::create(
+        source->get_executor()->get_master());
+    convert_to_csr_impl(source, tmp.get());
+    tmp->write(data);
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void Stencil<ValueType>::convert_to(Csr<ValueType, int32> *result) const
+{
+    convert_to_csr_impl(this, result);
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::move_to(Csr<ValueType, int32> *result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::convert_to(Csr<ValueType, int64> *result) const
+{
+    convert_to_csr_impl(this, result);
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::move_to(Csr<ValueType, int64> *result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::write(mat_data &data) const
+{
+    write_impl(this, data);
+}
+
+
+template <typename ValueType>
+void Stencil<ValueType>::write(mat_data32 &data) const
+{
+    write_impl(this, data);
+}
+
+
+template <typename ValueType>
+std::unique_ptr<Diagonal<ValueType>>
+Stencil<ValueType>::extract_diagonal() const
+{
+    auto exec = this->get_executor();
+    auto diag = Diagonal<ValueType>::create(exec, this->get_size()[0]);
+    exec->run(stencil::make_extract_diagonal(this, lend(diag)));
+    return diag;
+}
+
+
+#define GKO_DECLARE_STENCIL_MATRIX(ValueType) class Stencil<ValueType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
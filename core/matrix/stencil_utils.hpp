@@ -0,0 +1,140 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_MATRIX_STENCIL_UTILS_HPP_
+#define GKO_CORE_MATRIX_STENCIL_UTILS_HPP_
+
+
+#include <cstdlib>
+#include <vector>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace detail {
+
+
+/**
+ * @internal
+ *
+ * The offset of a stencil point from the center point along each axis.
+ */
+struct stencil_offset {
+    int x;
+    int y;
+    int z;
+};
+
+
+/**
+ * @internal
+ *
+ * Returns the offsets of all points of a stencil, in the order in which the
+ * coefficients are stored.
+ */
+inline std::vector<stencil_offset> get_stencil_offsets(
+    size_type num_dimensions, stencil_shape shape)
+{
+    const int y_range = num_dimensions > 1 ? 1 : 0;
+    const int z_range = num_dimensions > 2 ? 1 : 0;
+    std::vector<stencil_offset> offsets;
+    for (int z = -z_range; z <= z_range; ++z) {
+        for (int y = -y_range; y <= y_range; ++y) {
+            for (int x = -1; x <= 1; ++x) {
+                if (shape == stencil_shape::box ||
+                    std::abs(x) + std::abs(y) + std::abs(z) <= 1) {
+                    offsets.push_back({x, y, z});
+                }
+            }
+        }
+    }
+    return offsets;
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the number of nonzeros of the matrix represented by a stencil,
+ * i.e. the number of stencil points which lie inside of the grid, summed up
+ * over all grid points.
+ */
+inline size_type compute_stencil_nnz(
+    const dim<3> &grid_size, const std::vector<stencil_offset> &offsets)
+{
+    auto inner_points = [](size_type size, int offset) {
+        const auto dist = static_cast<size_type>(std::abs(offset));
+        return size > dist ? size - dist : size_type{};
+    };
+    size_type nnz{};
+    for (const auto &offset : offsets) {
+        nnz += inner_points(grid_size[0], offset.x) *
+               inner_points(grid_size[1], offset.y) *
+               inner_points(grid_size[2], offset.z);
+    }
+    return nnz;
+}
+
+
+/**
+ * @internal
+ *
+ * Returns the column index of a stencil point in the given row, or -1 if the
+ * point lies outside of the grid.
+ */
+inline int64 get_stencil_column(const dim<3> &grid_size, int64 row,
+                                const stencil_offset &offset)
+{
+    const auto nx = static_cast<int64>(grid_size[0]);
+    const auto ny = static_cast<int64>(grid_size[1]);
+    const auto nz = static_cast<int64>(grid_size[2]);
+    const auto x = row % nx + offset.x;
+    const auto y = row / nx % ny + offset.y;
+    const auto z = row / (nx * ny) + offset.z;
+    if (x < 0 || x >= nx || y < 0 || y >= ny || z < 0 || z >= nz) {
+        return -1;
+    }
+    return x + nx * (y + ny * z);
+}
+
+
+}  // namespace detail
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_STENCIL_UTILS_HPP_
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/upper_trs.hpp>
 
 
+#include "core/base/serialization.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 
 
@@ -57,6 +58,8 @@ namespace isai {
 GKO_REGISTER_OPERATION(generate_tri_inverse, isai::generate_tri_inverse);
 GKO_REGISTER_OPERATION(generate_excess_system, isai::generate_excess_system);
 GKO_REGISTER_OPERATION(scatter_excess_solution, isai::scatter_excess_solution);
+GKO_REGISTER_OPERATION(generate_general_inverse,
+                       isai::generate_general_inverse);
 
 
 }  // namespace isai
@@ -158,6 +161,14 @@ void Isai<IsaiType, ValueType, IndexType>::generate_inverse(
     auto exec = this->get_executor();
     auto to_invert = convert_to_csr_and_sort<Csr>(exec, input, skip_sorting);
     auto inverted = extend_sparsity(exec, to_invert, power);
+    if (IsaiType == isai_type::general) {
+        // every row is an independent least-squares problem, there are no
+        // excess systems to solve
+        exec->run(isai::make_generate_general_inverse(lend(to_invert),
+                                                      lend(inverted)));
+        approximate_inverse_ = std::move(inverted);
+        return;
+    }
     auto num_rows = inverted->get_size()[0];
     auto is_lower = IsaiType == isai_type::lower;
 
@@ -233,6 +244,41 @@ std::unique_ptr<LinOp> Isai<IsaiType, ValueType, IndexType>::conj_transpose()
 }
 
 
+template <isai_type IsaiType, typename ValueType, typename IndexType>
+void Isai<IsaiType, ValueType, IndexType>::save(
+    std::ostream &os, const LinOp *system_matrix) const
+{
+    write_binary_header<ValueType, IndexType>(os, binary_format::isai,
+                                              system_matrix);
+    write_binary_value(os, static_cast<uint32>(IsaiType));
+    write_binary_csr(os, lend(approximate_inverse_));
+}
+
+
+template <isai_type IsaiType, typename ValueType, typename IndexType>
+std::unique_ptr<Isai<IsaiType, ValueType, IndexType>>
+Isai<IsaiType, ValueType, IndexType>::load(std::istream &is,
+                                           const Factory *factory,
+                                           const LinOp *system_matrix)
+{
+    read_binary_header<ValueType, IndexType>(is, binary_format::isai,
+                                             system_matrix);
+    if (read_binary_value<uint32>(is) != static_cast<uint32>(IsaiType)) {
+        throw GKO_STREAM_ERROR("the data stores a different type of ISAI");
+    }
+    const auto exec = factory->get_executor();
+    std::unique_ptr<Isai> result{new Isai{exec}};
+    result->set_size(system_matrix->get_size());
+    result->parameters_ = factory->get_parameters();
+    result->approximate_inverse_ = read_binary_csr<ValueType, IndexType>(
+        is, exec, std::make_shared<typename Csr::classical>());
+    if (result->approximate_inverse_->get_size() != system_matrix->get_size()) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    return result;
+}
+
+
 #define GKO_DECLARE_LOWER_ISAI(ValueType, IndexType) \
     class Isai<isai_type::lower, ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LOWER_ISAI);
@@ -241,6 +287,10 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LOWER_ISAI);
     class Isai<isai_type::upper, ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_UPPER_ISAI);
 
+#define GKO_DECLARE_GENERAL_ISAI(ValueType, IndexType) \
+    class Isai<isai_type::general, ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_GENERAL_ISAI);
+
 
 }  // namespace preconditioner
 }  // namespace gko
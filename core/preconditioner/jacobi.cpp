@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "core/base/extended_float.hpp"
+#include "core/base/serialization.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
 #include "core/preconditioner/jacobi_utils.hpp"
 
@@ -64,6 +65,48 @@ GKO_REGISTER_OPERATION(initialize_precisions, jacobi::initialize_precisions);
 }  // namespace jacobi
 
 
+namespace {
+
+
+/**
+ * checks that the block pointers read from a stream start at zero, are
+ * non-decreasing, end at `num_rows`, and that no block is larger than
+ * `max_block_size`
+ */
+template <typename IndexType>
+bool valid_block_pointers(const Array<IndexType> &block_pointers,
+                          size_type num_rows, uint32 max_block_size)
+{
+    const auto ptrs = block_pointers.get_const_data();
+    const auto num_ptrs = block_pointers.get_num_elems();
+    if (num_ptrs == 0 || ptrs[0] != 0 ||
+        static_cast<size_type>(ptrs[num_ptrs - 1]) != num_rows) {
+        return false;
+    }
+    for (size_type block = 0; block + 1 < num_ptrs; ++block) {
+        if (ptrs[block] > ptrs[block + 1] ||
+            static_cast<size_type>(ptrs[block + 1] - ptrs[block]) >
+                max_block_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * checks that an array read from a stream stores one entry per block, or none
+ */
+template <typename T>
+bool has_size_or_is_empty(const Array<T> &array, size_type num_blocks)
+{
+    return array.get_num_elems() == 0 || array.get_num_elems() == num_blocks;
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void Jacobi<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
 {
@@ -155,6 +198,7 @@ std::unique_ptr<LinOp> Jacobi<ValueType, IndexType>::transpose() const
     res->num_blocks_ = num_blocks_;
     res->blocks_.resize_and_reset(blocks_.get_num_elems());
     res->conditioning_ = conditioning_;
+    res->requested_precisions_ = requested_precisions_;
     res->parameters_ = parameters_;
     this->get_executor()->run(jacobi::make_transpose_jacobi(
         num_blocks_, parameters_.max_block_size,
@@ -176,6 +220,7 @@ std::unique_ptr<LinOp> Jacobi<ValueType, IndexType>::conj_transpose() const
     res->num_blocks_ = num_blocks_;
     res->blocks_.resize_and_reset(blocks_.get_num_elems());
     res->conditioning_ = conditioning_;
+    res->requested_precisions_ = requested_precisions_;
     res->parameters_ = parameters_;
     this->get_executor()->run(jacobi::make_conj_transpose_jacobi(
         num_blocks_, parameters_.max_block_size,
@@ -220,6 +265,11 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp *system_matrix)
         all_block_opt != precision_reduction(0, 0)) {
         if (!parameters_.storage_optimization.is_block_wise) {
             precisions = gko::Array<precision_reduction>(exec, {all_block_opt});
+        } else if (requested_precisions_.get_num_elems() == 0) {
+            requested_precisions_ = precisions;
+        } else {
+            // restore the request to detect the precisions anew
+            precisions = requested_precisions_;
         }
         Array<precision_reduction> tmp(
             exec, parameters_.block_pointers.get_num_elems() - 1);
@@ -235,6 +285,106 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp *system_matrix)
 }
 
 
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    // the block pointers are already set, so the block detection is skipped
+    this->generate(lend(system_matrix));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::save(std::ostream &os,
+                                        const LinOp *system_matrix) const
+{
+    const auto host = this->get_executor()->get_master();
+    const Array<IndexType> block_pointers{host, parameters_.block_pointers};
+    const auto &storage_optimization = parameters_.storage_optimization;
+    write_binary_header<ValueType, IndexType>(os, binary_format::jacobi,
+                                              system_matrix);
+    write_binary_value(os, parameters_.max_block_size);
+    write_binary_value(os, parameters_.max_block_stride);
+    write_binary_value(
+        os, static_cast<uint8>(storage_optimization.is_block_wise));
+    write_binary_value(os, storage_optimization.of_all_blocks);
+    // only the first num_blocks_ + 1 block pointers are valid
+    write_binary_data(os, block_pointers.get_const_data(), num_blocks_ + 1);
+    write_binary_array(os, storage_optimization.block_wise);
+    write_binary_array(os, requested_precisions_);
+    write_binary_value(os, storage_scheme_.block_offset);
+    write_binary_value(os, storage_scheme_.group_offset);
+    write_binary_value(os, storage_scheme_.group_power);
+    write_binary_array(os, blocks_);
+    write_binary_array(os, conditioning_);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Jacobi<ValueType, IndexType>>
+Jacobi<ValueType, IndexType>::load(std::istream &is, const Factory *factory,
+                                   const LinOp *system_matrix)
+{
+    read_binary_header<ValueType, IndexType>(is, binary_format::jacobi,
+                                             system_matrix);
+    const auto exec = factory->get_executor();
+    std::unique_ptr<Jacobi> result{new Jacobi(exec)};
+    result->set_size(gko::transpose(system_matrix->get_size()));
+    auto &params = result->parameters_;
+    params = factory->get_parameters();
+    auto &storage_optimization = params.storage_optimization;
+    params.block_pointers.set_executor(exec);
+    storage_optimization.block_wise.set_executor(exec);
+    params.max_block_size = read_binary_value<uint32>(is);
+    params.max_block_stride = read_binary_value<uint32>(is);
+    storage_optimization.is_block_wise = read_binary_value<uint8>(is) != 0;
+    storage_optimization.of_all_blocks =
+        read_binary_value<precision_reduction>(is);
+    // the block pointers are validated on the host before moving them to exec
+    auto block_pointers = read_binary_array<IndexType>(is, exec->get_master());
+    storage_optimization.block_wise =
+        read_binary_array<precision_reduction>(is, exec);
+    result->requested_precisions_ =
+        read_binary_array<precision_reduction>(is, exec);
+    const auto block_offset = read_binary_value<IndexType>(is);
+    const auto group_offset = read_binary_value<IndexType>(is);
+    const auto group_power = read_binary_value<uint32>(is);
+    if (!valid_block_pointers(block_pointers, system_matrix->get_size()[0],
+                              params.max_block_size)) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    // the requested precisions are the user input, which is repeated to cover
+    // all blocks, so only the precisions used by the blocks are checked
+    const auto num_blocks = block_pointers.get_num_elems() - 1;
+    if (!has_size_or_is_empty(storage_optimization.block_wise, num_blocks)) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    params.block_pointers = Array<IndexType>{exec, std::move(block_pointers)};
+    // the blocks are stored interleaved, so their layout has to match the
+    // layout used on the executor
+    auto &scheme = result->storage_scheme_;
+    scheme = result->compute_storage_scheme(params.max_block_size,
+                                            params.max_block_stride);
+    if (scheme.block_offset != block_offset ||
+        scheme.group_offset != group_offset ||
+        scheme.group_power != group_power) {
+        throw GKO_STREAM_ERROR(
+            "the blocks are stored in a layout not supported by the executor");
+    }
+    result->num_blocks_ = num_blocks;
+    result->blocks_ = read_binary_array<ValueType>(is, exec);
+    result->conditioning_ =
+        read_binary_array<remove_complex<ValueType>>(is, exec);
+    if (result->blocks_.get_num_elems() !=
+            scheme.compute_storage_space(num_blocks) ||
+        !has_size_or_is_empty(result->conditioning_, num_blocks)) {
+        throw GKO_STREAM_ERROR("the binary data is corrupted");
+    }
+    return result;
+}
+
+
 #define GKO_DECLARE_JACOBI(ValueType, IndexType) \
     class Jacobi<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_JACOBI);
@@ -0,0 +1,467 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/polynomial.hpp>
+
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/components/fill_array.hpp"
+#include "core/preconditioner/polynomial_kernels.hpp"
+
+
+namespace gko {
+namespace preconditioner {
+namespace polynomial {
+
+
+GKO_REGISTER_OPERATION(invert_diagonal, polynomial::invert_diagonal);
+GKO_REGISTER_OPERATION(neumann_step, polynomial::neumann_step);
+GKO_REGISTER_OPERATION(root_step, polynomial::root_step);
+GKO_REGISTER_OPERATION(pair_step, polynomial::pair_step);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+
+
+}  // namespace polynomial
+
+
+namespace {
+
+
+// the small dense problems on the Hessenberg matrix are solved on the host in
+// double precision, independent of the value type
+using host_complex = std::complex<double>;
+using host_matrix = std::vector<std::vector<host_complex>>;
+
+
+template <typename ValueType>
+std::enable_if_t<!is_complex_s<ValueType>::value, ValueType> root_to_value(
+    std::complex<remove_complex<ValueType>> root)
+{
+    return root.real();
+}
+
+
+template <typename ValueType>
+std::enable_if_t<is_complex_s<ValueType>::value, ValueType> root_to_value(
+    std::complex<remove_complex<ValueType>> root)
+{
+    return root;
+}
+
+
+/**
+ * Solves mtx * x = rhs by Gaussian elimination with partial pivoting.
+ */
+std::vector<host_complex> solve_dense(host_matrix mtx,
+                                      std::vector<host_complex> rhs)
+{
+    const auto n = rhs.size();
+    for (size_type col = 0; col < n; ++col) {
+        auto pivot = col;
+        for (auto row = col + 1; row < n; ++row) {
+            if (std::abs(mtx[row][col]) > std::abs(mtx[pivot][col])) {
+                pivot = row;
+            }
+        }
+        std::swap(mtx[col], mtx[pivot]);
+        std::swap(rhs[col], rhs[pivot]);
+        if (mtx[col][col] == host_complex{}) {
+            continue;
+        }
+        for (auto row = col + 1; row < n; ++row) {
+            const auto factor = mtx[row][col] / mtx[col][col];
+            for (auto i = col; i < n; ++i) {
+                mtx[row][i] -= factor * mtx[col][i];
+            }
+            rhs[row] -= factor * rhs[col];
+        }
+    }
+    for (auto row = n; row-- > 0;) {
+        for (auto i = row + 1; i < n; ++i) {
+            rhs[row] -= mtx[row][i] * rhs[i];
+        }
+        if (mtx[row][row] != host_complex{}) {
+            rhs[row] /= mtx[row][row];
+        }
+    }
+    return rhs;
+}
+
+
+/**
+ * Computes the eigenvalues of an upper Hessenberg matrix using the QR
+ * algorithm with Wilkinson shifts and deflation at the bottom.
+ */
+std::vector<host_complex> hessenberg_eigenvalues(host_matrix h)
+{
+    constexpr auto eps = std::numeric_limits<double>::epsilon();
+    std::vector<host_complex> eigenvalues;
+    auto end = h.size();
+    size_type iterations{};
+    while (end > 1) {
+        const auto last = end - 1;
+        const auto subdiag = std::abs(h[last][last - 1]);
+        if (subdiag <= eps * (std::abs(h[last][last]) +
+                              std::abs(h[last - 1][last - 1])) ||
+            iterations > 30 * h.size()) {
+            eigenvalues.push_back(h[last][last]);
+            end = last;
+            iterations = 0;
+            continue;
+        }
+        // eigenvalue of the trailing 2x2 block closest to its last entry,
+        // perturbed occasionally to break cycles
+        const auto a = h[last - 1][last - 1];
+        const auto b = h[last - 1][last];
+        const auto c = h[last][last - 1];
+        const auto d = h[last][last];
+        const auto mid = (a + d) / 2.0;
+        const auto disc = std::sqrt((a - d) * (a - d) / 4.0 + b * c);
+        auto shift = std::abs(mid + disc - d) < std::abs(mid - disc - d)
+                         ? mid + disc
+                         : mid - disc;
+        if (iterations % 11 == 10) {
+            shift += subdiag;
+        }
+        for (size_type i = 0; i < end; ++i) {
+            h[i][i] -= shift;
+        }
+        // H - shift I = QR using Givens rotations, then H = RQ + shift I
+        std::vector<host_complex> rot_c(last);
+        std::vector<host_complex> rot_s(last);
+        for (size_type k = 0; k < last; ++k) {
+            const auto x = h[k][k];
+            const auto y = h[k + 1][k];
+            const auto norm = std::sqrt(std::norm(x) + std::norm(y));
+            rot_c[k] = norm == 0.0 ? host_complex{1.0} : x / norm;
+            rot_s[k] = norm == 0.0 ? host_complex{} : y / norm;
+            for (auto j = k; j < end; ++j) {
+                const auto upper = h[k][j];
+                const auto lower = h[k + 1][j];
+                h[k][j] = std::conj(rot_c[k]) * upper +
+                          std::conj(rot_s[k]) * lower;
+                h[k + 1][j] = -rot_s[k] * upper + rot_c[k] * lower;
+            }
+        }
+        for (size_type k = 0; k < last; ++k) {
+            for (size_type i = 0; i <= std::min(k + 1, last); ++i) {
+                const auto left = h[i][k];
+                const auto right = h[i][k + 1];
+                h[i][k] = left * rot_c[k] + right * rot_s[k];
+                h[i][k + 1] = -left * std::conj(rot_s[k]) +
+                              right * std::conj(rot_c[k]);
+            }
+        }
+        for (size_type i = 0; i < end; ++i) {
+            h[i][i] += shift;
+        }
+        ++iterations;
+    }
+    if (end == 1) {
+        eigenvalues.push_back(h[0][0]);
+    }
+    return eigenvalues;
+}
+
+
+/**
+ * Sorts the roots in modified Leja order: Starting from the root of largest
+ * magnitude, the next root is always the one maximizing the product of its
+ * distances to all previously chosen roots. If `with_conjugates` is set, each
+ * root with non-zero imaginary part also represents its complex conjugate.
+ */
+std::vector<host_complex> leja_order(std::vector<host_complex> roots,
+                                     bool with_conjugates)
+{
+    std::vector<host_complex> result;
+    // the products are accumulated as sums of logarithms to avoid overflow
+    std::vector<double> log_products(roots.size());
+    for (size_type i = 0; i < roots.size(); ++i) {
+        log_products[i] = std::log(std::abs(roots[i]));
+    }
+    while (!roots.empty()) {
+        const auto next =
+            std::max_element(log_products.begin(), log_products.end()) -
+            log_products.begin();
+        const auto root = roots[next];
+        roots.erase(roots.begin() + next);
+        log_products.erase(log_products.begin() + next);
+        for (size_type i = 0; i < roots.size(); ++i) {
+            log_products[i] += std::log(std::abs(roots[i] - root));
+            if (with_conjugates && root.imag() != 0.0) {
+                log_products[i] +=
+                    std::log(std::abs(roots[i] - std::conj(root)));
+            }
+        }
+        result.push_back(root);
+    }
+    return result;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::generate_neumann()
+{
+    const auto exec = this->get_executor();
+    auto diag = gko::clone(
+        exec, as<DiagonalExtractable<ValueType>>(system_matrix_.get())
+                  ->extract_diagonal());
+    exec->run(polynomial::make_invert_diagonal(diag.get()));
+    inverse_diagonal_ = std::move(diag);
+}
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::generate_gmres()
+{
+    using Dense = matrix::Dense<ValueType>;
+    using real_type = remove_complex<ValueType>;
+    const auto exec = this->get_executor();
+    const auto num_rows = system_matrix_->get_size()[0];
+    // GMRES after degree + 1 iterations minimizes the residual over all
+    // polynomials of degree degree
+    const auto krylov_dim =
+        std::min<size_type>(parameters_.degree + 1, num_rows);
+    if (krylov_dim == 0) {
+        return;
+    }
+
+    // Arnoldi process with a fixed pseudo-random starting vector
+    auto host_start = Dense::create(exec->get_master(), dim<2>{num_rows, 1});
+    std::default_random_engine engine{42};
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (size_type row = 0; row < num_rows; ++row) {
+        host_start->at(row, 0) = static_cast<real_type>(distribution(engine));
+    }
+    std::vector<std::unique_ptr<Dense>> basis;
+    basis.push_back(gko::clone(exec, host_start));
+    auto dot = Dense::create(exec, dim<2>{1, 1});
+    auto norm = matrix::Dense<real_type>::create(exec, dim<2>{1, 1});
+    basis[0]->compute_norm2(norm.get());
+    const auto start_norm = exec->copy_val_to_host(norm->get_const_values());
+    basis[0]->scale(
+        initialize<Dense>({one<ValueType>() / start_norm}, exec).get());
+    host_matrix hessenberg(krylov_dim + 1,
+                           std::vector<host_complex>(krylov_dim));
+    size_type steps = 0;
+    while (steps < krylov_dim) {
+        auto w = Dense::create(exec, dim<2>{num_rows, 1});
+        system_matrix_->apply(basis[steps].get(), w.get());
+        double column_norm{};
+        for (size_type i = 0; i <= steps; ++i) {
+            basis[i]->compute_dot(w.get(), dot.get());
+            const auto h = exec->copy_val_to_host(dot->get_const_values());
+            hessenberg[i][steps] = static_cast<host_complex>(h);
+            column_norm += std::norm(hessenberg[i][steps]);
+            w->add_scaled(initialize<Dense>({-h}, exec).get(), basis[i].get());
+        }
+        w->compute_norm2(norm.get());
+        const auto h_next = exec->copy_val_to_host(norm->get_const_values());
+        hessenberg[steps + 1][steps] = h_next;
+        ++steps;
+        // stop at an invariant subspace, the Ritz values are exact then
+        if (h_next <= std::numeric_limits<real_type>::epsilon() *
+                          std::sqrt(column_norm + h_next * h_next)) {
+            hessenberg[steps][steps - 1] = 0.0;
+            break;
+        }
+        if (steps < krylov_dim) {
+            w->scale(
+                initialize<Dense>({one<ValueType>() / h_next}, exec).get());
+            basis.push_back(std::move(w));
+        }
+    }
+
+    // The roots of the GMRES residual polynomial are the harmonic Ritz values,
+    // the eigenvalues of H + |h_{m+1,m}|^2 H^{-H} e_m e_m^T
+    host_matrix h(steps, std::vector<host_complex>(steps));
+    host_matrix h_conj_trans(steps, std::vector<host_complex>(steps));
+    for (size_type row = 0; row < steps; ++row) {
+        for (size_type col = 0; col < steps; ++col) {
+            h[row][col] = hessenberg[row][col];
+            h_conj_trans[col][row] = std::conj(hessenberg[row][col]);
+        }
+    }
+    std::vector<host_complex> e_last(steps);
+    e_last[steps - 1] = 1.0;
+    const auto correction = solve_dense(h_conj_trans, e_last);
+    const auto h_next_sq = std::norm(hessenberg[steps][steps - 1]);
+    for (size_type row = 0; row < steps; ++row) {
+        h[row][steps - 1] += h_next_sq * correction[row];
+    }
+    auto eigenvalues = hessenberg_eigenvalues(std::move(h));
+
+    // For real value types, the roots come in conjugate pairs, of which only
+    // the one with positive imaginary part is kept
+    std::vector<host_complex> roots;
+    const auto tol = std::sqrt(std::numeric_limits<real_type>::epsilon());
+    for (auto eigenvalue : eigenvalues) {
+        if (eigenvalue == host_complex{}) {
+            continue;
+        }
+        if (!is_complex<ValueType>()) {
+            if (std::abs(eigenvalue.imag()) <= tol * std::abs(eigenvalue)) {
+                eigenvalue = eigenvalue.real();
+            } else if (eigenvalue.imag() < 0.0) {
+                continue;
+            }
+        }
+        roots.push_back(eigenvalue);
+    }
+    roots_.clear();
+    for (auto root : leja_order(std::move(roots), !is_complex<ValueType>())) {
+        roots_.emplace_back(static_cast<real_type>(root.real()),
+                            static_cast<real_type>(root.imag()));
+    }
+
+    one_op_ = initialize<Dense>({one<ValueType>()}, exec);
+    root_scalars_.clear();
+    for (auto root : roots_) {
+        if (!is_complex<ValueType>() && root.imag() != 0) {
+            root_scalars_.push_back(initialize<Dense>(
+                {-ValueType{one<real_type>() / squared_norm(root)}}, exec));
+        } else {
+            root_scalars_.push_back(initialize<Dense>(
+                {root_to_value<ValueType>(one<std::complex<real_type>>() /
+                                          root)},
+                exec));
+        }
+    }
+}
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::apply_neumann(const matrix::Dense<ValueType> *b,
+                                          matrix::Dense<ValueType> *x) const
+{
+    const auto exec = this->get_executor();
+    inverse_diagonal_->apply(b, x);
+    if (parameters_.degree == 0) {
+        return;
+    }
+    cache_.allocate(exec, x->get_size());
+    for (size_type k = 0; k < parameters_.degree; ++k) {
+        system_matrix_->apply(x, cache_.ar.get());
+        exec->run(polynomial::make_neumann_step(inverse_diagonal_.get(), b,
+                                                cache_.ar.get(), x));
+    }
+}
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::apply_gmres(const matrix::Dense<ValueType> *b,
+                                        matrix::Dense<ValueType> *x) const
+{
+    const auto exec = this->get_executor();
+    // r = b - A x is updated alongside x, ar holds its product with A
+    cache_.allocate(exec, b->get_size());
+    auto r = cache_.r.get();
+    auto ar = cache_.ar.get();
+    r->copy_from(b);
+    exec->run(polynomial::make_fill_array(
+        x->get_values(), x->get_num_stored_elements(), zero<ValueType>()));
+    for (size_type i = 0; i < roots_.size(); ++i) {
+        const auto root = roots_[i];
+        const auto is_last = i + 1 == roots_.size();
+        if (!is_complex<ValueType>() && root.imag() != 0) {
+            // real quadratic factor (1 - z / root) (1 - z / conj(root))
+            const auto inv_squared_abs = one<remove_complex<ValueType>>() /
+                                         squared_norm(root);
+            system_matrix_->apply(r, ar);
+            exec->run(polynomial::make_pair_step(2 * root.real(),
+                                                 inv_squared_abs, r, ar, x));
+            if (!is_last) {
+                // root_scalars_[i] = -inv_squared_abs
+                system_matrix_->apply(root_scalars_[i].get(), ar,
+                                      one_op_.get(), r);
+            }
+        } else if (is_last) {
+            // root_scalars_[i] = 1 / root
+            x->add_scaled(root_scalars_[i].get(), r);
+        } else {
+            const auto inv_root = root_to_value<ValueType>(
+                one<std::complex<remove_complex<ValueType>>>() / root);
+            system_matrix_->apply(r, ar);
+            exec->run(polynomial::make_root_step(inv_root, r, ar, x));
+        }
+    }
+}
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Dense = matrix::Dense<ValueType>;
+    if (parameters_.type == polynomial_type::neumann) {
+        apply_neumann(as<Dense>(b), as<Dense>(x));
+    } else {
+        apply_gmres(as<Dense>(b), as<Dense>(x));
+    }
+}
+
+
+template <typename ValueType>
+void Polynomial<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                       const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_POLYNOMIAL(ValueType) class Polynomial<ValueType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL);
+
+
+}  // namespace preconditioner
+}  // namespace gko
@@ -0,0 +1,135 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_PRECONDITIONER_POLYNOMIAL_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_POLYNOMIAL_KERNELS_HPP_
+
+
+#include <ginkgo/core/preconditioner/polynomial.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL(ValueType)      \
+    void invert_diagonal(std::shared_ptr<const DefaultExecutor> exec, \
+                         matrix::Diagonal<ValueType> *diag)
+
+#define GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL(ValueType)      \
+    void neumann_step(std::shared_ptr<const DefaultExecutor> exec, \
+                      const matrix::Diagonal<ValueType> *inv_diag, \
+                      const matrix::Dense<ValueType> *b,           \
+                      const matrix::Dense<ValueType> *ax,          \
+                      matrix::Dense<ValueType> *x)
+
+#define GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL(ValueType)          \
+    void root_step(std::shared_ptr<const DefaultExecutor> exec,     \
+                   ValueType inv_root, matrix::Dense<ValueType> *r, \
+                   const matrix::Dense<ValueType> *ar,              \
+                   matrix::Dense<ValueType> *x)
+
+#define GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL(ValueType)      \
+    void pair_step(std::shared_ptr<const DefaultExecutor> exec, \
+                   remove_complex<ValueType> two_real_part,     \
+                   remove_complex<ValueType> inv_squared_abs,   \
+                   const matrix::Dense<ValueType> *r,           \
+                   matrix::Dense<ValueType> *ar,                \
+                   matrix::Dense<ValueType> *x)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                          \
+    template <typename ValueType>                             \
+    GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL(ValueType); \
+    template <typename ValueType>                             \
+    GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL(ValueType);    \
+    template <typename ValueType>                             \
+    GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL(ValueType);       \
+    template <typename ValueType>                             \
+    GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL(ValueType)
+
+
+namespace omp {
+namespace polynomial {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace polynomial
+}  // namespace omp
+
+
+namespace cuda {
+namespace polynomial {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace polynomial
+}  // namespace cuda
+
+
+namespace reference {
+namespace polynomial {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace polynomial
+}  // namespace reference
+
+
+namespace hip {
+namespace polynomial {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace polynomial
+}  // namespace hip
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_POLYNOMIAL_KERNELS_HPP_
@@ -0,0 +1,123 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/schwarz.hpp>
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/preconditioner/schwarz_kernels.hpp"
+
+
+namespace gko {
+namespace preconditioner {
+namespace schwarz {
+
+
+GKO_REGISTER_OPERATION(partition, schwarz::partition);
+GKO_REGISTER_OPERATION(find_subdomains, schwarz::find_subdomains);
+GKO_REGISTER_OPERATION(factorize, schwarz::factorize);
+GKO_REGISTER_OPERATION(apply, schwarz::apply);
+
+
+}  // namespace schwarz
+
+
+template <typename ValueType, typename IndexType>
+void Schwarz<ValueType, IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    const auto exec = this->get_executor();
+    // convert and/or sort the matrix if necessary
+    auto csr_system_matrix = copy_and_convert_to<Csr>(exec, system_matrix);
+    if (!parameters_.skip_sorting) {
+        auto sorted_system_matrix = clone(csr_system_matrix);
+        sorted_system_matrix->sort_by_column_index();
+        csr_system_matrix = std::move(sorted_system_matrix);
+    }
+
+    exec->run(schwarz::make_partition(csr_system_matrix.get(),
+                                      parameters_.num_subdomains,
+                                      block_ptrs_));
+    exec->run(schwarz::make_find_subdomains(csr_system_matrix.get(),
+                                            block_ptrs_, parameters_.overlap,
+                                            subdomain_ptrs_, subdomain_rows_));
+    const auto num_local_rows = subdomain_rows_.get_num_elems();
+    local_factors_ = Csr::create(exec, dim<2>{num_local_rows, num_local_rows});
+    exec->run(schwarz::make_factorize(csr_system_matrix.get(),
+                                      subdomain_ptrs_, subdomain_rows_,
+                                      local_factors_.get()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Schwarz<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Dense = matrix::Dense<ValueType>;
+    this->get_executor()->run(schwarz::make_apply(
+        block_ptrs_, subdomain_ptrs_, subdomain_rows_, local_factors_.get(),
+        as<Dense>(b), as<Dense>(x)));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Schwarz<ValueType, IndexType>::apply_impl(const LinOp *alpha,
+                                               const LinOp *b,
+                                               const LinOp *beta,
+                                               LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_SCHWARZ(ValueType, IndexType) \
+    class Schwarz<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SCHWARZ);
+
+
+}  // namespace preconditioner
+}  // namespace gko
@@ -0,0 +1,138 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_PRECONDITIONER_SCHWARZ_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_SCHWARZ_KERNELS_HPP_
+
+
+#include <ginkgo/core/preconditioner/schwarz.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_SCHWARZ_PARTITION_KERNEL(ValueType, IndexType)         \
+    void partition(std::shared_ptr<const DefaultExecutor> exec,            \
+                   const matrix::Csr<ValueType, IndexType> *system_matrix, \
+                   size_type num_subdomains, Array<IndexType> &block_ptrs)
+
+#define GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL(ValueType, IndexType)    \
+    void find_subdomains(                                                   \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const matrix::Csr<ValueType, IndexType> *system_matrix,             \
+        const Array<IndexType> &block_ptrs, size_type overlap,              \
+        Array<IndexType> &subdomain_ptrs, Array<IndexType> &subdomain_rows)
+
+#define GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL(ValueType, IndexType)         \
+    void factorize(std::shared_ptr<const DefaultExecutor> exec,            \
+                   const matrix::Csr<ValueType, IndexType> *system_matrix, \
+                   const Array<IndexType> &subdomain_ptrs,                 \
+                   const Array<IndexType> &subdomain_rows,                 \
+                   matrix::Csr<ValueType, IndexType> *local_factors)
+
+#define GKO_DECLARE_SCHWARZ_APPLY_KERNEL(ValueType, IndexType)         \
+    void apply(std::shared_ptr<const DefaultExecutor> exec,            \
+               const Array<IndexType> &block_ptrs,                     \
+               const Array<IndexType> &subdomain_ptrs,                 \
+               const Array<IndexType> &subdomain_rows,                 \
+               const matrix::Csr<ValueType, IndexType> *local_factors, \
+               const matrix::Dense<ValueType> *b,                      \
+               matrix::Dense<ValueType> *x)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                  \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_SCHWARZ_PARTITION_KERNEL(ValueType, IndexType);       \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL(ValueType, IndexType);       \
+    template <typename ValueType, typename IndexType>                 \
+    GKO_DECLARE_SCHWARZ_APPLY_KERNEL(ValueType, IndexType)
+
+
+namespace omp {
+namespace schwarz {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace schwarz
+}  // namespace omp
+
+
+namespace cuda {
+namespace schwarz {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace schwarz
+}  // namespace cuda
+
+
+namespace reference {
+namespace schwarz {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace schwarz
+}  // namespace reference
+
+
+namespace hip {
+namespace schwarz {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace schwarz
+}  // namespace hip
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_SCHWARZ_KERNELS_HPP_
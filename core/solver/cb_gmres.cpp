@@ -0,0 +1,311 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/cb_gmres.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+
+
+#include "core/base/extended_float.hpp"
+#include "core/solver/cb_gmres_kernels.hpp"
+#include "core/solver/gmres_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+
+
+namespace cb_gmres {
+
+
+GKO_REGISTER_OPERATION(initialize_1, gmres::initialize_1);
+GKO_REGISTER_OPERATION(initialize_2, cb_gmres::initialize_2);
+GKO_REGISTER_OPERATION(step_1, cb_gmres::step_1);
+GKO_REGISTER_OPERATION(step_2, cb_gmres::step_2);
+
+
+}  // namespace cb_gmres
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> CbGmres<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .with_krylov_dim(this->get_krylov_dim())
+        .with_storage_precision(this->get_storage_precision())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> CbGmres<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .with_krylov_dim(this->get_krylov_dim())
+        .with_storage_precision(this->get_storage_precision())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void CbGmres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    using storage_1 = reduce_precision<ValueType>;
+    using storage_2 = reduce_precision<storage_1>;
+
+    auto dense_b = as<const Vector>(b);
+    auto dense_x = as<Vector>(x);
+    switch (parameters_.storage_precision) {
+    case cb_gmres::storage_precision::keep:
+        this->template apply_dense_impl<ValueType>(dense_b, dense_x);
+        break;
+    case cb_gmres::storage_precision::reduce1:
+        this->template apply_dense_impl<storage_1>(dense_b, dense_x);
+        break;
+    case cb_gmres::storage_precision::reduce2:
+        this->template apply_dense_impl<storage_2>(dense_b, dense_x);
+        break;
+    default:
+        GKO_NOT_SUPPORTED(parameters_.storage_precision);
+    }
+}
+
+
+template <typename ValueType>
+template <typename StorageType>
+void CbGmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType> *b,
+                                          matrix::Dense<ValueType> *x) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+
+    using Vector = matrix::Dense<ValueType>;
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+
+    const auto num_rows = system_matrix_->get_size()[0];
+    const auto num_rhs = b->get_size()[1];
+    auto residual = Vector::create_with_config_of(b);
+    // the Krylov basis is only stored in StorageType, the current basis
+    // vector is kept in ValueType
+    Array<StorageType> krylov_storage(exec,
+                                      num_rows * (krylov_dim_ + 1) * num_rhs);
+    kernels::cb_gmres::krylov_range<ValueType, StorageType> krylov_bases(
+        krylov_storage.get_data(), num_rows * (krylov_dim_ + 1), num_rhs,
+        num_rhs);
+    auto next_krylov_basis = Vector::create_with_config_of(b);
+    std::shared_ptr<matrix::Dense<ValueType>> preconditioned_vector =
+        Vector::create_with_config_of(b);
+    auto hessenberg =
+        Vector::create(exec, dim<2>{krylov_dim_ + 1, krylov_dim_ * num_rhs});
+    auto givens_sin = Vector::create(exec, dim<2>{krylov_dim_, num_rhs});
+    auto givens_cos = Vector::create(exec, dim<2>{krylov_dim_, num_rhs});
+    auto residual_norm_collection =
+        Vector::create(exec, dim<2>{krylov_dim_ + 1, num_rhs});
+    auto residual_norm = NormVector::create(exec, dim<2>{1, num_rhs});
+    Array<size_type> final_iter_nums(this->get_executor(), num_rhs);
+    auto y = Vector::create(exec, dim<2>{krylov_dim_, num_rhs});
+
+    bool one_changed{};
+    Array<stopping_status> stop_status(this->get_executor(), num_rhs);
+
+    // Initialization
+    exec->run(cb_gmres::make_initialize_1(b, residual.get(), givens_sin.get(),
+                                          givens_cos.get(), &stop_status,
+                                          krylov_dim_));
+    // residual = b
+    // givens_sin = givens_cos = 0
+    system_matrix_->apply(neg_one_op.get(), x, one_op.get(), residual.get());
+    // residual = residual - Ax
+    exec->run(cb_gmres::make_initialize_2(
+        residual.get(), residual_norm.get(), residual_norm_collection.get(),
+        krylov_bases, next_krylov_basis.get(), &final_iter_nums,
+        krylov_dim_));
+    // residual_norm = norm(residual)
+    // residual_norm_collection = {residual_norm, unchanged}
+    // next_krylov_basis = residual / residual_norm
+    // krylov_bases(:, 1) = next_krylov_basis
+    // final_iter_nums = {0, ..., 0}
+
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, residual.get());
+
+    int total_iter = -1;
+    size_type restart_iter = 0;
+
+    auto before_preconditioner =
+        matrix::Dense<ValueType>::create_with_config_of(x);
+    auto after_preconditioner =
+        matrix::Dense<ValueType>::create_with_config_of(x);
+
+    while (true) {
+        ++total_iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, total_iter, residual.get(), x, residual_norm.get());
+        if (stop_criterion->update()
+                .num_iterations(total_iter)
+                .residual(residual.get())
+                .residual_norm(residual_norm.get())
+                .solution(x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        if (restart_iter == krylov_dim_) {
+            // Restart
+            exec->run(cb_gmres::make_step_2(
+                residual_norm_collection.get(), krylov_bases, hessenberg.get(),
+                y.get(), before_preconditioner.get(), &final_iter_nums));
+            // Solve upper triangular.
+            // y = hessenberg \ residual_norm_collection
+            // before_preconditioner = krylov_bases * y
+
+            get_preconditioner()->apply(before_preconditioner.get(),
+                                        after_preconditioner.get());
+            x->add_scaled(one_op.get(), after_preconditioner.get());
+            // Solve x
+            // x = x + get_preconditioner() * before_preconditioner
+            residual->copy_from(b);
+            // residual = b
+            system_matrix_->apply(neg_one_op.get(), x, one_op.get(),
+                                  residual.get());
+            // residual = residual - Ax
+            exec->run(cb_gmres::make_initialize_2(
+                residual.get(), residual_norm.get(),
+                residual_norm_collection.get(), krylov_bases,
+                next_krylov_basis.get(), &final_iter_nums, krylov_dim_));
+            // residual_norm = norm(residual)
+            // residual_norm_collection = {residual_norm, unchanged}
+            // next_krylov_basis = residual / residual_norm
+            // krylov_bases(:, 1) = next_krylov_basis
+            // final_iter_nums = {0, ..., 0}
+            restart_iter = 0;
+        }
+        get_preconditioner()->apply(next_krylov_basis.get(),
+                                    preconditioned_vector.get());
+        // preconditioned_vector = get_preconditioner() * next_krylov_basis
+
+        // Do Arnoldi and givens rotation
+        auto hessenberg_iter = hessenberg->create_submatrix(
+            span{0, restart_iter + 2},
+            span{num_rhs * restart_iter, num_rhs * (restart_iter + 1)});
+
+        // Start of arnoldi
+        system_matrix_->apply(preconditioned_vector.get(),
+                              next_krylov_basis.get());
+        // next_krylov_basis = A * preconditioned_vector
+
+        exec->run(cb_gmres::make_step_1(
+            next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+            residual_norm.get(), residual_norm_collection.get(), krylov_bases,
+            hessenberg_iter.get(), restart_iter, &final_iter_nums,
+            &stop_status));
+        // final_iter_nums += 1 (unconverged)
+        // for i in 0:restart_iter(include)
+        //     hessenberg(restart_iter, i) = next_krylov_basis' *
+        //         krylov_bases(:, i)
+        //     next_krylov_basis  -= hessenberg(restart_iter, i) *
+        //         krylov_bases(:, i)
+        // end
+        // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov_basis)
+        // next_krylov_basis /= hessenberg(restart_iter + 1, restart_iter)
+        // krylov_bases(:, restart_iter + 1) = next_krylov_basis
+        // End of arnoldi
+        // Apply the givens rotations to the new hessenberg column and
+        // calculate the new residual norm, see Gmres
+
+        restart_iter++;
+    }
+
+    // Solve x
+    auto hessenberg_small = hessenberg->create_submatrix(
+        span{0, restart_iter}, span{0, num_rhs * restart_iter});
+
+    exec->run(cb_gmres::make_step_2(
+        residual_norm_collection.get(), krylov_bases, hessenberg_small.get(),
+        y.get(), before_preconditioner.get(), &final_iter_nums));
+    // Solve upper triangular.
+    // y = hessenberg \ residual_norm_collection
+    // before_preconditioner = krylov_bases * y
+    get_preconditioner()->apply(before_preconditioner.get(),
+                                after_preconditioner.get());
+    x->add_scaled(one_op.get(), after_preconditioner.get());
+    // Solve x
+    // x = x + get_preconditioner() * before_preconditioner
+}
+
+
+template <typename ValueType>
+void CbGmres<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                    const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_CB_GMRES(_type) class CbGmres<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CB_GMRES);
+
+
+}  // namespace solver
+}  // namespace gko
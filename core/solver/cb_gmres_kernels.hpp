@@ -0,0 +1,182 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_SOLVER_CB_GMRES_KERNELS_HPP_
+#define GKO_CORE_SOLVER_CB_GMRES_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/range.hpp>
+#include <ginkgo/core/base/range_accessors.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+
+#include "core/base/extended_float.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace cb_gmres {
+
+
+/**
+ * Instantiates a template for each value type and each of its supported
+ * Krylov basis storage types (the value type itself and the one or two
+ * next lower precisions).
+ *
+ * @param _macro  A macro which expands the template instantiation
+ *                (not including the leading `template` specifier).
+ *                Should take two arguments, the value type and the storage
+ *                type.
+ */
+#define GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(_macro)               \
+    template _macro(double, double);                                 \
+    template _macro(double, float);                                  \
+    template _macro(double, half);                                   \
+    template _macro(float, float);                                   \
+    template _macro(float, half);                                    \
+    template _macro(std::complex<double>, std::complex<double>);     \
+    template _macro(std::complex<double>, std::complex<float>);      \
+    template _macro(std::complex<double>, std::complex<half>);       \
+    template _macro(std::complex<float>, std::complex<float>);       \
+    template _macro(std::complex<float>, std::complex<half>)
+
+
+/**
+ * The type of the range used to access the Krylov basis.
+ */
+template <typename ValueType, typename StorageType>
+using krylov_range =
+    range<accessor::reduced_row_major<2, ValueType, StorageType>>;
+
+
+#define GKO_DECLARE_CB_GMRES_INITIALIZE_2_KERNEL(_type, _storage_type)   \
+    void initialize_2(                                                   \
+        std::shared_ptr<const DefaultExecutor> exec,                     \
+        const matrix::Dense<_type> *residual,                            \
+        matrix::Dense<remove_complex<_type>> *residual_norm,             \
+        matrix::Dense<_type> *residual_norm_collection,                  \
+        krylov_range<_type, _storage_type> krylov_bases,                 \
+        matrix::Dense<_type> *next_krylov_basis,                         \
+        Array<size_type> *final_iter_nums, size_type krylov_dim)
+
+
+#define GKO_DECLARE_CB_GMRES_STEP_1_KERNEL(_type, _storage_type)          \
+    void step_1(std::shared_ptr<const DefaultExecutor> exec,              \
+                matrix::Dense<_type> *next_krylov_basis,                  \
+                matrix::Dense<_type> *givens_sin,                         \
+                matrix::Dense<_type> *givens_cos,                         \
+                matrix::Dense<remove_complex<_type>> *residual_norm,      \
+                matrix::Dense<_type> *residual_norm_collection,           \
+                krylov_range<_type, _storage_type> krylov_bases,          \
+                matrix::Dense<_type> *hessenberg_iter, size_type iter,    \
+                Array<size_type> *final_iter_nums,                        \
+                const Array<stopping_status> *stop_status)
+
+
+#define GKO_DECLARE_CB_GMRES_STEP_2_KERNEL(_type, _storage_type)      \
+    void step_2(std::shared_ptr<const DefaultExecutor> exec,          \
+                const matrix::Dense<_type> *residual_norm_collection, \
+                krylov_range<_type, _storage_type> krylov_bases,      \
+                const matrix::Dense<_type> *hessenberg,               \
+                matrix::Dense<_type> *y,                              \
+                matrix::Dense<_type> *before_preconditioner,          \
+                const Array<size_type> *final_iter_nums)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                   \
+    template <typename ValueType, typename StorageType>                \
+    GKO_DECLARE_CB_GMRES_INITIALIZE_2_KERNEL(ValueType, StorageType);  \
+    template <typename ValueType, typename StorageType>                \
+    GKO_DECLARE_CB_GMRES_STEP_1_KERNEL(ValueType, StorageType);        \
+    template <typename ValueType, typename StorageType>                \
+    GKO_DECLARE_CB_GMRES_STEP_2_KERNEL(ValueType, StorageType)
+
+
+}  // namespace cb_gmres
+
+
+namespace omp {
+namespace cb_gmres {
+
+using kernels::cb_gmres::krylov_range;
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace cb_gmres
+}  // namespace omp
+
+
+namespace cuda {
+namespace cb_gmres {
+
+using kernels::cb_gmres::krylov_range;
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace cb_gmres
+}  // namespace cuda
+
+
+namespace reference {
+namespace cb_gmres {
+
+using kernels::cb_gmres::krylov_range;
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace cb_gmres
+}  // namespace reference
+
+
+namespace hip {
+namespace cb_gmres {
+
+using kernels::cb_gmres::krylov_range;
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace cb_gmres
+}  // namespace hip
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_CB_GMRES_KERNELS_HPP_
@@ -39,6 +39,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
 
 
 #include "core/solver/cg_kernels.hpp"
@@ -126,6 +127,10 @@ void Cg<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
     auto stop_criterion = stop_criterion_factory_->generate(
         system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
         x, r.get());
+    // without preconditioner, rho = r^H r is the squared residual norm
+    const bool use_implicit_norm =
+        dynamic_cast<const matrix::Identity<ValueType> *>(
+            get_preconditioner().get()) != nullptr;
 
     int iter = -1;
     while (true) {
@@ -138,6 +143,8 @@ void Cg<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
         if (stop_criterion->update()
                 .num_iterations(iter)
                 .residual(r.get())
+                .implicit_sq_residual_norm(use_implicit_norm ? rho.get()
+                                                             : nullptr)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
             break;
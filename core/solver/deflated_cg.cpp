@@ -0,0 +1,592 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/deflated_cg.hpp>
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/solver/cg_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+
+
+namespace deflated_cg {
+
+
+GKO_REGISTER_OPERATION(initialize, cg::initialize);
+GKO_REGISTER_OPERATION(step_1, cg::step_1);
+GKO_REGISTER_OPERATION(step_2, cg::step_2);
+
+
+}  // namespace deflated_cg
+
+
+namespace {
+
+
+/**
+ * Computes the Cholesky factor L of the Hermitian n x n row-major matrix `a`
+ * in-place. Only the lower triangle of `a` is referenced and overwritten.
+ *
+ * @return false if `a` is not (numerically) positive definite
+ */
+template <typename ValueType>
+bool cholesky(size_type n, std::vector<ValueType> &a)
+{
+    using real_type = remove_complex<ValueType>;
+    real_type max_diag{};
+    for (size_type i = 0; i < n; ++i) {
+        max_diag = std::max(max_diag, real(a[i * n + i]));
+    }
+    const auto threshold =
+        max_diag * n * std::numeric_limits<real_type>::epsilon();
+    for (size_type j = 0; j < n; ++j) {
+        auto diag = real(a[j * n + j]);
+        for (size_type k = 0; k < j; ++k) {
+            diag -= squared_norm(a[j * n + k]);
+        }
+        if (!(diag > threshold)) {
+            return false;
+        }
+        const auto diag_sqrt = std::sqrt(diag);
+        a[j * n + j] = diag_sqrt;
+        for (size_type i = j + 1; i < n; ++i) {
+            auto sum = a[i * n + j];
+            for (size_type k = 0; k < j; ++k) {
+                sum -= a[i * n + k] * conj(a[j * n + k]);
+            }
+            a[i * n + j] = sum / diag_sqrt;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * Solves L x = b in-place for the lower triangular Cholesky factor L.
+ */
+template <typename ValueType>
+void lower_solve(size_type n, const std::vector<ValueType> &l, ValueType *x)
+{
+    for (size_type i = 0; i < n; ++i) {
+        auto sum = x[i];
+        for (size_type k = 0; k < i; ++k) {
+            sum -= l[i * n + k] * x[k];
+        }
+        x[i] = sum / l[i * n + i];
+    }
+}
+
+
+/**
+ * Solves L^H x = b in-place for the lower triangular Cholesky factor L.
+ */
+template <typename ValueType>
+void lower_conj_trans_solve(size_type n, const std::vector<ValueType> &l,
+                            ValueType *x)
+{
+    for (auto i = n; i-- > 0;) {
+        auto sum = x[i];
+        for (auto k = i + 1; k < n; ++k) {
+            sum -= conj(l[k * n + i]) * x[k];
+        }
+        x[i] = sum / l[i * n + i];
+    }
+}
+
+
+/**
+ * Computes the eigenvalues and eigenvectors of the Hermitian n x n row-major
+ * matrix `a` using the cyclic Jacobi method. On return, the diagonal of `a`
+ * contains the eigenvalues and the columns of `v` the eigenvectors.
+ */
+template <typename ValueType>
+void hermitian_eigensolve(size_type n, std::vector<ValueType> &a,
+                          std::vector<ValueType> &v)
+{
+    using real_type = remove_complex<ValueType>;
+    constexpr int max_sweeps{50};
+    v.assign(n * n, zero<ValueType>());
+    real_type norm{};
+    for (size_type i = 0; i < n; ++i) {
+        v[i * n + i] = one<ValueType>();
+        for (size_type j = 0; j < n; ++j) {
+            norm += squared_norm(a[i * n + j]);
+        }
+    }
+    const auto threshold = norm * std::numeric_limits<real_type>::epsilon() *
+                           std::numeric_limits<real_type>::epsilon();
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        real_type off_norm{};
+        for (size_type i = 0; i < n; ++i) {
+            for (size_type j = 0; j < n; ++j) {
+                off_norm += i == j ? real_type{} : squared_norm(a[i * n + j]);
+            }
+        }
+        if (off_norm <= threshold) {
+            break;
+        }
+        for (size_type p = 0; p < n; ++p) {
+            for (auto q = p + 1; q < n; ++q) {
+                const auto a_pq_abs = std::abs(a[p * n + q]);
+                if (a_pq_abs == real_type{}) {
+                    continue;
+                }
+                // scale row and column q by a phase to make a_pq real
+                const auto phase = conj(a[p * n + q]) / a_pq_abs;
+                for (size_type k = 0; k < n; ++k) {
+                    a[k * n + q] *= phase;
+                    v[k * n + q] *= phase;
+                }
+                for (size_type k = 0; k < n; ++k) {
+                    a[q * n + k] *= conj(phase);
+                }
+                // annihilate the (now real) entry with a Jacobi rotation
+                const auto theta =
+                    (real(a[q * n + q]) - real(a[p * n + p])) / (2 * a_pq_abs);
+                const auto t =
+                    (theta >= real_type{} ? one<real_type>()
+                                          : -one<real_type>()) /
+                    (std::abs(theta) + std::sqrt(theta * theta + 1));
+                const auto c = one<real_type>() / std::sqrt(t * t + 1);
+                const auto s = t * c;
+                for (size_type k = 0; k < n; ++k) {
+                    const auto a_kp = a[k * n + p];
+                    const auto a_kq = a[k * n + q];
+                    a[k * n + p] = c * a_kp - s * a_kq;
+                    a[k * n + q] = s * a_kp + c * a_kq;
+                    const auto v_kp = v[k * n + p];
+                    const auto v_kq = v[k * n + q];
+                    v[k * n + p] = c * v_kp - s * v_kq;
+                    v[k * n + q] = s * v_kp + c * v_kq;
+                }
+                for (size_type k = 0; k < n; ++k) {
+                    const auto a_pk = a[p * n + k];
+                    const auto a_qk = a[q * n + k];
+                    a[p * n + k] = c * a_pk - s * a_qk;
+                    a[q * n + k] = s * a_pk + c * a_qk;
+                }
+                a[p * n + q] = zero<ValueType>();
+                a[q * n + p] = zero<ValueType>();
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> DeflatedCg<ValueType>::transpose() const
+{
+    using Vector = matrix::Dense<ValueType>;
+    auto transposed_precond =
+        share(as<Transposable>(this->get_preconditioner())->transpose());
+    auto transposed_mtx =
+        share(as<Transposable>(this->get_system_matrix())->transpose());
+    auto solver = build()
+                      .with_generated_preconditioner(transposed_precond)
+                      .with_criteria(this->stop_criterion_factory_)
+                      .with_deflation_dim(parameters_.deflation_dim)
+                      .with_krylov_dim(parameters_.krylov_dim)
+                      .on(this->get_executor())
+                      ->generate(transposed_mtx);
+    // the eigenvectors of A^T = conj(A) are the conjugated eigenvectors of A
+    if (auto deflation = std::atomic_load(&deflation_)) {
+        as<DeflatedCg>(solver.get())
+            ->set_deflation_space(
+                share(as<Vector>(deflation->space_h->transpose())));
+    }
+    return solver;
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> DeflatedCg<ValueType>::conj_transpose() const
+{
+    auto transposed_precond =
+        share(as<Transposable>(this->get_preconditioner())->conj_transpose());
+    auto transposed_mtx =
+        share(as<Transposable>(this->get_system_matrix())->conj_transpose());
+    auto solver = build()
+                      .with_generated_preconditioner(transposed_precond)
+                      .with_criteria(this->stop_criterion_factory_)
+                      .with_deflation_dim(parameters_.deflation_dim)
+                      .with_krylov_dim(parameters_.krylov_dim)
+                      .on(this->get_executor())
+                      ->generate(transposed_mtx);
+    // A^H = A, so the deflation space carries over unchanged
+    if (auto deflation = std::atomic_load(&deflation_)) {
+        as<DeflatedCg>(solver.get())->set_deflation_space(deflation->space);
+    }
+    return solver;
+}
+
+
+template <typename ValueType>
+void DeflatedCg<ValueType>::set_deflation_space(
+    std::shared_ptr<const matrix::Dense<ValueType>> space)
+{
+    using Vector = matrix::Dense<ValueType>;
+    std::shared_ptr<const deflation_data> deflation{};
+    if (space && space->get_size()[1] > 0) {
+        GKO_ASSERT_EQUAL_ROWS(system_matrix_, space);
+        auto exec = this->get_executor();
+        auto dense_space = make_temporary_clone(exec, space.get());
+        auto a_space = Vector::create(exec, dense_space->get_size());
+        system_matrix_->apply(dense_space.get(), a_space.get());
+        auto basis = as<Vector>(dense_space->transpose());
+        auto a_basis = as<Vector>(a_space->transpose());
+        deflation = compute_deflation_space(basis.get(), a_basis.get(),
+                                            basis->get_size()[0]);
+    }
+    std::atomic_store(&deflation_, deflation);
+}
+
+
+template <typename ValueType>
+std::shared_ptr<const typename DeflatedCg<ValueType>::deflation_data>
+DeflatedCg<ValueType>::compute_deflation_space(
+    const matrix::Dense<ValueType> *basis,
+    const matrix::Dense<ValueType> *a_basis, size_type num_vectors) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    const remove_complex<ValueType> half{0.5};
+    auto exec = this->get_executor();
+    auto master = exec->get_master();
+    const auto n = basis->get_size()[1];
+    const auto s = num_vectors;
+    auto host_basis = make_temporary_clone(master, basis);
+    auto host_a_basis = make_temporary_clone(master, a_basis);
+    const auto z = [&](size_type i, size_type l) {
+        return host_basis->at(i, l);
+    };
+    const auto az = [&](size_type i, size_type l) {
+        return host_a_basis->at(i, l);
+    };
+
+    // F = Z^H A Z and G = (A Z)^H A Z
+    std::vector<ValueType> f(s * s);
+    std::vector<ValueType> g(s * s);
+    for (size_type i = 0; i < s; ++i) {
+        for (size_type j = 0; j < s; ++j) {
+            auto f_sum = zero<ValueType>();
+            auto g_sum = zero<ValueType>();
+            for (size_type l = 0; l < n; ++l) {
+                f_sum += conj(z(i, l)) * az(j, l);
+                g_sum += conj(az(i, l)) * az(j, l);
+            }
+            f[i * s + j] = f_sum;
+            g[i * s + j] = g_sum;
+        }
+    }
+    for (size_type i = 0; i < s; ++i) {
+        for (size_type j = 0; j < i; ++j) {
+            f[i * s + j] = (f[i * s + j] + conj(f[j * s + i])) * half;
+        }
+    }
+    // scale the basis vectors to unit A-norm to improve the conditioning
+    std::vector<remove_complex<ValueType>> scale(s);
+    for (size_type i = 0; i < s; ++i) {
+        scale[i] = std::sqrt(real(f[i * s + i]));
+        if (!(scale[i] > zero(scale[i]))) {
+            return nullptr;
+        }
+    }
+    for (size_type i = 0; i < s; ++i) {
+        for (size_type j = 0; j < s; ++j) {
+            f[i * s + j] /= scale[i] * scale[j];
+            g[i * s + j] /= scale[i] * scale[j];
+        }
+    }
+    if (!cholesky(s, f)) {
+        return nullptr;
+    }
+
+    // the harmonic Ritz pairs solve G y = theta F y, reduce them to the
+    // Hermitian problem C v = theta v with C = L^-1 G L^-H and y = L^-H v
+    std::vector<ValueType> c(s * s);
+    std::vector<ValueType> col(s);
+    for (size_type j = 0; j < s; ++j) {
+        for (size_type i = 0; i < s; ++i) {
+            col[i] = g[i * s + j];
+        }
+        lower_solve(s, f, col.data());
+        // store (L^-1 G)^H
+        for (size_type i = 0; i < s; ++i) {
+            c[j * s + i] = conj(col[i]);
+        }
+    }
+    for (size_type j = 0; j < s; ++j) {
+        for (size_type i = 0; i < s; ++i) {
+            col[i] = c[i * s + j];
+        }
+        lower_solve(s, f, col.data());
+        for (size_type i = 0; i < s; ++i) {
+            g[i * s + j] = col[i];
+        }
+    }
+    for (size_type i = 0; i < s; ++i) {
+        for (size_type j = 0; j <= i; ++j) {
+            c[i * s + j] = (g[i * s + j] + conj(g[j * s + i])) * half;
+            c[j * s + i] = conj(c[i * s + j]);
+        }
+    }
+    std::vector<ValueType> v;
+    hermitian_eigensolve(s, c, v);
+    std::vector<size_type> order(s);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_type a, size_type b) {
+                         return real(c[a * s + a]) < real(c[b * s + b]);
+                     });
+
+    const auto k = std::min(parameters_.deflation_dim, s);
+    std::vector<ValueType> y(s * k);
+    for (size_type j = 0; j < k; ++j) {
+        for (size_type i = 0; i < s; ++i) {
+            col[i] = v[i * s + order[j]];
+        }
+        lower_conj_trans_solve(s, f, col.data());
+        for (size_type i = 0; i < s; ++i) {
+            y[i * k + j] = col[i] / scale[i];
+        }
+    }
+    // W = Z^T Y is A-orthonormal by construction
+    auto host_space = Vector::create(master, dim<2>{n, k});
+    auto host_a_space = Vector::create(master, dim<2>{n, k});
+    for (size_type l = 0; l < n; ++l) {
+        for (size_type j = 0; j < k; ++j) {
+            auto w_sum = zero<ValueType>();
+            auto aw_sum = zero<ValueType>();
+            for (size_type i = 0; i < s; ++i) {
+                w_sum += z(i, l) * y[i * k + j];
+                aw_sum += az(i, l) * y[i * k + j];
+            }
+            host_space->at(l, j) = w_sum;
+            host_a_space->at(l, j) = aw_sum;
+        }
+    }
+    auto space = Vector::create(exec);
+    auto a_space = Vector::create(exec);
+    space->copy_from(host_space.get());
+    a_space->copy_from(host_a_space.get());
+    auto deflation = std::make_shared<deflation_data>();
+    deflation->space_h = share(as<Vector>(space->conj_transpose()));
+    deflation->a_space_h = share(as<Vector>(a_space->conj_transpose()));
+    deflation->space = share(std::move(space));
+    deflation->a_space = share(std::move(a_space));
+    return deflation;
+}
+
+
+template <typename ValueType>
+void DeflatedCg<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using std::swap;
+    using Vector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    // use the same deflation space throughout, even if another apply running
+    // concurrently replaces it
+    const auto deflation = std::atomic_load(&deflation_);
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+
+    auto dense_b = as<const Vector>(b);
+    auto dense_x = as<Vector>(x);
+    auto r = Vector::create_with_config_of(dense_b);
+    auto z = Vector::create_with_config_of(dense_b);
+    auto p = Vector::create_with_config_of(dense_b);
+    auto q = Vector::create_with_config_of(dense_b);
+
+    auto alpha = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
+    auto beta = Vector::create_with_config_of(alpha.get());
+    auto prev_rho = Vector::create_with_config_of(alpha.get());
+    auto rho = Vector::create_with_config_of(alpha.get());
+
+    bool one_changed{};
+    Array<stopping_status> stop_status(alpha->get_executor(),
+                                       dense_b->get_size()[1]);
+
+    // the search directions are only collected for a single right-hand side
+    const auto num_rows = dense_b->get_size()[0];
+    const auto collect_dim = dense_b->get_size()[1] == 1 &&
+                                     p->get_stride() == 1 &&
+                                     q->get_stride() == 1
+                                 ? parameters_.krylov_dim
+                                 : size_type{};
+    auto directions = Vector::create(exec, dim<2>{collect_dim, num_rows});
+    auto a_directions = Vector::create(exec, dim<2>{collect_dim, num_rows});
+    size_type num_collected{};
+    std::unique_ptr<Vector> mu;
+    if (deflation) {
+        mu = Vector::create(exec, dim<2>{deflation->space->get_size()[1],
+                                         dense_b->get_size()[1]});
+    }
+
+    // TODO: replace this with automatic merged kernel generator
+    exec->run(deflated_cg::make_initialize(dense_b, r.get(), z.get(), p.get(),
+                                           q.get(), prev_rho.get(), rho.get(),
+                                           &stop_status));
+    // r = dense_b
+    // rho = 0.0
+    // prev_rho = 1.0
+    // z = p = q = 0
+
+    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(), r.get());
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, r.get());
+
+    if (deflation) {
+        deflation->space_h->apply(r.get(), mu.get());
+        deflation->space->apply(one_op.get(), mu.get(), one_op.get(), dense_x);
+        deflation->a_space->apply(neg_one_op.get(), mu.get(), one_op.get(),
+                                  r.get());
+        // mu = W^H * r
+        // x = x + W * mu
+        // r = r - A * W * mu
+    }
+
+    int iter = -1;
+    while (true) {
+        get_preconditioner()->apply(r.get(), z.get());
+        r->compute_dot(z.get(), rho.get());
+
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(this, iter, r.get(),
+                                                            dense_x);
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        exec->run(deflated_cg::make_step_1(p.get(), z.get(), rho.get(),
+                                           prev_rho.get(), &stop_status));
+        // tmp = rho / prev_rho
+        // p = z + tmp * p
+        if (deflation) {
+            deflation->a_space_h->apply(p.get(), mu.get());
+            deflation->space->apply(neg_one_op.get(), mu.get(), one_op.get(),
+                                    p.get());
+            // mu = (A * W)^H * p
+            // p = p - W * mu
+        }
+        system_matrix_->apply(p.get(), q.get());
+        if (num_collected < collect_dim) {
+            exec->copy(num_rows, p->get_const_values(),
+                       directions->get_values() + num_collected * num_rows);
+            exec->copy(num_rows, q->get_const_values(),
+                       a_directions->get_values() + num_collected * num_rows);
+            ++num_collected;
+        }
+        p->compute_dot(q.get(), beta.get());
+        exec->run(deflated_cg::make_step_2(dense_x, r.get(), p.get(), q.get(),
+                                           beta.get(), rho.get(),
+                                           &stop_status));
+        // tmp = rho / beta
+        // x = x + tmp * p
+        // r = r - tmp * q
+        swap(prev_rho, rho);
+    }
+
+    if (num_collected > 0) {
+        // Z = [W, P], stored with one vector per row
+        const auto num_old =
+            deflation ? deflation->space->get_size()[1] : size_type{};
+        const auto num_vectors = num_old + num_collected;
+        auto basis = Vector::create(exec, dim<2>{num_vectors, num_rows});
+        auto a_basis = Vector::create(exec, dim<2>{num_vectors, num_rows});
+        if (num_old > 0) {
+            auto old_basis = as<Vector>(deflation->space->transpose());
+            auto old_a_basis = as<Vector>(deflation->a_space->transpose());
+            exec->copy(num_old * num_rows, old_basis->get_const_values(),
+                       basis->get_values());
+            exec->copy(num_old * num_rows, old_a_basis->get_const_values(),
+                       a_basis->get_values());
+        }
+        exec->copy(num_collected * num_rows, directions->get_const_values(),
+                   basis->get_values() + num_old * num_rows);
+        exec->copy(num_collected * num_rows, a_directions->get_const_values(),
+                   a_basis->get_values() + num_old * num_rows);
+        auto new_deflation =
+            compute_deflation_space(basis.get(), a_basis.get(), num_vectors);
+        if (new_deflation) {
+            std::atomic_store(&deflation_, new_deflation);
+        }
+    }
+}
+
+
+template <typename ValueType>
+void DeflatedCg<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                       const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_DEFLATED_CG(_type) class DeflatedCg<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DEFLATED_CG);
+
+
+}  // namespace solver
+}  // namespace gko
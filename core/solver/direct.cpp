@@ -0,0 +1,107 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/direct.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> Direct<ValueType, IndexType>::transpose() const
+{
+    std::unique_ptr<transposed_type> transposed{
+        new transposed_type{this->get_executor()}};
+    transposed->set_size(gko::transpose(this->get_size()));
+    transposed->parameters_ = this->parameters_;
+    transposed->l_solver_ =
+        share(as<l_solver_type>(this->get_u_solver()->transpose()));
+    transposed->u_solver_ =
+        share(as<u_solver_type>(this->get_l_solver()->transpose()));
+    return std::move(transposed);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> Direct<ValueType, IndexType>::conj_transpose() const
+{
+    std::unique_ptr<transposed_type> transposed{
+        new transposed_type{this->get_executor()}};
+    transposed->set_size(gko::transpose(this->get_size()));
+    transposed->parameters_ = this->parameters_;
+    transposed->l_solver_ =
+        share(as<l_solver_type>(this->get_u_solver()->conj_transpose()));
+    transposed->u_solver_ =
+        share(as<u_solver_type>(this->get_l_solver()->conj_transpose()));
+    return std::move(transposed);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    auto dense_b = as<Vector>(b);
+    auto intermediate = Vector::create_with_config_of(dense_b);
+    l_solver_->apply(dense_b, intermediate.get());
+    u_solver_->apply(intermediate.get(), x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::apply_impl(const LinOp *alpha,
+                                              const LinOp *b,
+                                              const LinOp *beta,
+                                              LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    auto dense_b = as<Vector>(b);
+    auto intermediate = Vector::create_with_config_of(dense_b);
+    l_solver_->apply(dense_b, intermediate.get());
+    u_solver_->apply(alpha, intermediate.get(), beta, x);
+}
+
+
+#define GKO_DECLARE_DIRECT(_vtype, _itype) class Direct<_vtype, _itype>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DIRECT);
+
+
+}  // namespace solver
+}  // namespace gko
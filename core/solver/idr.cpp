@@ -0,0 +1,260 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/idr.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/components/fill_array.hpp"
+#include "core/solver/idr_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace idr {
+
+
+GKO_REGISTER_OPERATION(initialize, idr::initialize);
+GKO_REGISTER_OPERATION(step_1, idr::step_1);
+GKO_REGISTER_OPERATION(step_2, idr::step_2);
+GKO_REGISTER_OPERATION(step_3, idr::step_3);
+GKO_REGISTER_OPERATION(compute_omega, idr::compute_omega);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+
+
+}  // namespace idr
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Idr<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .with_subspace_dim(this->get_subspace_dim())
+        .with_kappa(this->get_kappa())
+        .with_deterministic(this->get_deterministic())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Idr<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .with_subspace_dim(this->get_subspace_dim())
+        .with_kappa(this->get_kappa())
+        .with_deterministic(this->get_deterministic())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void Idr<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+
+    auto exec = this->get_executor();
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+
+    auto dense_b = as<Vector>(b);
+    auto dense_x = as<Vector>(x);
+    const auto subspace_dim = parameters_.subspace_dim;
+    const auto problem_size = system_matrix_->get_size()[0];
+    const auto nrhs = dense_b->get_size()[1];
+
+    auto residual = Vector::create_with_config_of(dense_b);
+    auto v = Vector::create_with_config_of(dense_b);
+    auto t = Vector::create_with_config_of(dense_b);
+    auto helper = Vector::create_with_config_of(dense_b);
+
+    // the s vectors of the right-hand side i are stored in the columns
+    // i, i + nrhs, ..., i + (s - 1) * nrhs
+    auto m = Vector::create(exec, dim<2>{subspace_dim, subspace_dim * nrhs});
+    auto g = Vector::create(exec, dim<2>{problem_size, subspace_dim * nrhs});
+    auto u = Vector::create(exec, dim<2>{problem_size, subspace_dim * nrhs});
+    auto f = Vector::create(exec, dim<2>{subspace_dim, nrhs});
+    auto c = Vector::create(exec, dim<2>{subspace_dim, nrhs});
+
+    auto omega = Vector::create(exec, dim<2>{1, nrhs});
+    auto tht = Vector::create(exec, dim<2>{1, nrhs});
+    auto alpha = Vector::create(exec, dim<2>{1, nrhs});
+    auto residual_norm = NormVector::create(exec, dim<2>{1, nrhs});
+
+    // contains the conjugated shadow space vectors as rows, i.e. P^H
+    auto subspace_vectors =
+        Vector::create(exec, dim<2>{subspace_dim, problem_size});
+
+    bool one_changed{};
+    Array<stopping_status> stop_status(exec, nrhs);
+
+    exec->run(idr::make_initialize(nrhs, m.get(), subspace_vectors.get(),
+                                   parameters_.deterministic, &stop_status));
+    // m = identity
+    // subspace_vectors = orthonormalized random vectors
+    // stop_status = 0x00
+    exec->run(idr::make_fill_array(omega->get_values(), nrhs,
+                                   one<ValueType>()));
+    exec->run(idr::make_fill_array(g->get_values(),
+                                   problem_size * g->get_stride(),
+                                   zero<ValueType>()));
+    exec->run(idr::make_fill_array(u->get_values(),
+                                   problem_size * u->get_stride(),
+                                   zero<ValueType>()));
+    // omega = 1
+    // g = u = 0
+
+    residual->copy_from(dense_b);
+    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(),
+                          residual.get());
+    // residual = b - A * x
+
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, residual.get());
+
+    int iter = -1;
+    while (true) {
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, iter, residual.get(), dense_x);
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(residual.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        subspace_vectors->apply(residual.get(), f.get());
+        // f = P^H * residual
+
+        for (size_type k = 0; k < subspace_dim; ++k) {
+            exec->run(idr::make_step_1(nrhs, k, m.get(), f.get(),
+                                       residual.get(), g.get(), c.get(),
+                                       v.get(), &stop_status));
+            // c = M(k:s, k:s) \ f(k:s)
+            // v = residual - sum i=[k,s) of (c_i * g_i)
+
+            get_preconditioner()->apply(v.get(), helper.get());
+
+            exec->run(idr::make_step_2(nrhs, k, omega.get(), helper.get(),
+                                       c.get(), u.get(), &stop_status));
+            // u_k = omega * helper + sum i=[k,s) of (c_i * u_i)
+
+            auto u_k = u->create_submatrix(span{0, problem_size},
+                                           span{k * nrhs, (k + 1) * nrhs});
+            system_matrix_->apply(u_k.get(), helper.get());
+            // helper = A * u_k
+
+            exec->run(idr::make_step_3(nrhs, k, subspace_vectors.get(),
+                                       g.get(), helper.get(), u.get(),
+                                       m.get(), f.get(), alpha.get(),
+                                       residual.get(), dense_x,
+                                       &stop_status));
+            // for i = [0,k)
+            //     alpha = p_i^H * g_k / m_i,i
+            //     g_k -= alpha * g_i
+            //     u_k -= alpha * u_i
+            // end for
+            // g(:, k) = g_k
+            // m(k:s, k) = P(:, k:s)^H * g_k
+            // beta = f_k / m_k,k
+            // residual -= beta * g_k
+            // x += beta * u_k
+            // f(k+1:s) -= beta * m(k+1:s, k)
+        }
+
+        get_preconditioner()->apply(residual.get(), helper.get());
+        system_matrix_->apply(helper.get(), t.get());
+        // t = A * M^-1 * residual
+
+        t->compute_dot(residual.get(), omega.get());
+        t->compute_dot(t.get(), tht.get());
+        residual->compute_norm2(residual_norm.get());
+        exec->run(idr::make_compute_omega(nrhs, parameters_.kappa, tht.get(),
+                                          residual_norm.get(), omega.get(),
+                                          &stop_status));
+        // omega = (t^H * residual) / (t^H * t)
+        // rho = (t^H * residual) / (norm(t) * norm(residual))
+        // if abs(rho) < kappa then
+        //     omega *= kappa / abs(rho)
+        // end if
+
+        dense_x->add_scaled(omega.get(), helper.get());
+        t->scale(neg_one_op.get());
+        residual->add_scaled(omega.get(), t.get());
+        // x += omega * helper
+        // residual -= omega * t
+    }
+}
+
+
+template <typename ValueType>
+void Idr<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_IDR(_type) class Idr<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -0,0 +1,212 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/minres.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/solver/minres_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace minres {
+
+
+GKO_REGISTER_OPERATION(initialize, minres::initialize);
+GKO_REGISTER_OPERATION(step_1, minres::step_1);
+GKO_REGISTER_OPERATION(step_2, minres::step_2);
+
+
+}  // namespace minres
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Minres<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Minres<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->stop_criterion_factory_)
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void Minres<ValueType>::apply_impl(const LinOp *b, LinOp *x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+
+    auto exec = this->get_executor();
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+
+    auto dense_b = as<Vector>(b);
+    auto dense_x = as<Vector>(x);
+    auto r = Vector::create_with_config_of(dense_b);
+    auto r_prev = Vector::create_with_config_of(dense_b);
+    auto z = Vector::create_with_config_of(dense_b);
+    auto v = Vector::create_with_config_of(dense_b);
+    auto y = Vector::create_with_config_of(dense_b);
+    auto w = Vector::create_with_config_of(dense_b);
+    auto w_prev = Vector::create_with_config_of(dense_b);
+
+    auto alpha = Vector::create(exec, dim<2>{1, dense_b->get_size()[1]});
+    auto beta = Vector::create_with_config_of(alpha.get());
+    auto prev_beta = Vector::create_with_config_of(alpha.get());
+    auto tau = Vector::create_with_config_of(alpha.get());
+    auto phibar = Vector::create_with_config_of(alpha.get());
+    auto dbar = Vector::create_with_config_of(alpha.get());
+    auto epsilon = Vector::create_with_config_of(alpha.get());
+    auto cs = Vector::create_with_config_of(alpha.get());
+    auto sn = Vector::create_with_config_of(alpha.get());
+    auto residual_norm =
+        NormVector::create(exec, dim<2>{1, dense_b->get_size()[1]});
+
+    bool one_changed{};
+    Array<stopping_status> stop_status(alpha->get_executor(),
+                                       dense_b->get_size()[1]);
+
+    r->copy_from(dense_b);
+    system_matrix_->apply(neg_one_op.get(), dense_x, one_op.get(), r.get());
+    get_preconditioner()->apply(r.get(), z.get());
+    r->compute_dot(z.get(), beta.get());
+    // r = b - A * x
+    // z = M * r
+    // beta = r^H * z
+
+    // TODO: replace this with automatic merged kernel generator
+    exec->run(minres::make_initialize(
+        r.get(), z.get(), r_prev.get(), v.get(), w.get(), w_prev.get(),
+        beta.get(), prev_beta.get(), phibar.get(), dbar.get(), epsilon.get(),
+        cs.get(), sn.get(), residual_norm.get(), &stop_status));
+    // beta = phibar = sqrt(beta)
+    // r_prev = r
+    // v = z / beta
+    // w = w_prev = 0
+    // prev_beta = dbar = epsilon = sn = 0, cs = -1
+    // stop_status = 0x00
+
+    // the recurrence computes the residual norm induced by the inverse of the
+    // preconditioner, so the criteria get the initial residual in that norm:
+    // phibar = sqrt(r^H * M * r) is a 1 x k vector with exactly that norm
+    auto stop_criterion = stop_criterion_factory_->generate(
+        system_matrix_, std::shared_ptr<const LinOp>(b, [](const LinOp *) {}),
+        x, phibar.get());
+
+    int iter = -1;
+    while (true) {
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, iter, nullptr, dense_x, residual_norm.get());
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual_norm(residual_norm.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        system_matrix_->apply(v.get(), y.get());
+        exec->run(minres::make_step_1(v.get(), y.get(), r_prev.get(), r.get(),
+                                      alpha.get(), beta.get(), prev_beta.get(),
+                                      &stop_status));
+        // y = A * v - beta / prev_beta * r_prev
+        // alpha = v^H * y
+        // y -= alpha / beta * r
+        // r_prev = r
+        // r = y
+
+        get_preconditioner()->apply(r.get(), z.get());
+        r->compute_dot(z.get(), tau.get());
+        exec->run(minres::make_step_2(
+            dense_x, v.get(), z.get(), w.get(), w_prev.get(), tau.get(),
+            alpha.get(), beta.get(), prev_beta.get(), phibar.get(), dbar.get(),
+            epsilon.get(), cs.get(), sn.get(), residual_norm.get(),
+            &stop_status));
+        // prev_beta = beta, beta = sqrt(tau)
+        // apply the previous Givens rotation to the new column of the
+        // tridiagonal Lanczos matrix and compute a new rotation (cs, sn)
+        // that eliminates its subdiagonal entry
+        // w_new = (v - epsilon_old * w_prev - delta * w) / gamma
+        // x += cs * phibar * w_new
+        // phibar = sn * phibar
+        // v = z / beta
+    }
+}
+
+
+template <typename ValueType>
+void Minres<ValueType>::apply_impl(const LinOp *alpha, const LinOp *b,
+                                   const LinOp *beta, LinOp *x) const
+{
+    auto dense_x = as<matrix::Dense<ValueType>>(x);
+    auto x_clone = dense_x->clone();
+    this->apply(b, x_clone.get());
+    dense_x->scale(beta);
+    dense_x->add_scaled(alpha, x_clone.get());
+}
+
+
+#define GKO_DECLARE_MINRES(_type) class Minres<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES);
+
+
+}  // namespace solver
+}  // namespace gko
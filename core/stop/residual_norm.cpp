@@ -33,6 +33,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/stop/residual_norm.hpp>
 
 
+#include <algorithm>
+#include <cmath>
+
+
 #include "core/components/fill_array.hpp"
 #include "core/stop/residual_norm_kernels.hpp"
 
@@ -55,9 +59,26 @@ bool ResidualNorm<ValueType>::check_impl(uint8 stoppingId, bool setFinalized,
                                          bool *one_changed,
                                          const Criterion::Updater &updater)
 {
+    const auto check = num_checks_++;
+    if (check < next_check_) {
+        *one_changed = false;
+        return false;
+    }
     const NormVector *dense_tau;
     if (updater.residual_norm_ != nullptr) {
         dense_tau = as<NormVector>(updater.residual_norm_);
+    } else if (updater.implicit_sq_residual_norm_ != nullptr) {
+        // the squared norms are only a single row, so the square root is
+        // taken on the host instead of in a separate kernel
+        auto master = this->get_executor()->get_master();
+        auto sq_tau = Vector::create(master);
+        sq_tau->copy_from(updater.implicit_sq_residual_norm_);
+        auto host_tau = NormVector::create(master, sq_tau->get_size());
+        for (size_type i = 0; i < sq_tau->get_size()[1]; ++i) {
+            host_tau->at(0, i) = sqrt(abs(sq_tau->at(0, i)));
+        }
+        u_dense_tau_->copy_from(host_tau.get());
+        dense_tau = u_dense_tau_.get();
     } else if (updater.residual_ != nullptr) {
         auto *dense_r = as<Vector>(updater.residual_);
         dense_r->compute_norm2(u_dense_tau_.get());
@@ -71,9 +92,56 @@ bool ResidualNorm<ValueType>::check_impl(uint8 stoppingId, bool setFinalized,
         dense_tau, starting_tau_.get(), tolerance_, stoppingId, setFinalized,
         stop_status, &device_storage_, &all_converged, one_changed));
 
+    if (adaptive_check_interval_) {
+        update_check_interval(dense_tau);
+    } else {
+        next_check_ = check + check_interval_;
+    }
     return all_converged;
 }
 
+
+template <typename ValueType>
+void ResidualNorm<ValueType>::update_check_interval(const NormVector *dense_tau)
+{
+    using std::log;
+    auto master = this->get_executor()->get_master();
+    auto tau = NormVector::create(master);
+    tau->copy_from(dense_tau);
+    if (host_starting_tau_ == nullptr) {
+        host_starting_tau_ = NormVector::create(master);
+        host_starting_tau_->copy_from(starting_tau_.get());
+    }
+    const auto check = num_checks_ - 1;
+    const auto num_cols = tau->get_size()[1];
+    // without a previous evaluation, there is no rate to predict from
+    auto interval = last_tau_.get_num_elems() == num_cols ? check_interval_
+                                                          : size_type{1};
+    for (size_type i = 0; i < num_cols && interval > 1; ++i) {
+        const auto goal =
+            static_cast<double>(tolerance_ * host_starting_tau_->at(0, i));
+        const auto cur = static_cast<double>(tau->at(0, i));
+        const auto prev = static_cast<double>(last_tau_.get_const_data()[i]);
+        if (cur < goal || !(goal > 0.0) || !(cur < prev)) {
+            // converged, no sensible goal or no progress: nothing to predict
+            continue;
+        }
+        // assume a constant convergence rate per check
+        const auto rate =
+            log(cur / prev) / static_cast<double>(check - last_check_);
+        const auto remaining = log(goal / cur) / rate;
+        if (remaining / 2 < static_cast<double>(interval)) {
+            interval = std::max(static_cast<size_type>(remaining / 2),
+                                size_type{1});
+        }
+    }
+    last_tau_.resize_and_reset(num_cols);
+    std::copy_n(tau->get_const_values(), num_cols, last_tau_.get_data());
+    last_check_ = check;
+    next_check_ = check + interval;
+}
+
+
 template <typename ValueType>
 void AbsoluteResidualNorm<ValueType>::initialize_starting_tau()
 {
@@ -0,0 +1,528 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/binary_io.hpp>
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BinaryIo : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    BinaryIo()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create()),
+          mtx(gko::initialize<Csr>({{1.0, 0.0, 2.0, 0.0},
+                                    {0.0, 0.0, 0.0, 0.0},
+                                    {3.0, 4.0, 0.0, 5.0}},
+                                   ref)),
+          filename("binary_io_test_" + test_name() + ".bin")
+    {}
+
+    ~BinaryIo() { std::remove(filename.c_str()); }
+
+    static std::string test_name()
+    {
+        return ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void write_file(const Csr *matrix)
+    {
+        std::ofstream os(filename, std::ios::binary);
+        gko::write_binary(os, matrix);
+    }
+
+    void write_compressed_file(const Csr *matrix,
+                               gko::binary_value_storage value_storage =
+                                   gko::binary_value_storage::exact)
+    {
+        std::ofstream os(filename, std::ios::binary);
+        gko::write_compressed_binary(os, matrix, value_storage);
+    }
+
+    std::unique_ptr<Csr> generate_matrix(gko::size_type num_rows,
+                                         gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Csr>(
+            num_rows, num_cols, std::uniform_int_distribution<>(0, 20),
+            std::normal_distribution<>(0.0, 1.0), std::ranlux48(42), ref);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+    std::unique_ptr<Csr> mtx;
+    std::string filename;
+};
+
+TYPED_TEST_CASE(BinaryIo, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(BinaryIo, RoundTripsMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->write_file(this->mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    ASSERT_EQ(result->get_executor(), this->ref);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->mtx);
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, RoundTripsEmptyMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Csr = typename TestFixture::Csr;
+    auto empty = Csr::create(this->ref, gko::dim<2>{2, 3});
+    std::fill_n(empty->get_row_ptrs(), 3, 0);
+    this->write_file(empty.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+    ASSERT_EQ(result->get_const_row_ptrs()[2], 0);
+}
+
+
+TYPED_TEST(BinaryIo, ReadsToOtherExecutor)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->write_file(this->mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->omp);
+
+    ASSERT_EQ(result->get_executor(), this->omp);
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, ModifyingMatrixDoesNotModifyFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->write_file(this->mtx.get());
+    auto modified =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    modified->get_values()[0] = value_type{7.0};
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, MatrixOutlivesFileRemoval)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->write_file(this->mtx.get());
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    std::remove(this->filename.c_str());
+
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnTypeMismatch)
+{
+    using value_type = typename TestFixture::value_type;
+    using other_index_type =
+        std::conditional_t<std::is_same<typename TestFixture::index_type,
+                                        gko::int32>::value,
+                           gko::int64, gko::int32>;
+    this->write_file(this->mtx.get());
+
+    ASSERT_THROW((gko::read_binary<value_type, other_index_type>(
+                     this->filename, this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnTextFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    {
+        std::ofstream os(this->filename);
+        os << "%%MatrixMarket matrix coordinate real general\n"
+              "1 1 1\n"
+              "1 1 1.0\n";
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnTruncatedFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content.substr(0, content.size() - 1);
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnOverflowingSize)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    // the number of rows is stored at byte 32 of the header, with this value
+    // the size of the row pointers in bytes wraps around to zero
+    const auto num_rows = std::numeric_limits<std::uint64_t>::max();
+    std::memcpy(&content[32], &num_rows, sizeof(num_rows));
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content;
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnInvalidColumnIndex)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    // the column indexes follow the header and the row pointers, each padded
+    // to 64 bytes
+    const index_type col = 4;
+    std::memcpy(&content[192], &col, sizeof(col));
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content;
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnInvalidRowPointers)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    // the row pointers {0, 2, 2, 5} start at byte 128, make them decrease
+    const index_type row_ptr = 3;
+    std::memcpy(&content[128 + sizeof(index_type)], &row_ptr,
+                sizeof(row_ptr));
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content;
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, RoundTripsCompressedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->write_compressed_file(this->mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    ASSERT_EQ(result->get_executor(), this->ref);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->mtx);
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, RoundTripsEmptyCompressedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Csr = typename TestFixture::Csr;
+    auto empty = Csr::create(this->ref, gko::dim<2>{2, 3});
+    std::fill_n(empty->get_row_ptrs(), 3, 0);
+    this->write_compressed_file(empty.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+    ASSERT_EQ(result->get_const_row_ptrs()[2], 0);
+}
+
+
+TYPED_TEST(BinaryIo, RoundTripsLargeCompressedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    // spans multiple row blocks
+    auto mtx = this->generate_matrix(2500, 3000);
+    this->write_compressed_file(mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, mtx);
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, RoundTripsCompressedMatrixWithUnsortedColumns)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = this->generate_matrix(100, 50);
+    auto row_ptrs = mtx->get_const_row_ptrs();
+    for (gko::size_type row = 0; row < 100; ++row) {
+        std::reverse(mtx->get_col_idxs() + row_ptrs[row],
+                     mtx->get_col_idxs() + row_ptrs[row + 1]);
+    }
+    this->write_compressed_file(mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::Array<index_type>::view(this->ref, 100 + 1,
+                                     result->get_row_ptrs()),
+        gko::Array<index_type>::view(this->ref, 100 + 1, mtx->get_row_ptrs()));
+    const auto nnz = mtx->get_num_stored_elements();
+    GKO_ASSERT_ARRAY_EQ(
+        gko::Array<index_type>::view(this->ref, nnz, result->get_col_idxs()),
+        gko::Array<index_type>::view(this->ref, nnz, mtx->get_col_idxs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::Array<value_type>::view(this->ref, nnz, result->get_values()),
+        gko::Array<value_type>::view(this->ref, nnz, mtx->get_values()));
+}
+
+
+TYPED_TEST(BinaryIo, CompressedFileIsSmaller)
+{
+    auto mtx = this->generate_matrix(2000, 2000);
+    std::ostringstream binary;
+    std::ostringstream compressed;
+
+    gko::write_binary(binary, mtx.get());
+    gko::write_compressed_binary(compressed, mtx.get());
+
+    ASSERT_LT(compressed.str().size(), binary.str().size());
+}
+
+
+TYPED_TEST(BinaryIo, ReadsCompressedToOtherExecutor)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = this->generate_matrix(2500, 100);
+    this->write_compressed_file(mtx.get());
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->omp);
+
+    ASSERT_EQ(result->get_executor(), this->omp);
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, RoundsCompressedValuesToSinglePrecision)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::initialize<Csr>(
+        {{1.0 / 3.0, 0.0, 0.0}, {0.0, 1e-7, 0.0}}, this->ref);
+    auto rounded =
+        gko::initialize<Csr>({{static_cast<float>(1.0 / 3.0), 0.0, 0.0},
+                              {0.0, static_cast<float>(1e-7), 0.0}},
+                             this->ref);
+    this->write_compressed_file(mtx.get(),
+                                gko::binary_value_storage::single_precision);
+
+    auto result =
+        gko::read_binary<value_type, index_type>(this->filename, this->ref);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, mtx);
+    GKO_ASSERT_MTX_NEAR(result, rounded, 0.0);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnCorruptedCompressedFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_compressed_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    // the encoded indexes start after the header and the block index, each
+    // padded to 64 bytes. Setting the continuation bit of their first byte
+    // shifts all following codes
+    content[192] = static_cast<char>(content[192] | 0x80);
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content;
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnOverflowingCompressedSize)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_compressed_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    // with one row per block, the size of the block index in bytes wraps
+    // around to zero. The number of rows is stored at byte 32 of the header,
+    // the number of rows per block at byte 56
+    const auto num_rows = std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t rows_per_block = 1;
+    std::memcpy(&content[32], &num_rows, sizeof(num_rows));
+    std::memcpy(&content[56], &rows_per_block, sizeof(rows_per_block));
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content;
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryIo, FailsOnTruncatedCompressedFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::string content;
+    {
+        std::ostringstream oss;
+        gko::write_compressed_binary(oss, this->mtx.get());
+        content = oss.str();
+    }
+    {
+        std::ofstream os(this->filename, std::ios::binary);
+        os << content.substr(0, content.size() - 1);
+    }
+
+    ASSERT_THROW((gko::read_binary<value_type, index_type>(this->filename,
+                                                           this->ref)),
+                 gko::StreamError);
+}
+
+
+}  // namespace
@@ -159,6 +159,16 @@ TEST(ExceptionClasses, StreamErrorReturnsCorrectWhatMessage)
 }
 
 
+TEST(ExceptionClasses, NumericalBreakdownReturnsCorrectWhatMessage)
+{
+    gko::NumericalBreakdown error("test_file.cpp", 75, "my_func", 3,
+                                  "zero pivot");
+    ASSERT_EQ(std::string("test_file.cpp:75: my_func: Numerical breakdown in "
+                          "row 3 : zero pivot"),
+              error.what());
+}
+
+
 TEST(ExceptionClasses, KernelNotFoundReturnsCorrectWhatMessage)
 {
     gko::KernelNotFound error("test_file.cpp", 75, "my_func");
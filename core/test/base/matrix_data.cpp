@@ -333,4 +333,47 @@ TEST(MatrixData, InitializesGeneralMatrixWithConditionNumber)
 }
 
 
+TEST(MatrixData, EnsuresRowMajorOrder)
+{
+    using data = gko::matrix_data<double, int>;
+    using nnz = data::nonzero_type;
+    data m{gko::dim<2>{3, 3},
+           {{2, 0, 1.0}, {0, 1, 2.0}, {2, 1, 3.0}, {0, 0, 4.0}, {1, 2, 5.0}}};
+
+    m.ensure_row_major_order();
+
+    ASSERT_EQ(m.nonzeros, (std::vector<nnz>{{0, 0, 4.0},
+                                            {0, 1, 2.0},
+                                            {1, 2, 5.0},
+                                            {2, 0, 1.0},
+                                            {2, 1, 3.0}}));
+}
+
+
+TEST(MatrixData, SumsDuplicates)
+{
+    using data = gko::matrix_data<double, int>;
+    using nnz = data::nonzero_type;
+    data m{gko::dim<2>{3, 3},
+           {{2, 0, 1.0}, {0, 1, 2.0}, {2, 0, 3.0}, {0, 1, -2.0}, {2, 0, 4.0}}};
+
+    m.sum_duplicates();
+
+    ASSERT_EQ(m.nonzeros, (std::vector<nnz>{{0, 1, 0.0}, {2, 0, 8.0}}));
+}
+
+
+TEST(MatrixData, RemovesZeros)
+{
+    using data = gko::matrix_data<double, int>;
+    using nnz = data::nonzero_type;
+    data m{gko::dim<2>{3, 3},
+           {{2, 0, 1.0}, {0, 1, 0.0}, {1, 1, 3.0}, {0, 0, 0.0}}};
+
+    m.remove_zeros();
+
+    ASSERT_EQ(m.nonzeros, (std::vector<nnz>{{2, 0, 1.0}, {1, 1, 3.0}}));
+}
+
+
 }  // namespace
@@ -33,7 +33,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/mtx_io.hpp>
 
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -409,6 +418,394 @@ TEST(MtxReader, FailsWhenReadingSparseComplexMtxToRealMtx)
 }
 
 
+class MtxFileReader : public ::testing::Test {
+protected:
+    MtxFileReader() : filename("mtx_io_test_" + test_name() + ".mtx") {}
+
+    ~MtxFileReader() { std::remove(filename.c_str()); }
+
+    static std::string test_name()
+    {
+        return ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void write_file(const std::string &content)
+    {
+        std::ofstream os(filename, std::ios::binary);
+        os << content;
+    }
+
+    template <typename ValueType, typename IndexType>
+    void assert_same_as_stream(const std::string &content)
+    {
+        write_file(content);
+        std::istringstream iss(content);
+
+        auto data = gko::read_raw<ValueType, IndexType>(filename);
+
+        auto expected = gko::read_raw<ValueType, IndexType>(iss);
+        ASSERT_EQ(data.size, expected.size);
+        ASSERT_EQ(data.nonzeros, expected.nonzeros);
+    }
+
+    std::string filename;
+};
+
+
+TEST_F(MtxFileReader, ReadsSparseRealMtx)
+{
+    assert_same_as_stream<double, gko::int32>(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% a comment\n"
+        "2 3 4\n"
+        "1 1 1.0\n"
+        "2 2 5.0e0\n"
+        "1 2 -3.25\n"
+        "1 3 .5E+1\n");
+}
+
+
+TEST_F(MtxFileReader, ReadsSparseIntegerMtxWithoutTrailingNewline)
+{
+    assert_same_as_stream<float, gko::int64>(
+        "%%MatrixMarket matrix coordinate integer general\n"
+        "2 3 3\n"
+        "1 1 1\n"
+        "2 2 -5\n"
+        "1 3 2");
+}
+
+
+TEST_F(MtxFileReader, ReadsSparsePatternSymmetricMtx)
+{
+    assert_same_as_stream<double, gko::int32>(
+        "%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "3 3 4\n"
+        "1 1\n"
+        "2 1\n"
+        "3 2\n"
+        "3 3\n");
+}
+
+
+TEST_F(MtxFileReader, ReadsSparseRealSkewSymmetricMtx)
+{
+    assert_same_as_stream<double, gko::int32>(
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+        "3 3 2\n"
+        "2 1 2.0\n"
+        "3 1 1e-3\n");
+}
+
+
+TEST_F(MtxFileReader, ReadsSparseComplexHermitianMtx)
+{
+    assert_same_as_stream<std::complex<double>, gko::int32>(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 3\n"
+        "1 1 1.0 0.0\n"
+        "2 1 5.0 3.0\n"
+        "2 2 2.0 0.0\n");
+}
+
+
+TEST_F(MtxFileReader, ReadsDenseRealMtx)
+{
+    assert_same_as_stream<double, gko::int32>(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n");
+}
+
+
+TEST_F(MtxFileReader, ReadsLargeSparseMtxInParallel)
+{
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> index_dist(1, 1000);
+    std::uniform_real_distribution<double> value_dist(-1e3, 1e3);
+    std::uniform_int_distribution<int> format_dist(0, 3);
+    const int num_entries = 50000;
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real general\n"
+        << "1000 1000 " << num_entries << '\n';
+    char buffer[64];
+    for (int i = 0; i < num_entries; ++i) {
+        const char *formats[] = {"%.17g", "%.3f", "%e", "%g"};
+        std::snprintf(buffer, sizeof(buffer), formats[format_dist(engine)],
+                      value_dist(engine));
+        oss << index_dist(engine) << ' ' << index_dist(engine) << ' '
+            << buffer << '\n';
+    }
+
+    assert_same_as_stream<double, gko::int64>(oss.str());
+}
+
+
+TEST_F(MtxFileReader, IgnoresEntriesBeyondHeaderCount)
+{
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> index_dist(1, 1000);
+    std::ostringstream oss;
+    // the declared entries end in the middle of one of the parallel chunks
+    oss << "%%MatrixMarket matrix coordinate real general\n"
+        << "1000 1000 30000\n";
+    for (int i = 0; i < 50000; ++i) {
+        oss << index_dist(engine) << ' ' << index_dist(engine) << ' ' << i
+            << '\n';
+    }
+    oss << "not an entry\n";
+
+    assert_same_as_stream<double, gko::int32>(oss.str());
+}
+
+
+TEST_F(MtxFileReader, FailsWhenEntriesAreMissing)
+{
+    write_file(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 3\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(filename)),
+                 gko::StreamError);
+}
+
+
+TEST_F(MtxFileReader, FailsOnMalformedEntry)
+{
+    write_file(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "2 x 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(filename)),
+                 gko::StreamError);
+}
+
+
+TEST_F(MtxFileReader, FailsOnIndexOverflow)
+{
+    const std::string content =
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 1\n"
+        "1 4294967297 1.0\n";
+    write_file(content);
+    std::istringstream iss(content);
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(filename)),
+                 gko::StreamError);
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST_F(MtxFileReader, FailsWhenReadingSparseComplexMtxToRealMtx)
+{
+    write_file(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "2 3 1\n"
+        "1 1 1.0 2.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(filename)),
+                 gko::StreamError);
+}
+
+
+TEST_F(MtxFileReader, FailsWhenFileDoesNotExist)
+{
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(filename)),
+                 gko::StreamError);
+}
+
+
+class MtxPatternReader : public MtxFileReader {
+protected:
+    template <typename ValueType, typename IndexType>
+    void assert_same_as_read_raw(const std::string &content)
+    {
+        write_file(content);
+        std::istringstream iss(content);
+        std::istringstream raw_iss(content);
+
+        auto pattern = gko::read_pattern_raw<IndexType>(iss);
+        auto file_pattern = gko::read_pattern_raw<IndexType>(filename);
+
+        auto expected = gko::matrix_pattern<IndexType>(
+            gko::read_raw<ValueType, IndexType>(raw_iss));
+        ASSERT_EQ(pattern.size, expected.size);
+        ASSERT_EQ(pattern.nonzeros, expected.nonzeros);
+        ASSERT_EQ(file_pattern.size, expected.size);
+        ASSERT_EQ(file_pattern.nonzeros, expected.nonzeros);
+    }
+};
+
+
+TEST_F(MtxPatternReader, ReadsSparseRealMtx)
+{
+    assert_same_as_read_raw<double, gko::int32>(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% a comment\n"
+        "2 3 5\n"
+        "1 1 1.0\n"
+        "2 2 5.0e0\n"
+        "1 2 -3.25\n"
+        "1 3 .5E+1\n"
+        "2 1 0.0\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsSparsePatternSymmetricMtx)
+{
+    assert_same_as_read_raw<double, gko::int64>(
+        "%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "3 3 4\n"
+        "1 1\n"
+        "2 1\n"
+        "3 2\n"
+        "3 3\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsSparseRealSkewSymmetricMtx)
+{
+    assert_same_as_read_raw<double, gko::int32>(
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+        "3 3 2\n"
+        "2 1 2.0\n"
+        "3 1 1e-3\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsSparseComplexHermitianMtx)
+{
+    assert_same_as_read_raw<std::complex<double>, gko::int32>(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 3\n"
+        "1 1 1.0 0.0\n"
+        "2 1 5.0 3.0\n"
+        "2 2 2.0 0.0\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsDenseRealMtx)
+{
+    assert_same_as_read_raw<double, gko::int32>(
+        "%%MatrixMarket matrix array real general\n"
+        "2 3\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n"
+        "2.0\n"
+        "0.0\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsDenseRealSymmetricMtx)
+{
+    assert_same_as_read_raw<double, gko::int32>(
+        "%%MatrixMarket matrix array real symmetric\n"
+        "3 3\n"
+        "1.0\n"
+        "2.0\n"
+        "3.0\n"
+        "4.0\n"
+        "5.0\n"
+        "6.0\n");
+}
+
+
+TEST_F(MtxPatternReader, ReadsLargeSparseMtxInParallel)
+{
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> index_dist(1, 1000);
+    std::uniform_real_distribution<double> value_dist(-1e3, 1e3);
+    const int num_entries = 50000;
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real symmetric\n"
+        << "1000 1000 " << num_entries << '\n';
+    for (int i = 0; i < num_entries; ++i) {
+        const auto row = index_dist(engine);
+        const auto col = index_dist(engine);
+        oss << std::max(row, col) << ' ' << std::min(row, col) << ' '
+            << value_dist(engine) << '\n';
+    }
+
+    assert_same_as_read_raw<double, gko::int64>(oss.str());
+}
+
+
+TEST_F(MtxPatternReader, ReadsComplexMtxWithoutValueType)
+{
+    using nz = gko::matrix_pattern<gko::int32>::nonzero_type;
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "2 3 3\n"
+        "1 3 2.0 4.0\n"
+        "1 1 1.0 2.0\n"
+        "2 2 5.0 3.0\n");
+
+    auto pattern = gko::read_pattern_raw<gko::int32>(iss);
+
+    ASSERT_EQ(pattern.size, gko::dim<2>(2, 3));
+    ASSERT_EQ(pattern.nonzeros,
+              (std::vector<nz>{nz(0, 0), nz(0, 2), nz(1, 1)}));
+}
+
+
+TEST_F(MtxPatternReader, FailsWhenValuesAreMissing)
+{
+    const std::string content =
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "2 2\n";
+    write_file(content);
+    std::istringstream iss(content);
+
+    ASSERT_THROW(gko::read_pattern_raw<gko::int32>(filename),
+                 gko::StreamError);
+    ASSERT_THROW(gko::read_pattern_raw<gko::int32>(iss), gko::StreamError);
+}
+
+
+TEST_F(MtxPatternReader, FailsWhenEntriesAreMissing)
+{
+    write_file(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 3\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n");
+
+    ASSERT_THROW(gko::read_pattern_raw<gko::int32>(filename),
+                 gko::StreamError);
+}
+
+
+TEST_F(MtxPatternReader, FailsWhenDenseEntriesAreMissing)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n");
+
+    ASSERT_THROW(gko::read_pattern_raw<gko::int32>(iss), gko::StreamError);
+}
+
+
+TEST_F(MtxPatternReader, FailsWhenFileDoesNotExist)
+{
+    ASSERT_THROW(gko::read_pattern_raw<gko::int32>(filename),
+                 gko::StreamError);
+}
+
+
 TEST(MatrixData, WritesDoubleRealMatrixToMatrixMarketArray)
 {
     // clang-format off
@@ -597,6 +994,111 @@ TEST(MatrixData, WritesComplexFloatMatrixToMatrixMarketCoordinateWith64Index)
 }
 
 
+TEST(MatrixData, WritesValuesToMatrixMarketCoordinateLikeStream)
+{
+    std::default_random_engine engine(42);
+    std::uniform_real_distribution<double> mantissa_dist(-10.0, 10.0);
+    std::uniform_int_distribution<int> exponent_dist(-40, 40);
+    std::uniform_int_distribution<int> digits_dist(0, 9999999);
+    std::vector<double> values{0.0,      -0.0,     1.0,       -2.5,
+                               0.1,      1e-5,     1e-4,      123456.0,
+                               1234567., 999999.5, 9999995.0, 1.0 / 3.0,
+                               1e22,     1e-22,    1e300,     5e-324};
+    values.push_back(std::numeric_limits<double>::infinity());
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(mantissa_dist(engine) *
+                         std::pow(10.0, exponent_dist(engine)));
+    }
+    // numbers with 7 significant digits are close to rounding boundaries
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(digits_dist(engine) * 1e-3);
+    }
+    gko::matrix_data<double, gko::int64> data{gko::dim<2>{1, values.size()}};
+    std::ostringstream expected{};
+    expected << "%%MatrixMarket matrix coordinate real general\n"
+             << "1 " << values.size() << ' ' << values.size() << '\n';
+    for (gko::size_type i = 0; i < values.size(); ++i) {
+        data.nonzeros.emplace_back(0, i, values[i]);
+        expected << "1 " << i + 1 << ' ' << values[i] << '\n';
+    }
+    std::ostringstream oss{};
+
+    write_raw(oss, data, gko::layout_type::coordinate);
+
+    ASSERT_EQ(oss.str(), expected.str());
+}
+
+
+TEST(MatrixData, WritesMatrixMarketCoordinateWithStreamPrecision)
+{
+    gko::matrix_data<double, gko::int32> data{
+        gko::dim<2>{2, 2}, {{0, 0, 1.0 / 3.0}, {1, 1, 2.0}}};
+    std::ostringstream oss{};
+    oss << std::setprecision(17);
+
+    write_raw(oss, data, gko::layout_type::coordinate);
+
+    ASSERT_EQ(oss.str(),
+              "%%MatrixMarket matrix coordinate real general\n"
+              "2 2 2\n"
+              "1 1 0.33333333333333331\n"
+              "2 2 2\n");
+}
+
+
+using MtxFileWriter = MtxFileReader;
+
+
+TEST_F(MtxFileWriter, WritesSameAsStream)
+{
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int> index_dist(0, 999);
+    std::normal_distribution<float> value_dist(0.0, 1e3);
+    gko::matrix_data<std::complex<float>, gko::int32> data{
+        gko::dim<2>{1000, 1000}};
+    for (int i = 0; i < 50000; ++i) {
+        data.nonzeros.emplace_back(
+            index_dist(engine), index_dist(engine),
+            std::complex<float>{value_dist(engine), value_dist(engine)});
+    }
+    std::ostringstream expected{};
+    write_raw(expected, data, gko::layout_type::coordinate);
+
+    gko::write_raw(filename, data, gko::layout_type::coordinate);
+
+    std::ifstream is(filename, std::ios::binary);
+    std::ostringstream content{};
+    content << is.rdbuf();
+    ASSERT_EQ(content.str(), expected.str());
+}
+
+
+TEST_F(MtxFileWriter, WrittenFileCanBeReadBack)
+{
+    gko::matrix_data<double, gko::int64> data{gko::dim<2>{100, 50}};
+    for (int row = 0; row < 100; ++row) {
+        for (int col = row % 3; col < 50; col += 3) {
+            data.nonzeros.emplace_back(row, col, 0.25 * (row - col));
+        }
+    }
+
+    gko::write_raw(filename, data, gko::layout_type::coordinate);
+
+    auto result = gko::read_raw<double, gko::int64>(filename);
+    ASSERT_EQ(result.size, data.size);
+    ASSERT_EQ(result.nonzeros, data.nonzeros);
+}
+
+
+TEST_F(MtxFileWriter, FailsWhenFileCannotBeOpened)
+{
+    gko::matrix_data<double, gko::int32> data{gko::dim<2>{1, 1}};
+
+    ASSERT_THROW(gko::write_raw("nonexistent_directory/" + filename, data),
+                 gko::StreamError);
+}
+
+
 template <typename ValueType, typename IndexType>
 class DummyLinOp
     : public gko::EnableLinOp<DummyLinOp<ValueType, IndexType>>,
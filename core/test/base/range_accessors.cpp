@@ -33,6 +33,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/range_accessors.hpp>
 
 
+#include <complex>
+#include <type_traits>
+
+
 #include <gtest/gtest.h>
 
 
@@ -121,4 +125,86 @@ TEST_F(RowMajorAccessor, CanAssignSubranges)
 }
 
 
+class ReducedRowMajorAccessor : public ::testing::Test {
+protected:
+    using span = gko::span;
+
+    using reduced_range =
+        gko::range<gko::accessor::reduced_row_major<2, double, float>>;
+
+    // clang-format off
+    float data[6]{
+        1.0f, 2.0f, -1.0f,
+        3.0f, 4.0f, -2.0f
+    };
+    //clang-format on
+    reduced_range r{data, 2u, 2u, 3u};
+};
+
+
+TEST_F(ReducedRowMajorAccessor, CanReadData)
+{
+    EXPECT_EQ(static_cast<double>(r(0, 0)), 1.0);
+    EXPECT_EQ(static_cast<double>(r(0, 1)), 2.0);
+    EXPECT_EQ(static_cast<double>(r(1, 0)), 3.0);
+    EXPECT_EQ(static_cast<double>(r(1, 1)), 4.0);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, ReadsInArithmeticType)
+{
+    auto value = r(1, 1) * 0.1;
+
+    ASSERT_TRUE((std::is_same<decltype(value), double>::value));
+}
+
+
+TEST_F(ReducedRowMajorAccessor, RoundsWrittenValuesToStorageType)
+{
+    r(0, 0) = 1.0 + 1e-12;
+
+    EXPECT_EQ(data[0], 1.0f);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanCreateSubrange)
+{
+    auto subr = r(span{1, 2}, span{0, 2});
+
+    EXPECT_EQ(static_cast<double>(subr(0, 0)), 3.0);
+    EXPECT_EQ(static_cast<double>(subr(0, 1)), 4.0);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanAssignValues)
+{
+    r(1, 1) = r(0, 0);
+
+    EXPECT_EQ(data[4], 1.0f);
+}
+
+
+TEST_F(ReducedRowMajorAccessor, CanAssignSubranges)
+{
+    r(0, span{0, 2}) = r(1, span{0, 2});
+
+    EXPECT_EQ(data[0], 3.0f);
+    EXPECT_EQ(data[1], 4.0f);
+    EXPECT_EQ(data[2], -1.0f);
+}
+
+
+TEST(ReducedRowMajorComplexAccessor, ConvertsComponentWise)
+{
+    std::complex<float> data[1]{{1.0f, 2.0f}};
+    gko::range<gko::accessor::reduced_row_major<2, std::complex<double>,
+                                                std::complex<float>>>
+        r{data, 1u, 1u, 1u};
+
+    r(0, 0) = static_cast<std::complex<double>>(r(0, 0)) * 2.0;
+
+    EXPECT_EQ(data[0], std::complex<float>(2.0f, 4.0f));
+}
+
+
 }  // namespace
@@ -136,4 +136,37 @@ TEST(DummyLogged, CanLogEvents)
 }
 
 
+TEST(DummyLogged, SkipsEventsDisabledInAllLoggers)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto l = std::shared_ptr<DummyLogger>(
+        new DummyLogger(exec, gko::log::Logger::allocation_started_mask));
+    DummyLoggedClass c;
+    c.add_logger(l);
+
+    c.apply();
+
+    ASSERT_EQ(l->num_iterations_, 0);
+}
+
+
+TEST(DummyLogged, UpdatesEnabledEventsOnRemoval)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto l = std::shared_ptr<DummyLogger>(
+        new DummyLogger(exec, gko::log::Logger::iteration_complete_mask));
+    auto other = std::shared_ptr<DummyLogger>(
+        new DummyLogger(exec, gko::log::Logger::iteration_complete_mask));
+    DummyLoggedClass c;
+    c.add_logger(l);
+    c.add_logger(other);
+
+    c.remove_logger(gko::lend(l));
+    c.apply();
+
+    ASSERT_EQ(l->num_iterations_, 0);
+    ASSERT_EQ(other->num_iterations_, num_iters);
+}
+
+
 }  // namespace
@@ -0,0 +1,188 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/perf_counters.hpp>
+
+
+#include <sstream>
+#include <thread>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace {
+
+
+struct DummyOperation : gko::Operation {
+    DummyOperation(const char *name) : name{name} {}
+
+    const char *get_name() const noexcept override { return name; }
+
+    const char *name;
+};
+
+
+class PerfCounters : public ::testing::Test {
+protected:
+    PerfCounters()
+        : exec(gko::ReferenceExecutor::create()), op("dummy"), other("other")
+    {}
+
+    void record_operation(const gko::log::PerfCounters *logger,
+                          const DummyOperation &operation)
+    {
+        logger->on<gko::log::Logger::operation_launched>(exec.get(),
+                                                         &operation);
+        logger->on<gko::log::Logger::operation_completed>(exec.get(),
+                                                          &operation);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> exec;
+    DummyOperation op;
+    DummyOperation other;
+};
+
+
+TEST_F(PerfCounters, AggregatesPerOperationName)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+
+    record_operation(logger.get(), op);
+    record_operation(logger.get(), other);
+    record_operation(logger.get(), op);
+
+    auto counters = logger->get_counters();
+    ASSERT_EQ(counters.size(), 2);
+    ASSERT_EQ(counters["dummy"].num_calls, 2);
+    ASSERT_EQ(counters["other"].num_calls, 1);
+    ASSERT_GE(counters["dummy"].time, 0);
+}
+
+
+TEST_F(PerfCounters, AttributesNestedOperations)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &op);
+    record_operation(logger.get(), other);
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+
+    auto counters = logger->get_counters();
+    ASSERT_EQ(counters["dummy"].num_calls, 1);
+    ASSERT_EQ(counters["other"].num_calls, 1);
+    ASSERT_GE(counters["dummy"].time, counters["other"].time);
+}
+
+
+TEST_F(PerfCounters, KeepsOperationsOfDifferentThreadsApart)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &op);
+    std::thread{[&] {
+        logger->on<gko::log::Logger::operation_launched>(exec.get(), &other);
+    }}.join();
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+
+    auto counters = logger->get_counters();
+    ASSERT_EQ(counters.size(), 1);
+    ASSERT_EQ(counters["dummy"].num_calls, 1);
+}
+
+
+TEST_F(PerfCounters, IgnoresOperationsStartedBeforeCreation)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+
+    ASSERT_TRUE(logger->get_counters().empty());
+}
+
+
+TEST_F(PerfCounters, CountsInstructionsIfAvailable)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+    if (!logger->has_core_counters()) {
+        // perf_event_open is not permitted or not supported
+        return;
+    }
+    auto mtx = gko::initialize<gko::matrix::Dense<>>(
+        {{1.0, 2.0}, {3.0, 4.0}}, exec);
+    auto res = gko::matrix::Dense<>::create(exec, mtx->get_size());
+
+    logger->on<gko::log::Logger::operation_launched>(exec.get(), &op);
+    for (int i = 0; i < 100; ++i) {
+        mtx->apply(mtx.get(), res.get());
+    }
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+
+    auto counters = logger->get_counters();
+    ASSERT_GT(counters["dummy"].instructions, 0);
+}
+
+
+TEST_F(PerfCounters, ResetsCounters)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+    record_operation(logger.get(), op);
+
+    logger->reset();
+
+    ASSERT_TRUE(logger->get_counters().empty());
+}
+
+
+TEST_F(PerfCounters, WritesTable)
+{
+    auto logger = gko::log::PerfCounters::create(exec);
+    record_operation(logger.get(), op);
+    std::stringstream ss;
+
+    logger->write(ss);
+
+    std::string header;
+    std::string name;
+    std::getline(ss, header);
+    ss >> name;
+    ASSERT_NE(header.find("GB/s"), std::string::npos);
+    ASSERT_EQ(name, "dummy");
+}
+
+
+}  // namespace
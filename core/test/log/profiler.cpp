@@ -0,0 +1,232 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/log/profiler.hpp>
+
+
+#include <sstream>
+#include <thread>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+struct DummyOperation : gko::Operation {
+    const char *get_name() const noexcept override { return "dummy"; }
+};
+
+
+class Profiler : public ::testing::Test {
+protected:
+    using Mtx = gko::matrix::Dense<double>;
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+
+    Profiler()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Csr>(
+              {{2.0, -1.0, 0.0}, {0.0, 2.0, 0.0}, {0.0, -1.0, 2.0}}, exec)),
+          b(gko::initialize<Mtx>({1.0, 2.0, 3.0}, exec)),
+          x(gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec))
+    {}
+
+    void record_operation(const gko::log::Profiler *logger)
+    {
+        logger->on<gko::log::Logger::operation_launched>(exec.get(), &op);
+        logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> mtx;
+    std::unique_ptr<Mtx> b;
+    std::unique_ptr<Mtx> x;
+    DummyOperation op;
+};
+
+
+TEST_F(Profiler, RecordsNestedRanges)
+{
+    auto logger = gko::log::Profiler::create(exec);
+
+    logger->on<gko::log::Logger::linop_apply_started>(mtx.get(), b.get(),
+                                                      x.get());
+    record_operation(logger.get());
+    logger->on<gko::log::Logger::linop_apply_completed>(mtx.get(), b.get(),
+                                                        x.get());
+
+    auto ranges = logger->get_ranges();
+    ASSERT_EQ(ranges.size(), 2);
+    ASSERT_EQ(ranges[0].kind, gko::log::Profiler::range_kind::apply);
+    ASSERT_EQ(ranges[0].depth, 0);
+    ASSERT_EQ(ranges[0].type, &typeid(Csr));
+    ASSERT_EQ(ranges[1].kind, gko::log::Profiler::range_kind::operation);
+    ASSERT_EQ(ranges[1].depth, 1);
+    ASSERT_EQ(gko::log::Profiler::get_range_name(ranges[1]), "dummy");
+    ASSERT_LE(ranges[0].start, ranges[1].start);
+    ASSERT_GE(ranges[0].end, ranges[1].end);
+}
+
+
+TEST_F(Profiler, EstimatesCsrApplyCost)
+{
+    auto logger = gko::share(gko::log::Profiler::create(exec));
+    exec->add_logger(logger);
+    mtx->add_logger(logger);
+
+    mtx->apply(b.get(), x.get());
+
+    exec->remove_logger(logger.get());
+    auto ranges = logger->get_ranges();
+    ASSERT_GE(ranges.size(), 2);
+    ASSERT_EQ(ranges[0].kind, gko::log::Profiler::range_kind::apply);
+    // 5 values, 5 column indices, 4 row pointers, 3 + 3 vector entries
+    ASSERT_EQ(ranges[0].bytes, 5 * 8 + 9 * 4 + 6 * 8);
+    ASSERT_EQ(ranges[0].flops, 10);
+    ASSERT_EQ(ranges[1].kind, gko::log::Profiler::range_kind::operation);
+    ASSERT_EQ(ranges[1].depth, 1);
+}
+
+
+TEST_F(Profiler, EstimatesAdvancedApplyCost)
+{
+    auto logger = gko::share(gko::log::Profiler::create(exec));
+    auto alpha = gko::initialize<Mtx>({2.0}, exec);
+    auto beta = gko::initialize<Mtx>({1.0}, exec);
+    mtx->add_logger(logger);
+
+    mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    auto ranges = logger->get_ranges();
+    ASSERT_EQ(ranges.size(), 1);
+    ASSERT_EQ(ranges[0].bytes, 5 * 8 + 9 * 4 + 9 * 8);
+    ASSERT_EQ(ranges[0].flops, 10 + 9);
+}
+
+
+TEST_F(Profiler, OverwritesOldestRanges)
+{
+    auto logger = gko::log::Profiler::create(exec, 2);
+
+    record_operation(logger.get());
+    record_operation(logger.get());
+    record_operation(logger.get());
+
+    ASSERT_EQ(logger->get_ranges().size(), 2);
+    ASSERT_EQ(logger->get_num_dropped_ranges(), 1);
+}
+
+
+TEST_F(Profiler, RecordsRangesPerThread)
+{
+    auto logger = gko::log::Profiler::create(exec);
+
+    record_operation(logger.get());
+    std::thread thread([&] { record_operation(logger.get()); });
+    thread.join();
+
+    auto ranges = logger->get_ranges();
+    ASSERT_EQ(ranges.size(), 2);
+    ASSERT_EQ(ranges[0].thread, 0);
+    ASSERT_EQ(ranges[0].depth, 0);
+    ASSERT_EQ(ranges[1].thread, 1);
+    ASSERT_EQ(ranges[1].depth, 0);
+}
+
+
+TEST_F(Profiler, IgnoresUnmatchedCompletion)
+{
+    auto logger = gko::log::Profiler::create(exec);
+
+    logger->on<gko::log::Logger::operation_completed>(exec.get(), &op);
+
+    ASSERT_EQ(logger->get_ranges().size(), 0);
+}
+
+
+TEST_F(Profiler, WritesChromeTrace)
+{
+    auto logger = gko::log::Profiler::create(exec);
+    record_operation(logger.get());
+    std::stringstream ss;
+
+    logger->write_chrome_trace(ss);
+
+    auto trace = ss.str();
+    ASSERT_EQ(trace.find("{\"traceEvents\":["), 0);
+    ASSERT_NE(trace.find("\"name\":\"dummy\",\"cat\":\"operation\",\"ph\":"
+                         "\"X\",\"pid\":0,\"tid\":0"),
+              std::string::npos);
+    ASSERT_NE(trace.find("\"args\":{\"bytes\":0,\"flops\":0}"),
+              std::string::npos);
+}
+
+
+TEST_F(Profiler, WritesFoldedStacks)
+{
+    auto logger = gko::log::Profiler::create(exec);
+    logger->on<gko::log::Logger::linop_apply_started>(mtx.get(), b.get(),
+                                                      x.get());
+    record_operation(logger.get());
+    record_operation(logger.get());
+    logger->on<gko::log::Logger::linop_apply_completed>(mtx.get(), b.get(),
+                                                        x.get());
+    std::stringstream ss;
+
+    logger->write_folded_stacks(ss);
+
+    // the type names contain spaces, the self time follows the last one
+    std::string first;
+    std::string second;
+    std::string rest;
+    std::getline(ss, first);
+    std::getline(ss, second);
+    std::getline(ss, rest);
+    auto stack = [](const std::string &line) {
+        return line.substr(0, line.rfind(' '));
+    };
+    ASSERT_EQ(stack(first), "gko::matrix::Csr<double, int>");
+    ASSERT_EQ(stack(second), "gko::matrix::Csr<double, int>;dummy");
+    ASSERT_TRUE(rest.empty());
+}
+
+
+}  // namespace
@@ -525,4 +525,96 @@ TEST(Record, CatchesIterations)
 }
 
 
+TEST(Record, BoundsStoragePerEvent)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        exec, gko::log::Logger::allocation_started_mask, 2);
+
+    for (int i = 0; i < 5; ++i) {
+        logger->on<gko::log::Logger::allocation_started>(exec.get(), i);
+    }
+
+    auto &data = logger->get().allocation_started;
+    ASSERT_EQ(data.size(), 2);
+    ASSERT_EQ(data[0]->num_bytes, 3);
+    ASSERT_EQ(data[1]->num_bytes, 4);
+}
+
+
+TEST(Record, SamplesEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        exec,
+        gko::log::Logger::allocation_started_mask |
+            gko::log::Logger::free_started_mask,
+        0, 3);
+
+    for (int i = 0; i < 7; ++i) {
+        logger->on<gko::log::Logger::allocation_started>(exec.get(), i);
+    }
+    logger->on<gko::log::Logger::free_started>(exec.get(), 42);
+
+    auto &data = logger->get().allocation_started;
+    ASSERT_EQ(data.size(), 3);
+    ASSERT_EQ(data[0]->num_bytes, 0);
+    ASSERT_EQ(data[1]->num_bytes, 3);
+    ASSERT_EQ(data[2]->num_bytes, 6);
+    // every event type is sampled separately
+    ASSERT_EQ(logger->get().free_started.size(), 1);
+}
+
+
+TEST(Record, StoresResidualNormInsteadOfVectors)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        exec, gko::log::Logger::iteration_complete_mask, 1, 1, false);
+    auto factory =
+        gko::solver::Bicgstab<>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(exec))
+            .on(exec);
+    auto solver = factory->generate(gko::initialize<Dense>({1.1}, exec));
+    auto residual = gko::initialize<Dense>({3.0, 4.0}, exec);
+    auto solution = gko::initialize<Dense>({-2.2, 1.0}, exec);
+
+    logger->on<gko::log::Logger::iteration_complete>(
+        solver.get(), num_iters, residual.get(), solution.get());
+
+    auto &data = logger->get().iteration_completed.back();
+    ASSERT_EQ(data->num_iterations, num_iters);
+    ASSERT_EQ(data->residual.get(), nullptr);
+    ASSERT_EQ(data->solution.get(), nullptr);
+    GKO_ASSERT_MTX_NEAR(gko::as<Dense>(data->residual_norm.get()), l({{5.0}}),
+                        0);
+}
+
+
+TEST(Record, KeepsGivenResidualNormInsteadOfVectors)
+{
+    using Dense = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        exec, gko::log::Logger::criterion_check_completed_mask, 1, 1, false);
+    auto criterion =
+        gko::stop::Iteration::build().with_max_iters(3u).on(exec)->generate(
+            nullptr, nullptr, nullptr);
+    auto residual = gko::initialize<Dense>({3.0, 4.0}, exec);
+    auto residual_norm = gko::initialize<Dense>({-3.3}, exec);
+    gko::Array<gko::stopping_status> stop_status(exec, 1);
+
+    logger->on<gko::log::Logger::criterion_check_completed>(
+        criterion.get(), 1, residual.get(), residual_norm.get(), nullptr, 1,
+        true, &stop_status, true, true);
+
+    auto &data = logger->get().criterion_check_completed.back();
+    ASSERT_EQ(data->residual.get(), nullptr);
+    GKO_ASSERT_MTX_NEAR(gko::as<Dense>(data->residual_norm.get()),
+                        residual_norm, 0);
+}
+
+
 }  // namespace
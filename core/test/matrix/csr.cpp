@@ -239,4 +239,28 @@ TYPED_TEST(Csr, GeneratesCorrectMatrixData)
 }
 
 
+TYPED_TEST(Csr, GeneratesCorrectMatrixDataForLargeMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix_data<value_type, index_type> expected{gko::dim<2>{1000, 500}};
+    // enough nonzeros to be split between multiple threads, and empty rows
+    for (index_type row = 0; row < 1000; ++row) {
+        for (index_type j = 0; row % 7 != 0 && j < 150; ++j) {
+            expected.nonzeros.emplace_back(row, 3 * j + row % 3,
+                                           static_cast<value_type>(row + j));
+        }
+    }
+    auto mtx = Mtx::create(this->exec);
+    mtx->read(expected);
+    gko::matrix_data<value_type, index_type> data;
+
+    mtx->write(data);
+
+    ASSERT_EQ(data.size, expected.size);
+    ASSERT_EQ(data.nonzeros, expected.nonzeros);
+}
+
+
 }  // namespace
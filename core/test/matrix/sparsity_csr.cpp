@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <memory>
+#include <sstream>
 
 
 #include <gtest/gtest.h>
@@ -41,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/mtx_io.hpp>
 
 
 #include "core/test/utils.hpp"
@@ -223,6 +225,62 @@ TYPED_TEST(SparsityCsr, CanBeReadFromMatrixData)
 }
 
 
+TYPED_TEST(SparsityCsr, CanBeReadFromMatrixPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    auto m = Mtx::create(this->exec);
+    gko::matrix_pattern<index_type> pattern{gko::dim<2>{2, 3}};
+    pattern.nonzeros = {{0, 0}, {0, 1}, {0, 2}, {1, 1}};
+
+    m->read(pattern);
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(SparsityCsr, CanBeReadFromMatrixPatternWithEmptyRows)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    auto m = Mtx::create(this->exec);
+    gko::matrix_pattern<index_type> pattern{gko::dim<2>{4, 2}};
+    pattern.nonzeros = {{1, 0}, {1, 1}, {3, 1}};
+
+    m->read(pattern);
+
+    auto r = m->get_const_row_ptrs();
+    auto c = m->get_const_col_idxs();
+    ASSERT_EQ(m->get_size(), gko::dim<2>(4, 2));
+    ASSERT_EQ(m->get_num_nonzeros(), 3);
+    EXPECT_EQ(r[0], 0);
+    EXPECT_EQ(r[1], 0);
+    EXPECT_EQ(r[2], 2);
+    EXPECT_EQ(r[3], 2);
+    EXPECT_EQ(r[4], 3);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 1);
+    EXPECT_EQ(c[2], 1);
+}
+
+
+TYPED_TEST(SparsityCsr, CanBeReadFromMatrixMarketPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 4\n"
+        "1 2 3.0\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n"
+        "1 3 0.0\n");
+
+    auto m = gko::read_pattern<Mtx>(iss, this->exec);
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
 TYPED_TEST(SparsityCsr, GeneratesCorrectMatrixData)
 {
     using value_type = typename TestFixture::value_type;
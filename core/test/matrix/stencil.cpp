@@ -0,0 +1,169 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type = ValueType;
+    using Mtx = gko::matrix::Stencil<value_type>;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(
+              exec, gko::dim<2>{3, 4}, gko::matrix::stencil_shape::star,
+              gko::Array<value_type>{exec, {-1., -1., 4., -1., -1.}}))
+    {}
+
+    void assert_equal_to_original_mtx(const Mtx *m)
+    {
+        auto c = m->get_const_coefficients();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(12, 12));
+        ASSERT_EQ(m->get_grid_size(), gko::dim<3>(3, 4, 1));
+        ASSERT_EQ(m->get_num_dimensions(), 2);
+        ASSERT_EQ(m->get_shape(), gko::matrix::stencil_shape::star);
+        ASSERT_EQ(m->get_num_stored_elements(), 5);
+        ASSERT_FALSE(m->has_variable_coefficients());
+        EXPECT_EQ(c[0], value_type{-1.});
+        EXPECT_EQ(c[1], value_type{-1.});
+        EXPECT_EQ(c[2], value_type{4.});
+        EXPECT_EQ(c[3], value_type{-1.});
+        EXPECT_EQ(c[4], value_type{-1.});
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_CASE(Stencil, gko::test::ValueTypes);
+
+
+TYPED_TEST(Stencil, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(12, 12));
+    ASSERT_EQ(this->mtx->get_grid_size(), gko::dim<3>(3, 4, 1));
+}
+
+
+TYPED_TEST(Stencil, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(Stencil, KnowsNumberOfStencilPoints)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_EQ(Mtx::compute_num_points(1, gko::matrix::stencil_shape::star), 3);
+    ASSERT_EQ(Mtx::compute_num_points(2, gko::matrix::stencil_shape::star), 5);
+    ASSERT_EQ(Mtx::compute_num_points(3, gko::matrix::stencil_shape::star), 7);
+    ASSERT_EQ(Mtx::compute_num_points(1, gko::matrix::stencil_shape::box), 3);
+    ASSERT_EQ(Mtx::compute_num_points(2, gko::matrix::stencil_shape::box), 9);
+    ASSERT_EQ(Mtx::compute_num_points(3, gko::matrix::stencil_shape::box), 27);
+}
+
+
+TYPED_TEST(Stencil, CanBeCreatedWithVariableCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    auto mtx = Mtx::create(this->exec, gko::dim<3>{2, 3, 4},
+                           gko::matrix::stencil_shape::box, true);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(24, 24));
+    ASSERT_EQ(mtx->get_num_dimensions(), 3);
+    ASSERT_EQ(mtx->get_num_points(), 27);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 27 * 24);
+    ASSERT_TRUE(mtx->has_variable_coefficients());
+}
+
+
+TYPED_TEST(Stencil, ThrowsOnWrongNumberOfCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<1>{4},
+                             gko::matrix::stencil_shape::star,
+                             gko::Array<value_type>{this->exec, 5}),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Stencil, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->mtx->get_coefficients()[2] = 5.0;
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(Stencil, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(std::move(this->mtx));
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(Stencil, CanBeCloned)
+{
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(clone.get());
+}
+
+
+}  // namespace
@@ -0,0 +1,123 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/polynomial.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class PolynomialFactory : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Polynomial = gko::preconditioner::Polynomial<value_type>;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+
+    PolynomialFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          factory(Polynomial::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename Polynomial::Factory> factory;
+};
+
+TYPED_TEST_CASE(PolynomialFactory, gko::test::ValueTypes);
+
+
+TYPED_TEST(PolynomialFactory, KnowsItsExecutor)
+{
+    ASSERT_EQ(this->factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(PolynomialFactory, SetsDefaultParametersCorrectly)
+{
+    ASSERT_EQ(this->factory->get_parameters().type,
+              gko::preconditioner::polynomial_type::neumann);
+    ASSERT_EQ(this->factory->get_parameters().degree, 3u);
+}
+
+
+TYPED_TEST(PolynomialFactory, SetsParametersCorrectly)
+{
+    using Polynomial = typename TestFixture::Polynomial;
+
+    auto factory =
+        Polynomial::build()
+            .with_type(gko::preconditioner::polynomial_type::gmres)
+            .with_degree(5u)
+            .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().type,
+              gko::preconditioner::polynomial_type::gmres);
+    ASSERT_EQ(factory->get_parameters().degree, 5u);
+}
+
+
+TYPED_TEST(PolynomialFactory, ThrowsOnRectangularMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(Csr::create(this->exec, gko::dim<2>{2, 3}));
+
+    ASSERT_THROW(this->factory->generate(mtx), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(PolynomialFactory, KeepsSystemMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(Csr::create(this->exec, gko::dim<2>{3, 3}));
+
+    auto precond = this->factory->generate(mtx);
+
+    ASSERT_EQ(precond->get_system_matrix(), mtx);
+    ASSERT_EQ(precond->get_size(), gko::dim<2>(3, 3));
+}
+
+
+}  // namespace
@@ -0,0 +1,114 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/schwarz.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SchwarzFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Schwarz = gko::preconditioner::Schwarz<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    SchwarzFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          factory(Schwarz::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename Schwarz::Factory> factory;
+};
+
+TYPED_TEST_CASE(SchwarzFactory, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(SchwarzFactory, KnowsItsExecutor)
+{
+    ASSERT_EQ(this->factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(SchwarzFactory, SetsDefaultParametersCorrectly)
+{
+    ASSERT_EQ(this->factory->get_parameters().num_subdomains, 0u);
+    ASSERT_EQ(this->factory->get_parameters().overlap, 0u);
+    ASSERT_EQ(this->factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(SchwarzFactory, SetsParametersCorrectly)
+{
+    using Schwarz = typename TestFixture::Schwarz;
+
+    auto factory = Schwarz::build()
+                       .with_num_subdomains(4u)
+                       .with_overlap(2u)
+                       .with_skip_sorting(true)
+                       .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().num_subdomains, 4u);
+    ASSERT_EQ(factory->get_parameters().overlap, 2u);
+    ASSERT_EQ(factory->get_parameters().skip_sorting, true);
+}
+
+
+TYPED_TEST(SchwarzFactory, ThrowsOnRectangularMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(Csr::create(this->exec, gko::dim<2>{2, 3}));
+
+    ASSERT_THROW(this->factory->generate(mtx), gko::DimensionMismatch);
+}
+
+
+}  // namespace
@@ -0,0 +1,138 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/cb_gmres.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class CbGmres : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::CbGmres<value_type>;
+
+    CbGmres()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{1.0, 2.0, 3.0}, {3.0, 2.0, -1.0}, {0.0, -1.0, 2}}, exec)),
+          cb_gmres_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(3u).on(exec))
+                  .on(exec)),
+          solver(cb_gmres_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> cb_gmres_factory;
+    std::unique_ptr<Solver> solver;
+};
+
+TYPED_TEST_CASE(CbGmres, gko::test::ValueTypes);
+
+
+TYPED_TEST(CbGmres, CbGmresFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->cb_gmres_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(CbGmres, CbGmresFactoryCreatesCorrectSolver)
+{
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->solver->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(CbGmres, HasDefaultParameters)
+{
+    ASSERT_EQ(this->solver->get_krylov_dim(), gko::solver::default_krylov_dim);
+    ASSERT_EQ(this->solver->get_storage_precision(),
+              gko::solver::cb_gmres::storage_precision::reduce1);
+}
+
+
+TYPED_TEST(CbGmres, CanSetStoragePrecision)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_krylov_dim(4u)
+            .with_storage_precision(
+                gko::solver::cb_gmres::storage_precision::reduce2)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_krylov_dim(), 4);
+    ASSERT_EQ(solver->get_storage_precision(),
+              gko::solver::cb_gmres::storage_precision::reduce2);
+}
+
+
+TYPED_TEST(CbGmres, TransposeKeepsParameters)
+{
+    using Solver = typename TestFixture::Solver;
+    this->solver->set_krylov_dim(7u);
+
+    auto transposed = gko::as<Solver>(this->solver->transpose());
+
+    ASSERT_EQ(transposed->get_krylov_dim(), 7u);
+    ASSERT_EQ(transposed->get_storage_precision(),
+              this->solver->get_storage_precision());
+}
+
+
+TYPED_TEST(CbGmres, ApplyUsesInitialGuessReturnsTrue)
+{
+    ASSERT_TRUE(this->solver->apply_uses_initial_guess());
+}
+
+
+}  // namespace
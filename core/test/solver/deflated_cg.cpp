@@ -0,0 +1,152 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/deflated_cg.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class DeflatedCg : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::DeflatedCg<value_type>;
+
+    DeflatedCg()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          factory(Solver::build()
+                      .with_criteria(
+                          gko::stop::Iteration::build().with_max_iters(3u).on(
+                              exec))
+                      .with_deflation_dim(2u)
+                      .with_krylov_dim(5u)
+                      .on(exec)),
+          solver(factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> factory;
+    std::unique_ptr<Solver> solver;
+};
+
+TYPED_TEST_CASE(DeflatedCg, gko::test::ValueTypes);
+
+
+TYPED_TEST(DeflatedCg, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(DeflatedCg, FactoryKnowsItsParameters)
+{
+    ASSERT_EQ(this->factory->get_parameters().deflation_dim, 2u);
+    ASSERT_EQ(this->factory->get_parameters().krylov_dim, 5u);
+}
+
+
+TYPED_TEST(DeflatedCg, HasDefaultParameters)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto factory = Solver::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().deflation_dim, 4u);
+    ASSERT_EQ(factory->get_parameters().krylov_dim, 16u);
+}
+
+
+TYPED_TEST(DeflatedCg, FactoryCreatesCorrectSolver)
+{
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->solver->get_system_matrix(), this->mtx);
+    ASSERT_EQ(this->solver->get_deflation_space(), nullptr);
+}
+
+
+TYPED_TEST(DeflatedCg, ApplyUsesInitialGuessReturnsTrue)
+{
+    ASSERT_TRUE(this->solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(DeflatedCg, CanBeCloned)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto clone = this->solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(static_cast<Solver *>(clone.get())->get_system_matrix(),
+              this->mtx);
+}
+
+
+TYPED_TEST(DeflatedCg, CanClearDeflationSpace)
+{
+    using Mtx = typename TestFixture::Mtx;
+    this->solver->set_deflation_space(gko::initialize<Mtx>({1.0, 0.0, 0.0},
+                                                           this->exec));
+
+    this->solver->set_deflation_space(nullptr);
+
+    ASSERT_EQ(this->solver->get_deflation_space(), nullptr);
+}
+
+
+TYPED_TEST(DeflatedCg, ThrowsOnWrongDeflationSpaceSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_THROW(this->solver->set_deflation_space(
+                     gko::initialize<Mtx>({1.0, 0.0}, this->exec)),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
@@ -0,0 +1,107 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/direct.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/cholesky.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Direct : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Solver = gko::solver::Direct<value_type, index_type>;
+    using Cholesky = gko::factorization::Cholesky<value_type, index_type>;
+
+    Direct()
+        : exec(gko::ReferenceExecutor::create()),
+          direct_factory(Solver::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename Solver::Factory> direct_factory;
+};
+
+TYPED_TEST_CASE(Direct, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Direct, DirectFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->direct_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(Direct, DirectFactoryUsesDefaultParameters)
+{
+    auto params = this->direct_factory->get_parameters();
+
+    ASSERT_EQ(params.factorization, nullptr);
+    ASSERT_EQ(params.num_rhs, 1u);
+}
+
+
+TYPED_TEST(Direct, SetFactorization)
+{
+    using Solver = typename TestFixture::Solver;
+    using Cholesky = typename TestFixture::Cholesky;
+    std::shared_ptr<const gko::LinOpFactory> cholesky_factory =
+        Cholesky::build().on(this->exec);
+
+    auto factory = Solver::build()
+                       .with_factorization(cholesky_factory)
+                       .with_num_rhs(3u)
+                       .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().factorization, cholesky_factory);
+    ASSERT_EQ(factory->get_parameters().num_rhs, 3u);
+}
+
+
+}  // namespace
@@ -1378,6 +1378,28 @@ void extract_diagonal(std::shared_ptr<const CudaExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void update_values(std::shared_ptr<const CudaExecutor> exec,
+                   const Array<IndexType> &slot_ptrs,
+                   const Array<IndexType> &contribution_idxs,
+                   const Array<ValueType> &contributions,
+                   matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto num_slots = mtx->get_num_stored_elements();
+    const auto num_blocks = ceildiv(num_slots, default_block_size);
+    if (num_blocks > 0) {
+        kernel::update_values<<<num_blocks, default_block_size>>>(
+            num_slots, as_cuda_type(slot_ptrs.get_const_data()),
+            as_cuda_type(contribution_idxs.get_const_data()),
+            as_cuda_type(contributions.get_const_data()),
+            as_cuda_type(mtx->get_values()));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL);
+
+
 }  // namespace csr
 }  // namespace cuda
 }  // namespace kernels
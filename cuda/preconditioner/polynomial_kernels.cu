@@ -0,0 +1,91 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/polynomial_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+/**
+ * @brief The Polynomial preconditioner namespace.
+ *
+ * @ingroup precond
+ */
+namespace polynomial {
+
+
+template <typename ValueType>
+void invert_diagonal(std::shared_ptr<const CudaExecutor> exec,
+                     matrix::Diagonal<ValueType> *diag) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL);
+
+
+template <typename ValueType>
+void neumann_step(std::shared_ptr<const CudaExecutor> exec,
+                  const matrix::Diagonal<ValueType> *inv_diag,
+                  const matrix::Dense<ValueType> *b,
+                  const matrix::Dense<ValueType> *ax,
+                  matrix::Dense<ValueType> *x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL);
+
+
+template <typename ValueType>
+void root_step(std::shared_ptr<const CudaExecutor> exec, ValueType inv_root,
+               matrix::Dense<ValueType> *r, const matrix::Dense<ValueType> *ar,
+               matrix::Dense<ValueType> *x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL);
+
+
+template <typename ValueType>
+void pair_step(std::shared_ptr<const CudaExecutor> exec,
+               remove_complex<ValueType> two_real_part,
+               remove_complex<ValueType> inv_squared_abs,
+               const matrix::Dense<ValueType> *r, matrix::Dense<ValueType> *ar,
+               matrix::Dense<ValueType> *x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL);
+
+
+}  // namespace polynomial
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
@@ -1206,6 +1206,29 @@ void extract_diagonal(std::shared_ptr<const HipExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void update_values(std::shared_ptr<const HipExecutor> exec,
+                   const Array<IndexType> &slot_ptrs,
+                   const Array<IndexType> &contribution_idxs,
+                   const Array<ValueType> &contributions,
+                   matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto num_slots = mtx->get_num_stored_elements();
+    const auto num_blocks = ceildiv(num_slots, default_block_size);
+    if (num_blocks > 0) {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(kernel::update_values),
+                           dim3(num_blocks), dim3(default_block_size), 0, 0,
+                           num_slots, as_hip_type(slot_ptrs.get_const_data()),
+                           as_hip_type(contribution_idxs.get_const_data()),
+                           as_hip_type(contributions.get_const_data()),
+                           as_hip_type(mtx->get_values()));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL);
+
+
 }  // namespace csr
 }  // namespace hip
 }  // namespace kernels
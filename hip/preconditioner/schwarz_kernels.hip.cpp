@@ -0,0 +1,99 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/schwarz_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace hip {
+/**
+ * @brief The Schwarz preconditioner namespace.
+ *
+ * @ingroup schwarz
+ */
+namespace schwarz {
+
+
+template <typename ValueType, typename IndexType>
+void partition(std::shared_ptr<const HipExecutor> exec,
+               const matrix::Csr<ValueType, IndexType> *system_matrix,
+               size_type num_subdomains,
+               Array<IndexType> &block_ptrs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_PARTITION_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void find_subdomains(std::shared_ptr<const HipExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType> *system_matrix,
+                     const Array<IndexType> &block_ptrs, size_type overlap,
+                     Array<IndexType> &subdomain_ptrs,
+                     Array<IndexType> &subdomain_rows) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void factorize(std::shared_ptr<const HipExecutor> exec,
+               const matrix::Csr<ValueType, IndexType> *system_matrix,
+               const Array<IndexType> &subdomain_ptrs,
+               const Array<IndexType> &subdomain_rows,
+               matrix::Csr<ValueType, IndexType> *local_factors)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void apply(std::shared_ptr<const HipExecutor> exec,
+           const Array<IndexType> &block_ptrs,
+           const Array<IndexType> &subdomain_ptrs,
+           const Array<IndexType> &subdomain_rows,
+           const matrix::Csr<ValueType, IndexType> *local_factors,
+           const matrix::Dense<ValueType> *b,
+           matrix::Dense<ValueType> *x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SCHWARZ_APPLY_KERNEL);
+
+
+}  // namespace schwarz
+}  // namespace hip
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,156 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_BASE_BINARY_IO_HPP_
+#define GKO_CORE_BASE_BINARY_IO_HPP_
+
+
+#include <memory>
+#include <ostream>
+#include <string>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+
+
+/**
+ * Writes a CSR matrix to a stream in Ginkgo's binary format.
+ *
+ * The binary format consists of a fixed-size header, which stores a magic
+ * string, the byte order, the format version, the value and index type, the
+ * matrix dimensions and the file offsets of the data sections, followed by
+ * the row pointers, column indexes and values of the matrix, each padded to a
+ * multiple of 64 bytes. Since the data is stored exactly as it is laid out in
+ * memory, it can be loaded by read_binary without any parsing.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written, it needs to be
+ *            opened in binary mode
+ * @param matrix  the matrix to write, it may reside on any executor
+ */
+template <typename ValueType, typename IndexType>
+void write_binary(std::ostream &os,
+                  const matrix::Csr<ValueType, IndexType> *matrix);
+
+
+/**
+ * Specifies how write_compressed_binary stores the values of a matrix.
+ */
+enum class binary_value_storage {
+    /**
+     * The values are stored exactly.
+     */
+    exact,
+    /**
+     * The values are rounded to single precision. Single precision values are
+     * stored unchanged.
+     */
+    single_precision
+};
+
+
+/**
+ * Writes a CSR matrix to a stream in Ginkgo's compressed binary format.
+ *
+ * The rows are grouped into blocks of 1024 rows whose indexes are encoded
+ * independently: for each row, the number of nonzeros is followed by the
+ * differences between consecutive column indexes, where the first column
+ * index is relative to the row index. All numbers are stored as variable
+ * length integers, so the indexes of most matrices take one or two bytes per
+ * nonzero instead of four or eight. A block index stores where the nonzeros
+ * and the encoded indexes of each block start, which allows read_binary to
+ * decode the blocks concurrently. The values follow the indexes, they are
+ * stored either exactly or rounded to single precision.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written, it needs to be
+ *            opened in binary mode
+ * @param matrix  the matrix to write, it may reside on any executor
+ * @param value_storage  how the values are stored
+ */
+template <typename ValueType, typename IndexType>
+void write_compressed_binary(
+    std::ostream &os, const matrix::Csr<ValueType, IndexType> *matrix,
+    binary_value_storage value_storage = binary_value_storage::exact);
+
+
+/**
+ * Reads a CSR matrix stored in Ginkgo's binary format from a file.
+ *
+ * The file is memory-mapped (where the platform supports it). If `exec` is a
+ * host executor, the arrays of the returned matrix point directly into the
+ * mapping, so no data is copied. The row pointers and column indexes are
+ * validated when the matrix is read, which loads their pages from disk; only
+ * the pages of the values are loaded once they are accessed. The mapping is
+ * private, so modifying the matrix does not modify the file. The mapping is
+ * released once the matrix is destroyed. For other executors, the data is
+ * copied from the mapping to the executor.
+ *
+ * Files written by write_compressed_binary are decoded concurrently by
+ * multiple threads, one range of row blocks per thread. Exactly stored values
+ * are still used directly from the mapping on host executors.
+ *
+ * @tparam ValueType  type of matrix values, needs to match the value type
+ *                    stored in the file
+ * @tparam IndexType  type of matrix indexes, needs to match the index type
+ *                    stored in the file
+ *
+ * @param filename  name of the file from which to read the data
+ * @param exec  the executor on which the matrix should be created
+ *
+ * @return the CSR matrix stored in the file
+ *
+ * @throw StreamError  if the file cannot be read, is not a binary file
+ *                     written by a compatible version of Ginkgo, or stores
+ *                     different value or index types
+ *
+ * @note The arrays of a matrix loaded without a copy do not own their memory,
+ *       so they cannot be resized.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary(
+    const std::string &filename, std::shared_ptr<const Executor> exec);
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_BINARY_IO_HPP_
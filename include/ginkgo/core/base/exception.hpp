@@ -466,6 +466,31 @@ public:
 };
 
 
+/**
+ * NumericalBreakdown is thrown if a factorization encounters a pivot it cannot
+ * continue with, e.g. a zero pivot in an LU factorization without pivoting.
+ */
+class NumericalBreakdown : public Error {
+public:
+    /**
+     * Initializes a numerical breakdown error.
+     *
+     * @param file  The name of the offending source file
+     * @param line  The source code line number where the error occurred
+     * @param func  The name of the function where the error occurred
+     * @param row  The row in which the breakdown occurred
+     * @param clarification  An additional message describing the breakdown
+     */
+    NumericalBreakdown(const std::string &file, int line,
+                       const std::string &func, size_type row,
+                       const std::string &clarification)
+        : Error(file, line,
+                func + ": Numerical breakdown in row " + std::to_string(row) +
+                    " : " + clarification)
+    {}
+};
+
+
 /**
  * KernelNotFound is thrown if Ginkgo cannot find a kernel which satisfies the
  * criteria imposed by the input arguments.
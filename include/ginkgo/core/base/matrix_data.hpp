@@ -459,13 +459,50 @@ struct matrix_data {
 
     /**
      * Sorts the nonzero vector so the values follow row-major order.
+     *
+     * Already sorted data is detected in linear time and left untouched.
      */
     void ensure_row_major_order()
     {
-        std::sort(
-            begin(nonzeros), end(nonzeros), [](nonzero_type x, nonzero_type y) {
-                return std::tie(x.row, x.column) < std::tie(y.row, y.column);
-            });
+        auto row_major = [](const nonzero_type &x, const nonzero_type &y) {
+            return std::tie(x.row, x.column) < std::tie(y.row, y.column);
+        };
+        if (!std::is_sorted(begin(nonzeros), end(nonzeros), row_major)) {
+            std::sort(begin(nonzeros), end(nonzeros), row_major);
+        }
+    }
+
+    /**
+     * Sorts the nonzero vector in row-major order and replaces all entries at
+     * the same position by a single entry storing their sum.
+     */
+    void sum_duplicates()
+    {
+        this->ensure_row_major_order();
+        auto out = begin(nonzeros);
+        for (auto it = begin(nonzeros); it != end(nonzeros); ++it) {
+            if (out != begin(nonzeros) && (out - 1)->row == it->row &&
+                (out - 1)->column == it->column) {
+                (out - 1)->value += it->value;
+            } else {
+                *out++ = *it;
+            }
+        }
+        nonzeros.erase(out, end(nonzeros));
+    }
+
+    /**
+     * Removes all entries storing an explicit zero from the nonzero vector.
+     * The relative order of the remaining entries is preserved.
+     */
+    void remove_zeros()
+    {
+        nonzeros.erase(std::remove_if(begin(nonzeros), end(nonzeros),
+                                      [](const nonzero_type &entry) {
+                                          return entry.value ==
+                                                 zero<ValueType>();
+                                      }),
+                       end(nonzeros));
     }
 
 private:
@@ -529,6 +566,102 @@ private:
 };
 
 
+/**
+ * This structure is used as an intermediate data type to store the sparsity
+ * pattern of a sparse matrix.
+ *
+ * It is the index-only counterpart of matrix_data: the pattern is stored as a
+ * sequence of (row_index, column_index) pairs, without any values. This halves
+ * or thirds the memory footprint of the intermediate representation for
+ * consumers which only need the structure of a matrix, like
+ * gko::matrix::SparsityCsr or tools computing matrix statistics.
+ *
+ * @note All Ginkgo functions returning such a structure will return the
+ *       nonzeros sorted in row-major order.
+ * @note All Ginkgo functions that take this structure as input expect that the
+ *       nonzeros are sorted in row-major order.
+ *
+ * @tparam IndexType  type of matrix indexes stored in the structure
+ */
+template <typename IndexType = int32>
+struct matrix_pattern {
+    using index_type = IndexType;
+
+    /**
+     * Type used to store the position of a nonzero.
+     */
+    struct nonzero_type {
+        nonzero_type() = default;
+
+        nonzero_type(index_type r, index_type c) : row(r), column(c) {}
+
+#define GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(_op)       \
+    bool operator _op(const nonzero_type &other) const \
+    {                                                  \
+        return std::tie(this->row, this->column)       \
+            _op std::tie(other.row, other.column);     \
+    }
+
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(==);
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(!=);
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(<);
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(>);
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(<=);
+        GKO_DEFINE_DEFAULT_COMPARE_OPERATOR(>=);
+
+#undef GKO_DEFINE_DEFAULT_COMPARE_OPERATOR
+
+        index_type row;
+        index_type column;
+    };
+
+    /**
+     * Initializes an empty pattern of the given size.
+     *
+     * @param size_  dimensions of the matrix
+     */
+    matrix_pattern(dim<2> size_ = dim<2>{}) : size{size_} {}
+
+    /**
+     * Initializes a pattern from the nonzero positions of a matrix_data
+     * structure.
+     *
+     * @tparam ValueType  type of matrix values stored in `data`
+     *
+     * @param data  the matrix data whose nonzero positions are copied
+     */
+    template <typename ValueType>
+    explicit matrix_pattern(const matrix_data<ValueType, index_type> &data)
+        : size{data.size}
+    {
+        nonzeros.reserve(data.nonzeros.size());
+        for (const auto &nz : data.nonzeros) {
+            nonzeros.emplace_back(nz.row, nz.column);
+        }
+    }
+
+    /**
+     * Size of the matrix.
+     */
+    dim<2> size;
+
+    /**
+     * A vector of the positions of all nonzeros.
+     */
+    std::vector<nonzero_type> nonzeros;
+
+    /**
+     * Sorts the nonzero vector so the positions are in row-major order.
+     */
+    void ensure_row_major_order()
+    {
+        if (!std::is_sorted(begin(nonzeros), end(nonzeros))) {
+            std::sort(begin(nonzeros), end(nonzeros));
+        }
+    }
+};
+
+
 }  // namespace gko
 
 
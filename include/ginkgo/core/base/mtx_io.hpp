@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <istream>
+#include <string>
 
 
 #include <ginkgo/core/base/matrix_data.hpp>
@@ -61,6 +62,78 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_raw(std::istream &is);
 
 
+/**
+ * Reads a matrix stored in matrix market format from a file.
+ *
+ * The file is memory-mapped (where the platform supports it), and the
+ * entries of coordinate files are split into line-aligned chunks which are
+ * parsed concurrently by multiple threads. The result is identical to reading
+ * the file through read_raw(std::istream &).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  name of the file from which to read the data
+ *
+ * @return A matrix_data structure containing the matrix. The nonzero elements
+ *         are sorted in lexicographic order of their (row, colum) indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. Consider using gko::read instead, which also accepts a
+ *       file name in place of the input stream.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_raw(const std::string &filename);
+
+
+/**
+ * Reads the sparsity pattern of a matrix stored in matrix market format from
+ * an input stream.
+ *
+ * Only the coordinates of the entries are parsed, their values are skipped.
+ * Entries implied by a symmetric, skew-symmetric or hermitian storage
+ * modifier are included, as are all positions of a matrix stored in the array
+ * layout. Explicitly stored zeros are part of the pattern.
+ *
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ *
+ * @return A matrix_pattern structure containing the positions of the
+ *         entries, sorted in lexicographic order of their (row, colum)
+ *         indexes.
+ *
+ * @note This is an advanced routine that will return the raw sparsity pattern.
+ *       Consider using gko::read_pattern instead.
+ */
+template <typename IndexType = int32>
+matrix_pattern<IndexType> read_pattern_raw(std::istream &is);
+
+
+/**
+ * Reads the sparsity pattern of a matrix stored in matrix market format from
+ * a file.
+ *
+ * The file is read like in read_raw(const std::string &), but only the
+ * coordinates of the entries are parsed. The result is identical to reading
+ * the file through read_pattern_raw(std::istream &).
+ *
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  name of the file from which to read the data
+ *
+ * @return A matrix_pattern structure containing the positions of the
+ *         entries, sorted in lexicographic order of their (row, colum)
+ *         indexes.
+ *
+ * @note This is an advanced routine that will return the raw sparsity pattern.
+ *       Consider using gko::read_pattern instead, which also accepts a file
+ *       name in place of the input stream.
+ */
+template <typename IndexType = int32>
+matrix_pattern<IndexType> read_pattern_raw(const std::string &filename);
+
+
 /**
  * Specifies the layout type when writing data in matrix market format.
  */
@@ -95,16 +168,43 @@ void write_raw(std::ostream &os, const matrix_data<ValueType, IndexType> &data,
                layout_type layout = layout_type::array);
 
 
+/**
+ * Writes a matrix_data structure to a file in matrix market format.
+ *
+ * The entries of the coordinate layout are formatted concurrently by multiple
+ * threads into separate buffers, which are written to the file in order. The
+ * result is identical to writing the data through
+ * write_raw(std::ostream &, ...).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  name of the file where the data is to be written
+ * @param data  the matrix data to write
+ * @param layout  the layout used in the output
+ *
+ * @note This is an advanced routine that writes the raw matrix data structure.
+ *       If you are trying to write an existing matrix, consider using
+ *       gko::write instead, which also accepts a file name in place of the
+ *       output stream.
+ */
+template <typename ValueType, typename IndexType>
+void write_raw(const std::string &filename,
+               const matrix_data<ValueType, IndexType> &data,
+               layout_type layout = layout_type::array);
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
  * @tparam MatrixType  a ReadableFromMatrixData LinOp type used to store the
  *                     matrix once it's been read from disk.
- * @tparam StreamType  type of stream used to write the data to
+ * @tparam StreamType  type of stream used to read the data from, or a string
+ *                     type holding the name of the file to read
  * @tparam MatrixArgs  additional argument types passed to MatrixType
  *                     constructor
  *
- * @param is  input stream from which to read the data
+ * @param is  input stream or file name from which to read the data
  * @param args  additional arguments passed to MatrixType constructor
  *
  * @return A MatrixType LinOp filled with data from filename
@@ -119,14 +219,43 @@ inline std::unique_ptr<MatrixType> read(StreamType &&is, MatrixArgs &&... args)
 }
 
 
+/**
+ * Reads the sparsity pattern of a matrix stored in matrix market format from
+ * an input stream, without parsing the values of its entries.
+ *
+ * @tparam MatrixType  a LinOp type providing a
+ *                     `read(const matrix_pattern<index_type> &)` method,
+ *                     like gko::matrix::SparsityCsr, used to store the
+ *                     pattern once it's been read from disk.
+ * @tparam StreamType  type of stream used to read the data from, or a string
+ *                     type holding the name of the file to read
+ * @tparam MatrixArgs  additional argument types passed to MatrixType
+ *                     constructor
+ *
+ * @param is  input stream or file name from which to read the data
+ * @param args  additional arguments passed to MatrixType constructor
+ *
+ * @return A MatrixType LinOp filled with the pattern from filename
+ */
+template <typename MatrixType, typename StreamType, typename... MatrixArgs>
+inline std::unique_ptr<MatrixType> read_pattern(StreamType &&is,
+                                                MatrixArgs &&... args)
+{
+    auto mtx = MatrixType::create(std::forward<MatrixArgs>(args)...);
+    mtx->read(read_pattern_raw<typename MatrixType::index_type>(is));
+    return mtx;
+}
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
  * @tparam MatrixType  a ReadableFromMatrixData LinOp type used to store the
  *                     matrix once it's been read from disk.
- * @tparam StreamType  type of stream used to write the data to
+ * @tparam StreamType  type of stream used to write the data to, or a string
+ *                     type holding the name of the file to write
  *
- * @param os  output stream where the data is to be written
+ * @param os  output stream or file name where the data is to be written
  * @param matrix  the matrix to write
  * @param layout  the layout used in the output
  */
@@ -186,6 +186,217 @@ public:
 };
 
 
+namespace detail {
+
+
+/**
+ * Converts a value between two (possibly complex) types with different
+ * precisions, component-wise for complex types.
+ */
+template <typename TargetType, typename SourceType>
+GKO_ATTRIBUTES GKO_INLINE
+    std::enable_if_t<!is_complex_s<TargetType>::value, TargetType>
+    convert_precision(const SourceType &val)
+{
+    return static_cast<TargetType>(val);
+}
+
+template <typename TargetType, typename SourceType>
+GKO_ATTRIBUTES GKO_INLINE
+    std::enable_if_t<is_complex_s<TargetType>::value, TargetType>
+    convert_precision(const SourceType &val)
+{
+    using target_real = remove_complex<TargetType>;
+    return TargetType{static_cast<target_real>(val.real()),
+                      static_cast<target_real>(val.imag())};
+}
+
+
+/**
+ * A reference to a value which is stored in StorageType and read and written
+ * as ArithmeticType.
+ *
+ * @tparam ArithmeticType  type used for arithmetic operations
+ * @tparam StorageType  type used to store the value in memory
+ */
+template <typename ArithmeticType, typename StorageType>
+class reduced_storage_reference {
+public:
+    using arithmetic_type = ArithmeticType;
+    using storage_type = StorageType;
+
+    GKO_ATTRIBUTES constexpr explicit reduced_storage_reference(
+        storage_type *ptr)
+        : ptr_{ptr}
+    {}
+
+    GKO_ATTRIBUTES operator arithmetic_type() const
+    {
+        return convert_precision<arithmetic_type>(*ptr_);
+    }
+
+    GKO_ATTRIBUTES const reduced_storage_reference &operator=(
+        const arithmetic_type &val) const
+    {
+        *ptr_ = convert_precision<storage_type>(val);
+        return *this;
+    }
+
+    GKO_ATTRIBUTES const reduced_storage_reference &operator=(
+        const reduced_storage_reference &other) const
+    {
+        return *this = static_cast<arithmetic_type>(other);
+    }
+
+private:
+    storage_type *ptr_;
+};
+
+
+}  // namespace detail
+
+
+/**
+ * A reduced_row_major accessor is a row_major accessor which stores the values
+ * in a (usually lower precision) StorageType, but reads and writes them as
+ * ArithmeticType. All arithmetic operations are thus performed in
+ * ArithmeticType, while the memory footprint and the memory traffic are
+ * determined by StorageType.
+ *
+ * Accessing an element returns a proxy reference that converts on the fly.
+ *
+ * @tparam Dimensionality  number of dimensions of this accessor (has to be 2)
+ * @tparam ArithmeticType  type of values this accessor returns
+ * @tparam StorageType  type of values stored in memory
+ */
+template <size_type Dimensionality, typename ArithmeticType,
+          typename StorageType>
+class reduced_row_major {
+public:
+    friend class range<reduced_row_major>;
+
+    static_assert(Dimensionality == 2,
+                  "This accessor is only implemented for matrices");
+
+    /**
+     * Type of values returned by the accessor.
+     */
+    using arithmetic_type = ArithmeticType;
+
+    /**
+     * Type of values in the underlying data storage.
+     */
+    using storage_type = StorageType;
+
+    /**
+     * Type of references returned by the accessor.
+     */
+    using reference_type =
+        detail::reduced_storage_reference<arithmetic_type, storage_type>;
+
+    /**
+     * Number of dimensions of the accessor.
+     */
+    static constexpr size_type dimensionality = 2;
+
+protected:
+    /**
+     * Creates a reduced_row_major accessor.
+     *
+     * @param data  pointer to the block of memory containing the data
+     * @param num_row  number of rows of the accessor
+     * @param num_cols  number of columns of the accessor
+     * @param stride  distance (in elements) between starting positions of
+     *                consecutive rows
+     */
+    GKO_ATTRIBUTES constexpr explicit reduced_row_major(storage_type *data,
+                                                        size_type num_rows,
+                                                        size_type num_cols,
+                                                        size_type stride)
+        : data{data}, lengths{num_rows, num_cols}, stride{stride}
+    {}
+
+public:
+    /**
+     * Returns a reference to the data element at position (row, col)
+     *
+     * @param row  row index
+     * @param col  column index
+     *
+     * @return reference to the data element at (row, col)
+     */
+    GKO_ATTRIBUTES constexpr reference_type operator()(size_type row,
+                                                       size_type col) const
+    {
+        return GKO_ASSERT(row < lengths[0]), GKO_ASSERT(col < lengths[1]),
+               reference_type{data + row * stride + col};
+    }
+
+    /**
+     * Returns the sub-range spanning the range (rows, cols)
+     *
+     * @param rows  row span
+     * @param cols  column span
+     *
+     * @return sub-range spanning the range (rows, cols)
+     */
+    GKO_ATTRIBUTES constexpr range<reduced_row_major> operator()(
+        const span &rows, const span &cols) const
+    {
+        return GKO_ASSERT(rows.is_valid()), GKO_ASSERT(cols.is_valid()),
+               GKO_ASSERT(rows <= span{lengths[0]}),
+               GKO_ASSERT(cols <= span{lengths[1]}),
+               range<reduced_row_major>(
+                   data + rows.begin * stride + cols.begin,
+                   rows.end - rows.begin, cols.end - cols.begin, stride);
+    }
+
+    /**
+     * Returns the length in dimension `dimension`.
+     *
+     * @param dimension  a dimension index
+     *
+     * @return length in dimension `dimension`
+     */
+    GKO_ATTRIBUTES constexpr size_type length(size_type dimension) const
+    {
+        return dimension < 2 ? lengths[dimension] : 1;
+    }
+
+    /**
+     * Copies data from another accessor
+     *
+     * @tparam OtherAccessor  type of the other accessor
+     *
+     * @param other  other accessor
+     */
+    template <typename OtherAccessor>
+    GKO_ATTRIBUTES void copy_from(const OtherAccessor &other) const
+    {
+        for (size_type i = 0; i < lengths[0]; ++i) {
+            for (size_type j = 0; j < lengths[1]; ++j) {
+                (*this)(i, j) = static_cast<arithmetic_type>(other(i, j));
+            }
+        }
+    }
+
+    /**
+     * Reference to the underlying data.
+     */
+    storage_type *const data;
+
+    /**
+     * An array of dimension sizes.
+     */
+    const std::array<const size_type, dimensionality> lengths;
+
+    /**
+     * Distance between consecutive rows.
+     */
+    const size_type stride;
+};
+
+
 }  // namespace accessor
 }  // namespace gko
 
@@ -0,0 +1,177 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_FACTORIZATION_CHOLESKY_HPP_
+#define GKO_CORE_FACTORIZATION_CHOLESKY_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * Represents the complete (sparse direct) Cholesky factorization of a sparse
+ * Hermitian positive definite matrix.
+ *
+ * It consists of a lower triangular factor $L$ with $LL^H = A$. Only the
+ * lower triangle of $A$ is accessed, the sparsity pattern of the factor is
+ * however computed from the symmetrized sparsity pattern $\mathcal S(A + A^T)$,
+ * so it is fine to pass the full matrix or only its lower triangle.
+ *
+ * The factorization is computed in two phases: The symbolic phase computes
+ * the elimination forest of $A$ and from it the complete fill-in of $L$. It
+ * also groups chains of rows with the same sparsity pattern and sorts these by
+ * their height in the elimination forest. The numerical phase then factorizes
+ * the rows one at a time, all chains of the same level in parallel, starting
+ * from the leaves.
+ *
+ * @note No fill-reducing reordering is applied, so the matrix should be
+ *       reordered beforehand if the fill-in would be too large.
+ *
+ * @throw NumericalBreakdown  if a diagonal entry of the factor would be the
+ *                            square root of a non-positive or non-finite
+ *                            value, i.e. if the matrix is not positive
+ *                            definite.
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup factor
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Cholesky : public Composition<ValueType> {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+
+    std::shared_ptr<const matrix_type> get_l_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[0]);
+    }
+
+    std::shared_ptr<const matrix_type> get_lt_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[1]);
+    }
+
+    // Remove the possibility of calling `create`, which was enabled by
+    // `Composition`
+    template <typename... Args>
+    static std::unique_ptr<Composition<ValueType>> create(Args &&... args) =
+        delete;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Strategy which will be used by the L matrix. The default value
+         * `nullptr` will result in the strategy `classical`.
+         */
+        std::shared_ptr<typename matrix_type::strategy_type>
+            GKO_FACTORY_PARAMETER_SCALAR(l_strategy, nullptr);
+
+        /**
+         * Strategy which will be used by the L^H matrix. The default value
+         * `nullptr` will result in the strategy `classical`.
+         */
+        std::shared_ptr<typename matrix_type::strategy_type>
+            GKO_FACTORY_PARAMETER_SCALAR(lt_strategy, nullptr);
+
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by row, then by column) in order for the algorithm
+         * to work. If it is known that the matrix will be sorted, this
+         * parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, the factorization might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Cholesky, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    Cholesky(const Factory *factory,
+             std::shared_ptr<const gko::LinOp> system_matrix)
+        : Composition<ValueType>{factory->get_executor()},
+          parameters_{factory->get_parameters()}
+    {
+        if (parameters_.l_strategy == nullptr) {
+            parameters_.l_strategy =
+                std::make_shared<typename matrix_type::classical>();
+        }
+        if (parameters_.lt_strategy == nullptr) {
+            parameters_.lt_strategy =
+                std::make_shared<typename matrix_type::classical>();
+        }
+        generate_l_lt(system_matrix)->move_to(this);
+    }
+
+    /**
+     * Generates the Cholesky factors, which will be returned as a composition
+     * of the lower (first element of the composition) and the upper factor
+     * (second element), which is the conjugate transpose of the lower factor.
+     * The dynamic type of L and L^H is matrix_type.
+     *
+     * @param system_matrix  the source matrix used to generate the factors.
+     *                       @note: system_matrix must be convertible to a Csr
+     *                              Matrix, otherwise, an exception is thrown.
+     * @return  A Composition, containing the Cholesky factors for the given
+     *          system_matrix (first element is L, then L^H)
+     */
+    std::unique_ptr<Composition<ValueType>> generate_l_lt(
+        const std::shared_ptr<const LinOp> &system_matrix) const;
+};
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_CHOLESKY_HPP_
@@ -0,0 +1,119 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_FACTORIZATION_FACTOR_SERIALIZATION_HPP_
+#define GKO_CORE_FACTORIZATION_FACTOR_SERIALIZATION_HPP_
+
+
+#include <istream>
+#include <memory>
+#include <ostream>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * The EnableFactorSerialization mixin adds save() and load() to a
+ * factorization consisting of two Csr factors, so the factors can be written
+ * to disk and restored instead of being generated again.
+ *
+ * The ConcreteFactorization needs to provide a constructor taking only its
+ * factory, which sets up its parameters without generating the factors, and
+ * has to declare the mixin as a friend if that constructor is not public.
+ *
+ * @tparam ConcreteFactorization  the factorization to which save() and load()
+ *                                are added
+ *
+ * @ingroup factor
+ */
+template <typename ConcreteFactorization>
+class EnableFactorSerialization {
+public:
+    /**
+     * Writes the generated factors to a stream in Ginkgo's binary format, so
+     * they can be restored by load() instead of being generated again. The
+     * data is preceded by a checksum of the system matrix.
+     *
+     * @param os  output stream where the data is to be written, it needs to be
+     *            opened in binary mode
+     * @param system_matrix  the matrix the factors were generated from
+     */
+    void save(std::ostream &os, const LinOp *system_matrix) const;
+
+    /**
+     * Restores a factorization written by save().
+     *
+     * @param is  input stream from which to read the data, it needs to be
+     *            opened in binary mode
+     * @param factory  the factory the factors were generated with, its
+     *                 parameters are used for the restored factorization
+     * @param system_matrix  the matrix the factors were generated from
+     *
+     * @return the factorization stored in the stream
+     *
+     * @throw StreamError  if the stream does not contain a factorization of
+     *                     the same kind with the same value and index types,
+     *                     or if it was generated from a different system
+     *                     matrix
+     */
+    template <typename Factory>
+    static std::unique_ptr<ConcreteFactorization> load(
+        std::istream &is, const Factory *factory, const LinOp *system_matrix)
+    {
+        std::unique_ptr<ConcreteFactorization> result{
+            new ConcreteFactorization{factory}};
+        result->read_factors(is, system_matrix);
+        return result;
+    }
+
+protected:
+    /**
+     * Replaces the factors of this factorization by the ones written by
+     * save().
+     *
+     * @param is  the stream from which to read the factors
+     * @param system_matrix  the matrix the factors were generated from
+     */
+    void read_factors(std::istream &is, const LinOp *system_matrix);
+};
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_FACTOR_SERIALIZATION_HPP_
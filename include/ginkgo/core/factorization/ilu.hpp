@@ -37,9 +37,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/factorization/factor_serialization.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
@@ -68,7 +70,10 @@ namespace factorization {
  */
 template <typename ValueType = gko::default_precision,
           typename IndexType = gko::int32>
-class Ilu : public Composition<ValueType> {
+class Ilu : public Composition<ValueType>,
+            public EnableFactorSerialization<Ilu<ValueType, IndexType>> {
+    friend class EnableFactorSerialization<Ilu>;
+
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -88,6 +93,26 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with new values, but the same
+     * sparsity pattern as the matrix this factorization was generated from.
+     *
+     * Computing the row pointers of L and U and allocating the factors is
+     * skipped, the values of the existing factors are overwritten in place.
+     *
+     * @param system_matrix  the matrix with the new values. It needs to have
+     *                       the same sparsity pattern as the system matrix
+     *                       the factors were generated from.
+     *
+     * @throw ValueMismatch  if the sparsity pattern of system_matrix differs
+     *                       from the one of the factors
+     *
+     * @note The factors are modified in place, so all references to them,
+     *       e.g. obtained through get_l_factor() and get_u_factor() or held
+     *       by a solver using this factorization, observe the new values.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix);
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -114,9 +139,11 @@ public:
     GKO_ENABLE_BUILD_METHOD(Factory);
 
 protected:
-    Ilu(const Factory *factory, std::shared_ptr<const gko::LinOp> system_matrix)
+    explicit Ilu(const Factory *factory)
         : Composition<ValueType>{factory->get_executor()},
-          parameters_{factory->get_parameters()}
+          parameters_{factory->get_parameters()},
+          pattern_row_ptrs_{factory->get_executor()->get_master()},
+          pattern_col_idxs_{factory->get_executor()->get_master()}
     {
         if (parameters_.l_strategy == nullptr) {
             parameters_.l_strategy =
@@ -126,6 +153,11 @@ protected:
             parameters_.u_strategy =
                 std::make_shared<typename matrix_type::classical>();
         }
+    }
+
+    Ilu(const Factory *factory, std::shared_ptr<const gko::LinOp> system_matrix)
+        : Ilu{factory}
+    {
         generate_l_u(system_matrix)->move_to(this);
     }
 
@@ -142,7 +174,13 @@ protected:
      *          given system_matrix (first element is L, then U)
      */
     std::unique_ptr<Composition<ValueType>> generate_l_u(
-        const std::shared_ptr<const LinOp> &system_matrix) const;
+        const std::shared_ptr<const LinOp> &system_matrix);
+
+private:
+    // the pattern of the system matrix (including the added diagonal) the
+    // factors were generated from, stored on the master executor
+    Array<IndexType> pattern_row_ptrs_;
+    Array<IndexType> pattern_col_idxs_;
 };
 
 
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/factorization/factor_serialization.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
@@ -93,7 +94,10 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIct : public Composition<ValueType> {
+class ParIct : public Composition<ValueType>,
+               public EnableFactorSerialization<ParIct<ValueType, IndexType>> {
+    friend class EnableFactorSerialization<ParIct>;
+
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -113,6 +117,21 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factor for a matrix with new values, but the same
+     * sparsity pattern as the matrix this factorization was generated from.
+     *
+     * The sparsity pattern of L is kept fixed, so no candidates are added and
+     * no entries are removed. Starting from the current values of the factor,
+     * `iterations` fixed-point sweeps are executed with the new values,
+     * overwriting the values of the existing factors in place.
+     *
+     * @param system_matrix  the matrix with the new values. It needs to have
+     *                       the same size as the system matrix the factors
+     *                       were generated from.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix);
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -213,8 +232,7 @@ public:
     GKO_ENABLE_BUILD_METHOD(Factory);
 
 protected:
-    explicit ParIct(const Factory *factory,
-                    std::shared_ptr<const LinOp> system_matrix)
+    explicit ParIct(const Factory *factory)
         : Composition<ValueType>(factory->get_executor()),
           parameters_{factory->get_parameters()}
     {
@@ -226,6 +244,12 @@ protected:
             parameters_.lt_strategy =
                 std::make_shared<typename matrix_type::classical>();
         }
+    }
+
+    explicit ParIct(const Factory *factory,
+                    std::shared_ptr<const LinOp> system_matrix)
+        : ParIct{factory}
+    {
         generate_l_lt(std::move(system_matrix))->move_to(this);
     }
 
@@ -37,9 +37,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/factorization/factor_serialization.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
@@ -92,7 +94,10 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlu : public Composition<ValueType> {
+class ParIlu : public Composition<ValueType>,
+               public EnableFactorSerialization<ParIlu<ValueType, IndexType>> {
+    friend class EnableFactorSerialization<ParIlu>;
+
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -113,6 +118,28 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with new values, but the same
+     * sparsity pattern as the matrix this factorization was generated from.
+     *
+     * All pattern-dependent setup steps (sorting of the factor pattern,
+     * adding diagonal elements to the factors, computing the row pointers of
+     * L and U and allocating the factors) are skipped, and the values of the
+     * existing factors are overwritten in place.
+     *
+     * @param system_matrix  the matrix with the new values. It needs to have
+     *                       the same sparsity pattern as the system matrix
+     *                       the factors were generated from.
+     *
+     * @throw ValueMismatch  if the sparsity pattern of system_matrix differs
+     *                       from the one of the factors
+     *
+     * @note The factors are modified in place, so all references to them,
+     *       e.g. obtained through get_l_factor() and get_u_factor() or held
+     *       by a solver using this factorization, observe the new values.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix);
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -166,10 +193,11 @@ public:
     GKO_ENABLE_BUILD_METHOD(Factory);
 
 protected:
-    explicit ParIlu(const Factory *factory,
-                    std::shared_ptr<const LinOp> system_matrix)
+    explicit ParIlu(const Factory *factory)
         : Composition<ValueType>(factory->get_executor()),
-          parameters_{factory->get_parameters()}
+          parameters_{factory->get_parameters()},
+          pattern_row_ptrs_{factory->get_executor()->get_master()},
+          pattern_col_idxs_{factory->get_executor()->get_master()}
     {
         if (parameters_.l_strategy == nullptr) {
             parameters_.l_strategy =
@@ -179,6 +207,12 @@ protected:
             parameters_.u_strategy =
                 std::make_shared<typename u_matrix_type::classical>();
         }
+    }
+
+    explicit ParIlu(const Factory *factory,
+                    std::shared_ptr<const LinOp> system_matrix)
+        : ParIlu{factory}
+    {
         generate_l_u(system_matrix, parameters_.skip_sorting,
                      parameters_.l_strategy, parameters_.u_strategy)
             ->move_to(this);
@@ -204,8 +238,13 @@ protected:
     std::unique_ptr<Composition<ValueType>> generate_l_u(
         const std::shared_ptr<const LinOp> &system_matrix, bool skip_sorting,
         std::shared_ptr<typename l_matrix_type::strategy_type> l_strategy,
-        std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy)
-        const;
+        std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy);
+
+private:
+    // the pattern of the sorted system matrix (including the added diagonal)
+    // the factors were generated from, stored on the master executor
+    Array<IndexType> pattern_row_ptrs_;
+    Array<IndexType> pattern_col_idxs_;
 };
 
 
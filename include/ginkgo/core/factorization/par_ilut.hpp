@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/factorization/factor_serialization.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
@@ -96,7 +97,10 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlut : public Composition<ValueType> {
+class ParIlut : public Composition<ValueType>,
+                public EnableFactorSerialization<ParIlut<ValueType, IndexType>> {
+    friend class EnableFactorSerialization<ParIlut>;
+
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -117,6 +121,21 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with new values, but the same
+     * sparsity pattern as the matrix this factorization was generated from.
+     *
+     * The sparsity pattern of L and U is kept fixed, so no candidates are
+     * added and no entries are removed. Starting from the current values of
+     * the factors, `iterations` fixed-point sweeps are executed with the new
+     * values, overwriting the values of the existing factors in place.
+     *
+     * @param system_matrix  the matrix with the new values. It needs to have
+     *                       the same size as the system matrix the factors
+     *                       were generated from.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix);
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -218,8 +237,7 @@ public:
     GKO_ENABLE_BUILD_METHOD(Factory);
 
 protected:
-    explicit ParIlut(const Factory *factory,
-                     std::shared_ptr<const LinOp> system_matrix)
+    explicit ParIlut(const Factory *factory)
         : Composition<ValueType>(factory->get_executor()),
           parameters_{factory->get_parameters()}
     {
@@ -231,6 +249,12 @@ protected:
             parameters_.u_strategy =
                 std::make_shared<typename u_matrix_type::classical>();
         }
+    }
+
+    explicit ParIlut(const Factory *factory,
+                     std::shared_ptr<const LinOp> system_matrix)
+        : ParIlut{factory}
+    {
         generate_l_u(std::move(system_matrix))->move_to(this);
     }
 
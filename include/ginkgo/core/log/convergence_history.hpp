@@ -0,0 +1,213 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_LOG_CONVERGENCE_HISTORY_HPP_
+#define GKO_CORE_LOG_CONVERGENCE_HISTORY_HPP_
+
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * ConvergenceHistory is a Logger which records the residual norm of every
+ * iteration of a solver and projects how many more iterations the solver
+ * needs to reach a given residual reduction. The projection can be queried
+ * from another thread while the solver is running, e.g. to abort solves which
+ * will not meet a deadline.
+ *
+ * The logger listens to the `iteration_complete` event. The residual norm is
+ * taken from the event if the solver provides it, otherwise it is computed
+ * from the residual into a preallocated vector. No vectors are cloned. For
+ * multiple right-hand sides, the largest residual norm of all columns is
+ * recorded, since the slowest column determines when the solver finishes.
+ *
+ * The history is stored in a ring buffer of fixed capacity, so only the last
+ * iterations are kept for long solves. The convergence rate is an exponential
+ * moving average of the residual norm reduction per iteration, which smooths
+ * out the irregular convergence of methods like BiCGSTAB or CGS. An event
+ * with iteration 0 starts a new solve and clears the previous history.
+ *
+ * @tparam ValueType  the value type of the residual vectors
+ *
+ * @ingroup log
+ */
+template <typename ValueType = default_precision>
+class ConvergenceHistory : public Logger {
+public:
+    using value_type = ValueType;
+    using absolute_type = remove_complex<ValueType>;
+
+    /**
+     * A recorded iteration.
+     */
+    struct entry {
+        /** The iteration number */
+        size_type iteration;
+        /** The (largest) residual norm after this iteration */
+        absolute_type residual_norm;
+        /** Time since the start of the solve in nanoseconds */
+        int64 time;
+    };
+
+    void on_iteration_complete(
+        const LinOp *solver, const size_type &num_iterations,
+        const LinOp *residual, const LinOp *solution = nullptr,
+        const LinOp *residual_norm = nullptr) const override;
+
+    /**
+     * Returns the recorded iterations of the current solve, oldest first.
+     *
+     * @return the recorded iterations
+     */
+    std::vector<entry> get_history() const;
+
+    /**
+     * Returns the number of the last recorded iteration.
+     *
+     * @return the number of iterations
+     */
+    size_type get_num_iterations() const;
+
+    /**
+     * Returns the residual norm of the first iteration of the current solve.
+     *
+     * @return the initial residual norm
+     */
+    absolute_type get_initial_residual_norm() const;
+
+    /**
+     * Returns the residual norm of the last recorded iteration.
+     *
+     * @return the residual norm
+     */
+    absolute_type get_residual_norm() const;
+
+    /**
+     * Returns the smoothed factor by which the residual norm is reduced per
+     * iteration. Values smaller than one mean the solver converges.
+     *
+     * @return the smoothed convergence rate, or 1 if less than two iterations
+     *         were recorded
+     */
+    absolute_type get_convergence_rate() const;
+
+    /**
+     * Returns the number of iterations the solver needs, at the current
+     * convergence rate, to reduce the initial residual norm by the reduction
+     * factor.
+     *
+     * @return the projected number of remaining iterations, or the largest
+     *         representable value if the solver does not converge
+     */
+    size_type get_projected_iterations() const;
+
+    /**
+     * Returns the time the solver needs for the projected remaining
+     * iterations, based on the average time per recorded iteration.
+     *
+     * @return the projected remaining time, or the largest representable
+     *         duration if the solver does not converge
+     */
+    std::chrono::nanoseconds get_projected_time() const;
+
+    /**
+     * Creates a ConvergenceHistory logger.
+     *
+     * @param exec  the executor
+     * @param reduction_factor  the targeted reduction of the initial residual
+     *                          norm, used for the projections
+     * @param max_history  the number of iterations kept in the history
+     * @param smoothing  the weight of the newest iteration in the moving
+     *                   average of the convergence rate, in (0, 1]
+     * @param enabled_events  the events enabled for this logger
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<ConvergenceHistory> create(
+        std::shared_ptr<const Executor> exec,
+        absolute_type reduction_factor = 1e-8, size_type max_history = 1024,
+        absolute_type smoothing = 0.1,
+        const mask_type &enabled_events = Logger::iteration_complete_mask)
+    {
+        return std::unique_ptr<ConvergenceHistory>(
+            new ConvergenceHistory(exec, reduction_factor, max_history,
+                                   smoothing, enabled_events));
+    }
+
+protected:
+    explicit ConvergenceHistory(
+        std::shared_ptr<const gko::Executor> exec,
+        absolute_type reduction_factor = 1e-8, size_type max_history = 1024,
+        absolute_type smoothing = 0.1,
+        const mask_type &enabled_events = Logger::iteration_complete_mask);
+
+private:
+    using NormVector = matrix::Dense<absolute_type>;
+
+    absolute_type get_max_norm(const LinOp *residual,
+                               const LinOp *residual_norm) const;
+
+    size_type get_projected_iterations_impl() const;
+
+    absolute_type reduction_factor_;
+    absolute_type smoothing_;
+    mutable std::mutex mutex_;
+    mutable std::vector<entry> history_;
+    mutable size_type num_entries_{};
+    mutable absolute_type initial_norm_{};
+    /* moving average of the log of the reduction per iteration */
+    mutable absolute_type log_rate_{};
+    mutable bool has_rate_{};
+    mutable std::chrono::steady_clock::time_point start_time_;
+    mutable std::unique_ptr<NormVector> norm_;
+    mutable std::unique_ptr<NormVector> host_norm_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_CONVERGENCE_HISTORY_HPP_
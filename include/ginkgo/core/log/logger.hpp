@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 
 
+#include <ginkgo/config.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/base/utils.hpp>
 
@@ -450,6 +451,13 @@ public:                                                              \
     static constexpr mask_type criterion_events_mask =
         criterion_check_started_mask | criterion_check_completed_mask;
 
+    /**
+     * Returns the events enabled for this Logger.
+     *
+     * @return the mask of the enabled events
+     */
+    mask_type get_enabled_events() const noexcept { return enabled_events_; }
+
 protected:
     /**
      * Constructor for a Logger object.
@@ -510,6 +518,12 @@ public:
  * to enable logging. All the received events are passed to the loggers this
  * class contains.
  *
+ * The class keeps the combined mask of the events enabled by its loggers, so
+ * events which no logger is interested in (in particular all events of
+ * objects without loggers) return immediately without any virtual call. If
+ * Ginkgo is configured with `GINKGO_DISABLE_LOGGING`, the events are removed
+ * at compile time and attached loggers are never called.
+ *
  * @tparam ConcreteLoggable  the object being logged [CRTP parameter]
  *
  * @tparam PolymorphicBase  the polymorphic base of this class. By default
@@ -522,6 +536,7 @@ class EnableLogging : public Loggable {
 public:
     void add_logger(std::shared_ptr<const Logger> logger) override
     {
+        enabled_events_ |= logger->get_enabled_events();
         loggers_.push_back(logger);
     }
 
@@ -533,6 +548,10 @@ public:
                            });
         if (idx != end(loggers_)) {
             loggers_.erase(idx);
+            enabled_events_ = 0;
+            for (const auto &l : loggers_) {
+                enabled_events_ |= l->get_enabled_events();
+            }
         } else {
             throw OutOfBoundsError(__FILE__, __LINE__, loggers_.size(),
                                    loggers_.size());
@@ -540,15 +559,27 @@ public:
     }
 
 protected:
+#ifdef GINKGO_DISABLE_LOGGING
+    template <size_type Event, typename... Params>
+    void log(Params &&...) const
+    {}
+#else
     template <size_type Event, typename... Params>
     void log(Params &&... params) const
     {
-        for (auto &logger : loggers_) {
-            logger->template on<Event>(std::forward<Params>(params)...);
+        if (enabled_events_ & (Logger::mask_type{1} << Event)) {
+            for (auto &logger : loggers_) {
+                logger->template on<Event>(std::forward<Params>(params)...);
+            }
         }
     }
+#endif  // GINKGO_DISABLE_LOGGING
 
     std::vector<std::shared_ptr<const Logger>> loggers_;
+
+private:
+    /* union of the events enabled by the loggers in loggers_ */
+    Logger::mask_type enabled_events_{};
 };
 
 
@@ -0,0 +1,209 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_LOG_PERF_COUNTERS_HPP_
+#define GKO_CORE_LOG_PERF_COUNTERS_HPP_
+
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * PerfCounters is a Logger which reads hardware performance counters around
+ * every operation and aggregates them per operation (kernel) name. It uses
+ * the Linux `perf_event_open` interface directly, so no additional library is
+ * required.
+ *
+ * For every operation, the logger collects the number of calls, the elapsed
+ * time, the CPU cycles and instructions, the last-level cache references and
+ * misses, and the number of bytes transferred from and to main memory. The
+ * memory traffic is measured by the memory controller (uncore) counters if
+ * they are accessible, otherwise it is estimated as one cache line per
+ * last-level cache miss. Note that the uncore counters count the traffic of
+ * all processes running on the machine. Together, these values tell whether
+ * a kernel is limited by the memory bandwidth or by latency and instruction
+ * throughput.
+ *
+ * The core counters are opened on every CPU, so they include all threads,
+ * e.g. OpenMP worker threads that already existed before the logger was
+ * created, but also other processes running on the same CPUs. This requires
+ * a `perf_event_paranoid` level of at most 0. Otherwise, the core counters
+ * only count the thread which created the logger and the threads it creates
+ * afterwards. In that case, create the logger before the first OpenMP kernel
+ * runs to include the OpenMP worker threads. Counters which cannot be opened
+ * at all (e.g. because of the `perf_event_paranoid` setting or on other
+ * platforms than Linux) are reported as zero, see has_core_counters() and
+ * has_uncore_counters().
+ *
+ * @note The logger synchronizes the executor before and after every
+ *       operation. Operations running on GPUs are not measured by the CPU
+ *       counters, only their elapsed time is meaningful.
+ *
+ * @ingroup log
+ */
+class PerfCounters : public Logger {
+public:
+    /**
+     * The counters aggregated over all calls of an operation.
+     */
+    struct kernel_counters {
+        /** Number of completed calls */
+        size_type num_calls{};
+        /** Elapsed time in nanoseconds */
+        int64 time{};
+        /** CPU cycles */
+        uint64 cycles{};
+        /** Retired instructions */
+        uint64 instructions{};
+        /** Last-level cache references */
+        uint64 llc_references{};
+        /** Last-level cache misses */
+        uint64 llc_misses{};
+        /** Bytes read from and written to main memory */
+        uint64 memory_bytes{};
+    };
+
+    /* Operation events */
+    void on_operation_launched(const Executor *exec,
+                               const Operation *operation) const override;
+
+    void on_operation_completed(const Executor *exec,
+                                const Operation *operation) const override;
+
+    /**
+     * Returns whether the per-thread counters (cycles, instructions and
+     * last-level cache events) could be opened.
+     *
+     * @return true if the core counters are available
+     */
+    bool has_core_counters() const noexcept;
+
+    /**
+     * Returns whether the memory controller counters could be opened. If not,
+     * the memory traffic is estimated from the last-level cache misses.
+     *
+     * @return true if the uncore counters are available
+     */
+    bool has_uncore_counters() const noexcept;
+
+    /**
+     * Returns the aggregated counters of every operation name.
+     *
+     * @return a map from the operation name to its counters
+     */
+    std::map<std::string, kernel_counters> get_counters() const;
+
+    /**
+     * Discards all aggregated counters.
+     */
+    void reset();
+
+    /**
+     * Writes a table of the aggregated counters, together with the derived
+     * instructions per cycle, cache miss rate and memory bandwidth of every
+     * operation.
+     *
+     * @param os  the output stream
+     */
+    void write(std::ostream &os) const;
+
+    /**
+     * Creates a PerfCounters logger.
+     *
+     * @param exec  the executor
+     * @param enabled_events  the events enabled for this logger
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<PerfCounters> create(
+        std::shared_ptr<const Executor> exec,
+        const mask_type &enabled_events = operation_events_mask)
+    {
+        return std::unique_ptr<PerfCounters>(
+            new PerfCounters(exec, enabled_events));
+    }
+
+    ~PerfCounters();
+
+protected:
+    explicit PerfCounters(
+        std::shared_ptr<const gko::Executor> exec,
+        const mask_type &enabled_events = operation_events_mask);
+
+private:
+    /* cycles, instructions, LLC references, LLC misses, memory bytes */
+    static constexpr int num_counters = 5;
+
+    using counter_values = std::array<uint64, num_counters>;
+
+    struct snapshot {
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+        counter_values values;
+    };
+
+    counter_values read_counters() const;
+
+    /* file descriptors of the core counters, one per CPU or a single one for
+     * the calling thread, empty if not available */
+    std::array<std::vector<int>, num_counters - 1> core_fds_;
+    /* file descriptors of the memory controller read and write counters */
+    std::vector<int> uncore_fds_;
+    mutable std::mutex mutex_;
+    /* the running operations of every thread */
+    mutable std::map<std::thread::id, std::vector<snapshot>> open_;
+    mutable std::map<std::string, kernel_counters> counters_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_PERF_COUNTERS_HPP_
@@ -0,0 +1,266 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_LOG_PROFILER_HPP_
+#define GKO_CORE_LOG_PROFILER_HPP_
+
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * Profiler is a Logger which records the time spent in each operation, LinOp
+ * apply, LinOp generation and copy, and exports the result as a Chrome trace
+ * (viewable in `chrome://tracing` or Perfetto) or as folded stacks for
+ * flame graph tools.
+ *
+ * The profiler is designed to be left enabled in production runs: every
+ * thread records its ranges into its own fixed-size ring buffer without
+ * locking, and only stores the operation's name pointer or the LinOp's type
+ * information. Demangling and formatting only happen when the results are
+ * written. Once a ring buffer is full, the oldest ranges of this thread are
+ * overwritten.
+ *
+ * Ranges are nested according to the order of the events, so an operation
+ * launched from within a LinOp apply is a child of this apply. For applies of
+ * matrix formats with dense vectors, the profiler estimates the number of
+ * bytes moved and floating point operations, which together with the
+ * duration allow a roofline analysis. Copies report the number of bytes
+ * copied.
+ *
+ * @note On executors which run operations asynchronously, the profiler
+ *       synchronizes the executor at the beginning and end of each range to
+ *       obtain meaningful timings.
+ *
+ * @ingroup log
+ */
+class Profiler : public Logger {
+public:
+    /**
+     * The kind of a profiled range.
+     */
+    enum class range_kind : uint8 { operation, apply, generate, copy };
+
+    /**
+     * A completed profiled range.
+     */
+    struct range {
+        /** Name of the operation, or nullptr if `type` is used */
+        const char *name;
+        /** Dynamic type of the LinOp(Factory), or nullptr if `name` is used */
+        const std::type_info *type;
+        range_kind kind;
+        /** Index of the thread which recorded the range */
+        uint32 thread;
+        /** Nesting depth of the range within its thread */
+        uint32 depth;
+        /** Start time in nanoseconds since the creation of the profiler */
+        int64 start;
+        /** End time in nanoseconds since the creation of the profiler */
+        int64 end;
+        /** Estimated number of bytes read and written, 0 if unknown */
+        size_type bytes;
+        /** Estimated number of floating point operations, 0 if unknown */
+        size_type flops;
+    };
+
+    /**
+     * Default mask of the events recorded by the profiler.
+     */
+    static constexpr mask_type profiler_events_mask =
+        operation_events_mask | linop_events_mask | linop_factory_events_mask |
+        copy_started_mask | copy_completed_mask;
+
+    /* Executor events */
+    void on_copy_started(const Executor *from, const Executor *to,
+                         const uintptr &location_from,
+                         const uintptr &location_to,
+                         const size_type &num_bytes) const override;
+
+    void on_copy_completed(const Executor *from, const Executor *to,
+                           const uintptr &location_from,
+                           const uintptr &location_to,
+                           const size_type &num_bytes) const override;
+
+    /* Operation events */
+    void on_operation_launched(const Executor *exec,
+                               const Operation *operation) const override;
+
+    void on_operation_completed(const Executor *exec,
+                                const Operation *operation) const override;
+
+    /* LinOp events */
+    void on_linop_apply_started(const LinOp *A, const LinOp *b,
+                                const LinOp *x) const override;
+
+    void on_linop_apply_completed(const LinOp *A, const LinOp *b,
+                                  const LinOp *x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp *A, const LinOp *alpha,
+                                         const LinOp *b, const LinOp *beta,
+                                         const LinOp *x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp *A, const LinOp *alpha,
+                                           const LinOp *b, const LinOp *beta,
+                                           const LinOp *x) const override;
+
+    /* LinOpFactory events */
+    void on_linop_factory_generate_started(const LinOpFactory *factory,
+                                           const LinOp *input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory *factory, const LinOp *input,
+        const LinOp *output) const override;
+
+    /**
+     * Returns the recorded ranges of all threads, ordered by thread and start
+     * time.
+     *
+     * @note This must not be called while other threads are logging events
+     *       to this profiler.
+     *
+     * @return the recorded ranges
+     */
+    std::vector<range> get_ranges() const;
+
+    /**
+     * Returns the number of ranges that were overwritten because a ring
+     * buffer was full.
+     *
+     * @return the number of dropped ranges
+     */
+    size_type get_num_dropped_ranges() const;
+
+    /**
+     * Returns the human-readable name of a range.
+     *
+     * @param r  the range
+     *
+     * @return the name of the operation or the demangled LinOp type
+     */
+    static std::string get_range_name(const range &r);
+
+    /**
+     * Writes the recorded ranges in the Chrome trace event format. The
+     * estimated bytes and flops are added as arguments of each event.
+     *
+     * @param os  the output stream
+     */
+    void write_chrome_trace(std::ostream &os) const;
+
+    /**
+     * Writes the recorded ranges as folded stacks, i.e. one line
+     * `outer;inner;innermost <self time in ns>` per call stack, which can be
+     * processed by flame graph tools.
+     *
+     * @param os  the output stream
+     */
+    void write_folded_stacks(std::ostream &os) const;
+
+    /**
+     * Creates a Profiler logger.
+     *
+     * @param exec  the executor
+     * @param ring_capacity  the number of ranges each thread can store before
+     *                       the oldest ones are overwritten
+     * @param enabled_events  the events enabled for this logger
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<Profiler> create(
+        std::shared_ptr<const Executor> exec, size_type ring_capacity = 65536,
+        const mask_type &enabled_events = profiler_events_mask)
+    {
+        return std::unique_ptr<Profiler>(
+            new Profiler(exec, ring_capacity, enabled_events));
+    }
+
+protected:
+    explicit Profiler(std::shared_ptr<const gko::Executor> exec,
+                      size_type ring_capacity = 65536,
+                      const mask_type &enabled_events = profiler_events_mask);
+
+private:
+    struct open_range {
+        const char *name;
+        const std::type_info *type;
+        range_kind kind;
+        int64 start;
+    };
+
+    /* The ranges recorded by a single thread, only written by this thread */
+    struct thread_buffer {
+        uint32 thread;
+        std::vector<range> ring;
+        std::atomic<size_type> num_ranges{};
+        std::vector<open_range> open;
+    };
+
+    thread_buffer &get_thread_buffer() const;
+
+    int64 now() const;
+
+    void begin(const char *name, const std::type_info *type,
+               range_kind kind) const;
+
+    void end(size_type bytes = 0, size_type flops = 0) const;
+
+    /* Used to tell apart profilers in the thread-local buffer cache */
+    uint64 id_;
+    size_type ring_capacity_;
+    std::chrono::steady_clock::time_point start_time_;
+    mutable std::mutex mutex_;
+    mutable std::vector<std::pair<std::thread::id,
+                                  std::unique_ptr<thread_buffer>>>
+        buffers_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_PROFILER_HPP_
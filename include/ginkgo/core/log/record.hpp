@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_LOG_RECORD_HPP_
 
 
+#include <array>
 #include <deque>
 #include <memory>
 
@@ -228,6 +229,12 @@ struct criterion_data {
  * events, all parameters are cloned. If it is sufficient to clone one
  * parameter, consider implementing a specific logger for this. In addition, it
  * is advised to tune the history size in order to control memory overhead.
+ *
+ * To keep the overhead bounded in long running applications, the history size
+ * limits the number of stored events per event type, only every n-th event of
+ * each type can be recorded by setting a sampling interval, and the residual
+ * and solution vectors of the `check` and `iteration_complete` events can be
+ * replaced by the residual norm.
  */
 class Record : public Logger {
 public:
@@ -381,6 +388,12 @@ public:
      *                     user. By default 0 is used, which means unlimited
      *                     storage. It is advised to control this to reduce
      *                     memory overhead of this logger.
+     * @param sampling_interval  only every `sampling_interval`-th event of each
+     *                           type is recorded, starting with the first one
+     * @param store_vectors  whether the residual and solution vectors of the
+     *                       `check` and `iteration_complete` events are
+     *                       cloned. If false, only the residual norm is stored,
+     *                       computed from the residual if necessary.
      *
      * @return an std::unique_ptr to the the constructed object
      *
@@ -391,10 +404,13 @@ public:
     static std::unique_ptr<Record> create(
         std::shared_ptr<const Executor> exec,
         const mask_type &enabled_events = Logger::all_events_mask,
-        size_type max_storage = 1)
+        size_type max_storage = 1, size_type sampling_interval = 1,
+        bool store_vectors = true)
     {
-        return std::unique_ptr<Record>(
-            new Record(exec, enabled_events, max_storage));
+        return std::unique_ptr<Record>(new Record(exec, enabled_events,
+                                                  max_storage,
+                                                  sampling_interval,
+                                                  store_vectors));
     }
 
     /**
@@ -420,13 +436,33 @@ protected:
      *                     user. By default 0 is used, which means unlimited
      *                     storage. It is advised to control this to reduce
      *                     memory overhead of this logger.
+     * @param sampling_interval  only every `sampling_interval`-th event of each
+     *                           type is recorded
+     * @param store_vectors  whether residual and solution vectors are cloned
      */
     explicit Record(std::shared_ptr<const gko::Executor> exec,
                     const mask_type &enabled_events = Logger::all_events_mask,
-                    size_type max_storage = 0)
-        : Logger(exec, enabled_events), max_storage_{max_storage}
+                    size_type max_storage = 0, size_type sampling_interval = 1,
+                    bool store_vectors = true)
+        : Logger(exec, enabled_events),
+          max_storage_{max_storage},
+          sampling_interval_{sampling_interval > 0 ? sampling_interval : 1},
+          store_vectors_{store_vectors}
     {}
 
+    /**
+     * Counts an event and decides whether it is recorded according to the
+     * sampling interval.
+     *
+     * @param event  the id of the event
+     *
+     * @return whether the event should be recorded
+     */
+    bool is_sampled(size_type event) const
+    {
+        return num_events_[event]++ % sampling_interval_ == 0;
+    }
+
     /**
      * Helper function which appends an object to a deque
      *
@@ -447,6 +483,9 @@ protected:
 private:
     mutable logged_data data_{};
     size_type max_storage_{};
+    size_type sampling_interval_{1};
+    bool store_vectors_{true};
+    mutable std::array<size_type, event_count_max> num_events_{};
 };
 
 
@@ -714,6 +714,80 @@ public:
      */
     bool is_sorted_by_column_index() const;
 
+    /**
+     * A precomputed mapping from a fixed sequence of value contributions, e.g.
+     * the element-by-element order of a finite element assembly, to the
+     * stored entries of a Csr matrix.
+     *
+     * The mapping is stored grouped by stored entry: the indexes of the
+     * contributions to the `i`-th stored entry are stored in ascending order
+     * in `contribution_idxs[slot_ptrs[i]:slot_ptrs[i + 1]]`, which makes
+     * updating the values race-free and deterministic.
+     *
+     * @see Csr::build_value_map
+     */
+    struct value_map {
+        /** Row pointer-like offsets into contribution_idxs per stored entry */
+        Array<index_type> slot_ptrs;
+        /** Indexes of the contributions, grouped by stored entry */
+        Array<index_type> contribution_idxs;
+    };
+
+    /**
+     * Computes the mapping from a sequence of contribution positions to the
+     * stored entries of this matrix. Multiple contributions may map to the
+     * same entry, and entries without any contribution are allowed.
+     *
+     * A permuted value array, i.e. the values of all stored entries in a
+     * different order, is the special case of each entry receiving exactly
+     * one contribution.
+     *
+     * @param rows  the row indexes of the contributions
+     * @param cols  the column indexes of the contributions
+     *
+     * @return the mapping, stored on the executor of this matrix
+     *
+     * @throw OutOfBoundsError  if a row or column index lies outside the
+     *                          matrix
+     * @throw ValueMismatch  if the arrays have different sizes, or if a
+     *                       position is not part of the sparsity pattern
+     */
+    value_map build_value_map(const Array<index_type> &rows,
+                              const Array<index_type> &cols) const;
+
+    /**
+     * Overwrites the values of the matrix with the sum of the contributions
+     * mapped to each stored entry, entries without contributions are set to
+     * zero. The sparsity pattern is unchanged, so the strategy and its
+     * precomputed data stay valid. Objects generated from the matrix, e.g.
+     * factorizations or a Jacobi preconditioner, can be refreshed afterwards
+     * through their own `update_values`.
+     *
+     * @param map  the mapping computed by build_value_map()
+     * @param contributions  the contribution values, in the order of the
+     *                       positions the mapping was built from
+     *
+     * @throw ValueMismatch  if the sizes do not match the mapping
+     */
+    void update_values(const value_map &map,
+                       const Array<value_type> &contributions);
+
+    /**
+     * Overwrites the values of the matrix with a sequence of (row, column,
+     * value) contributions. This is a shorthand for building the mapping and
+     * applying it once, time-stepping codes should reuse the mapping instead.
+     *
+     * @param rows  the row indexes of the contributions
+     * @param cols  the column indexes of the contributions
+     * @param contributions  the contribution values
+     *
+     * @see build_value_map(), update_values(const value_map &, const
+     *      Array<value_type> &)
+     */
+    void update_values(const Array<index_type> &rows,
+                       const Array<index_type> &cols,
+                       const Array<value_type> &contributions);
+
     /**
      * Returns the values of the matrix.
      *
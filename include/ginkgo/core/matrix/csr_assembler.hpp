@@ -0,0 +1,184 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_CSR_ASSEMBLER_HPP_
+#define GKO_CORE_MATRIX_CSR_ASSEMBLER_HPP_
+
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+/**
+ * CsrAssembler builds a Csr matrix directly from a stream of nonzeros, without
+ * going through the array-of-structures representation of matrix_data.
+ *
+ * Nonzeros are added in chunks of (row, column, value) triplets, stored as
+ * separate arrays. Chunks can be inserted in any order and concurrently from
+ * multiple threads. Once all chunks have been inserted, finalize() counts the
+ * nonzeros in each row, computes the row pointers with a prefix sum, and
+ * scatters the chunks into the column index and value arrays of the matrix,
+ * releasing every chunk as soon as it has been scattered. With the OpenMP
+ * executor, the counting and scattering are parallelized within each chunk.
+ *
+ * Like Csr::read, explicit zeros are dropped. Duplicate entries are kept as
+ * separate nonzeros by default. Alternatively, as typically required for
+ * finite element assembly, they can be replaced by their sum, in which case
+ * sums which cancel out to zero are dropped as well. The column indexes of
+ * each row of the result are sorted. Duplicate entries keep the order in
+ * which they were inserted, so the result is bitwise reproducible as long as
+ * the chunks are inserted in the same order.
+ *
+ * Example: assembling a matrix from multiple threads
+ * ```cpp
+ * gko::matrix::CsrAssembler<> assembler(exec, gko::dim<2>{n, n});
+ * #pragma omp parallel
+ * {
+ *     std::vector<int> rows, cols;
+ *     std::vector<double> vals;
+ *     // ... compute local contributions ...
+ *     assembler.insert(rows.size(), rows.data(), cols.data(), vals.data());
+ * }
+ * auto mtx = assembler.finalize();
+ * ```
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup csr
+ * @ingroup mat_formats
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class CsrAssembler {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = Csr<ValueType, IndexType>;
+
+    /**
+     * Creates an assembler for a matrix of the given size.
+     *
+     * @param exec  the executor on which the matrix will be created, the
+     *              assembly itself runs on its master executor
+     * @param size  the size of the matrix
+     * @param sum_duplicates  whether entries at the same position should be
+     *                        summed up instead of being stored separately
+     */
+    CsrAssembler(std::shared_ptr<const Executor> exec, const dim<2> &size,
+                 bool sum_duplicates = false);
+
+    /**
+     * Inserts a chunk of nonzeros, copying the data. This function is
+     * thread-safe.
+     *
+     * @param num_entries  the number of nonzeros in the chunk
+     * @param rows  the row indexes of the nonzeros
+     * @param cols  the column indexes of the nonzeros
+     * @param values  the values of the nonzeros
+     *
+     * @throw OutOfBoundsError  if a row or column index lies outside the
+     *                          matrix
+     */
+    void insert(size_type num_entries, const index_type *rows,
+                const index_type *cols, const value_type *values);
+
+    /**
+     * Inserts a chunk of nonzeros, taking ownership of the arrays if they are
+     * stored on the master executor. This function is thread-safe.
+     *
+     * @param rows  the row indexes of the nonzeros
+     * @param cols  the column indexes of the nonzeros
+     * @param values  the values of the nonzeros
+     *
+     * @throw OutOfBoundsError  if a row or column index lies outside the
+     *                          matrix
+     * @throw ValueMismatch  if the arrays have different sizes
+     */
+    void insert(Array<index_type> rows, Array<index_type> cols,
+                Array<value_type> values);
+
+    /**
+     * Returns the number of entries inserted so far, including explicit
+     * zeros.
+     *
+     * @return the number of entries inserted so far
+     */
+    size_type get_num_entries() const;
+
+    /**
+     * Builds the matrix from all inserted chunks. Afterwards, the assembler is
+     * empty and can be used to assemble another matrix of the same size.
+     *
+     * @param strategy  the SpMV strategy of the resulting matrix
+     *
+     * @return the assembled matrix
+     */
+    std::unique_ptr<matrix_type> finalize(
+        std::shared_ptr<typename matrix_type::strategy_type> strategy =
+            std::make_shared<typename matrix_type::sparselib>());
+
+private:
+    struct chunk {
+        Array<index_type> rows;
+        Array<index_type> cols;
+        Array<value_type> values;
+    };
+
+    void check_bounds(const chunk &c) const;
+
+    std::shared_ptr<const Executor> exec_;
+    dim<2> size_;
+    bool sum_duplicates_;
+    mutable std::mutex mutex_;
+    std::vector<chunk> chunks_;
+    size_type num_entries_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_CSR_ASSEMBLER_HPP_
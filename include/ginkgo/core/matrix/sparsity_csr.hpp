@@ -87,8 +87,19 @@ public:
     using transposed_type = SparsityCsr<IndexType, ValueType>;
     using mat_data = matrix_data<ValueType, IndexType>;
 
+    using pattern_data = matrix_pattern<IndexType>;
+
     void read(const mat_data &data) override;
 
+    /**
+     * Reads the matrix from a sparsity pattern. In contrast to
+     * read(const mat_data &), every position stored in the pattern becomes a
+     * nonzero of the matrix.
+     *
+     * @param data  the sparsity pattern, sorted in row-major order
+     */
+    void read(const pattern_data &data);
+
     void write(mat_data &data) const override;
 
     std::unique_ptr<LinOp> transpose() const override;
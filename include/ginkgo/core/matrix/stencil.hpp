@@ -0,0 +1,331 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_MATRIX_STENCIL_HPP_
+#define GKO_CORE_MATRIX_STENCIL_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * Specifies which neighbors of a grid point are coupled by a Stencil.
+ */
+enum class stencil_shape {
+    /**
+     * The point is coupled to its direct neighbors along each axis, i.e. 3, 5
+     * and 7 points in 1D, 2D and 3D, respectively.
+     */
+    star,
+    /**
+     * The point is coupled to all points of the surrounding 3x3x3 box,
+     * including the diagonal ones, i.e. 3, 9 and 27 points in 1D, 2D and 3D,
+     * respectively.
+     */
+    box
+};
+
+
+/**
+ * Stencil is a matrix-free operator for a stencil discretization on a
+ * structured 1D, 2D or 3D grid.
+ *
+ * Instead of storing the sparsity pattern, only the coefficients of the
+ * stencil are stored, either once for the whole grid (constant coefficients)
+ * or separately for every grid point (variable coefficients). Applying the
+ * operator thus only reads and writes the vectors, plus the coefficients in
+ * the variable case.
+ *
+ * The grid points are numbered lexicographically with x being the fastest
+ * running index, i.e. point (x, y, z) corresponds to row
+ * `x + nx * (y + ny * z)`. The stencil points are ordered lexicographically
+ * by their offsets (dz, dy, dx), so their column indexes are increasing. For
+ * example, the points of the 2D star stencil are ordered as
+ * `(x, y - 1), (x - 1, y), (x, y), (x + 1, y), (x, y + 1)`. Stencil points
+ * outside of the grid are omitted, which corresponds to homogeneous Dirichlet
+ * boundary conditions.
+ *
+ * Constant coefficients are stored as an array of get_num_points() values.
+ * Variable coefficients are stored point by point: the coefficient of stencil
+ * point `p` in row `i` is stored at position `p * num_rows + i`, so
+ * consecutive rows access consecutive memory.
+ *
+ * The operator can be converted to Csr, which allows using it with
+ * preconditioners that need the explicit matrix, e.g. Jacobi.
+ *
+ * @tparam ValueType  precision of the coefficients
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Stencil : public EnableLinOp<Stencil<ValueType>>,
+                public EnableCreateMethod<Stencil<ValueType>>,
+                public ConvertibleTo<Csr<ValueType, int32>>,
+                public ConvertibleTo<Csr<ValueType, int64>>,
+                public DiagonalExtractable<ValueType>,
+                public WritableToMatrixData<ValueType, int32>,
+                public WritableToMatrixData<ValueType, int64> {
+    friend class EnableCreateMethod<Stencil>;
+    friend class EnablePolymorphicObject<Stencil, LinOp>;
+
+public:
+    using EnableLinOp<Stencil>::convert_to;
+    using EnableLinOp<Stencil>::move_to;
+
+    using value_type = ValueType;
+    using index_type = int64;
+    using mat_data = matrix_data<ValueType, int64>;
+    using mat_data32 = matrix_data<ValueType, int32>;
+
+    void convert_to(Csr<ValueType, int32> *result) const override;
+
+    void move_to(Csr<ValueType, int32> *result) override;
+
+    void convert_to(Csr<ValueType, int64> *result) const override;
+
+    void move_to(Csr<ValueType, int64> *result) override;
+
+    void write(mat_data &data) const override;
+
+    void write(mat_data32 &data) const override;
+
+    std::unique_ptr<Diagonal<ValueType>> extract_diagonal() const override;
+
+    /**
+     * Returns the number of grid points in x, y and z direction. The unused
+     * directions of 1D and 2D grids have a single grid point.
+     *
+     * @return the size of the grid
+     */
+    const dim<3> &get_grid_size() const noexcept { return grid_size_; }
+
+    /**
+     * Returns the dimensionality of the grid.
+     *
+     * @return the dimensionality of the grid (1, 2 or 3)
+     */
+    size_type get_num_dimensions() const noexcept { return num_dimensions_; }
+
+    /**
+     * Returns the shape of the stencil.
+     *
+     * @return the shape of the stencil
+     */
+    stencil_shape get_shape() const noexcept { return shape_; }
+
+    /**
+     * Returns the number of points of the stencil.
+     *
+     * @return the number of points of the stencil
+     */
+    size_type get_num_points() const noexcept
+    {
+        return compute_num_points(num_dimensions_, shape_);
+    }
+
+    /**
+     * Returns whether the coefficients are stored separately for every grid
+     * point.
+     *
+     * @return true if the coefficients vary across the grid, false if they
+     *         are constant
+     */
+    bool has_variable_coefficients() const noexcept
+    {
+        return coefficients_.get_num_elems() != this->get_num_points();
+    }
+
+    /**
+     * Returns the coefficients of the stencil.
+     *
+     * @return the coefficients of the stencil
+     */
+    value_type *get_coefficients() noexcept
+    {
+        return coefficients_.get_data();
+    }
+
+    /**
+     * @copydoc Stencil::get_coefficients()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type *get_const_coefficients() const noexcept
+    {
+        return coefficients_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored coefficients.
+     *
+     * @return the number of stored coefficients
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return coefficients_.get_num_elems();
+    }
+
+    /**
+     * Computes the number of points of a stencil.
+     *
+     * @param num_dimensions  the dimensionality of the grid
+     * @param shape  the shape of the stencil
+     *
+     * @return the number of points of the stencil
+     */
+    static size_type compute_num_points(size_type num_dimensions,
+                                        stencil_shape shape) noexcept
+    {
+        if (shape == stencil_shape::star) {
+            return 2 * num_dimensions + 1;
+        }
+        size_type num_points{1};
+        for (size_type i = 0; i < num_dimensions; ++i) {
+            num_points *= 3;
+        }
+        return num_points;
+    }
+
+protected:
+    /**
+     * Creates an empty Stencil operator.
+     *
+     * @param exec  Executor associated to the operator
+     */
+    explicit Stencil(std::shared_ptr<const Executor> exec)
+        : Stencil(std::move(exec), dim<1>{})
+    {}
+
+    /**
+     * Creates a Stencil operator with uninitialized coefficients.
+     *
+     * @tparam Dimensionality  the dimensionality of the grid (1, 2 or 3)
+     *
+     * @param exec  Executor associated to the operator
+     * @param grid_size  the number of grid points in each direction
+     * @param shape  the shape of the stencil
+     * @param variable_coefficients  whether the coefficients are stored
+     *                               separately for every grid point
+     */
+    template <size_type Dimensionality>
+    Stencil(std::shared_ptr<const Executor> exec,
+            const dim<Dimensionality> &grid_size,
+            stencil_shape shape = stencil_shape::star,
+            bool variable_coefficients = false)
+        : Stencil(exec, grid_size, shape,
+                  Array<value_type>(
+                      exec, compute_num_points(Dimensionality, shape) *
+                                (variable_coefficients
+                                     ? get_num_grid_points(grid_size)
+                                     : 1)))
+    {}
+
+    /**
+     * Creates a Stencil operator from an already allocated (and initialized)
+     * array of coefficients.
+     *
+     * @tparam Dimensionality  the dimensionality of the grid (1, 2 or 3)
+     * @tparam CoefficientsArray  type of array of coefficients
+     *
+     * @param exec  Executor associated to the operator
+     * @param grid_size  the number of grid points in each direction
+     * @param shape  the shape of the stencil
+     * @param coefficients  array of get_num_points() constant coefficients,
+     *                      or of get_num_points() times the number of grid
+     *                      points variable coefficients
+     *
+     * @note If `coefficients` is not an rvalue, not an array of ValueType, or
+     *       is on the wrong executor, an internal copy will be created, and
+     *       the original array data will not be used in the operator.
+     */
+    template <size_type Dimensionality, typename CoefficientsArray>
+    Stencil(std::shared_ptr<const Executor> exec,
+            const dim<Dimensionality> &grid_size, stencil_shape shape,
+            CoefficientsArray &&coefficients)
+        : EnableLinOp<Stencil>(exec, dim<2>{get_num_grid_points(grid_size)}),
+          grid_size_{grid_size[0], Dimensionality > 1 ? grid_size[1] : 1,
+                     Dimensionality > 2 ? grid_size[2] : 1},
+          num_dimensions_{Dimensionality},
+          shape_{shape},
+          coefficients_{exec, std::forward<CoefficientsArray>(coefficients)}
+    {
+        static_assert(Dimensionality >= 1 && Dimensionality <= 3,
+                      "only 1D, 2D and 3D grids are supported");
+        if (this->has_variable_coefficients()) {
+            GKO_ASSERT_EQ(coefficients_.get_num_elems(),
+                          this->get_num_points() * this->get_size()[0]);
+        }
+    }
+
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    template <size_type Dimensionality>
+    static size_type get_num_grid_points(const dim<Dimensionality> &grid_size)
+    {
+        size_type num_grid_points{1};
+        for (size_type i = 0; i < Dimensionality; ++i) {
+            num_grid_points *= grid_size[i];
+        }
+        return num_grid_points;
+    }
+
+private:
+    dim<3> grid_size_;
+    size_type num_dimensions_;
+    stencil_shape shape_;
+    Array<value_type> coefficients_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_STENCIL_HPP_
@@ -34,7 +34,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_PRECONDITIONER_ISAI_HPP_
 
 
+#include <istream>
 #include <memory>
+#include <ostream>
 
 
 #include <ginkgo/core/base/composition.hpp>
@@ -57,10 +59,10 @@ namespace preconditioner {
 /**
  * This enum lists the types of the ISAI preconditioner.
  *
- * ISAI can either generate a lower triangular matrix, or an upper triangular
- * matrix.
+ * ISAI can either generate a lower triangular matrix, an upper triangular
+ * matrix, or a sparse approximate inverse of a general matrix.
  */
-enum struct isai_type { lower, upper };
+enum struct isai_type { lower, upper, general };
 
 /**
  * The Incomplete Sparse Approximate Inverse (ISAI) Preconditioner generates
@@ -74,6 +76,13 @@ enum struct isai_type { lower, upper };
  * The sparsity pattern used for the approximate inverse is the same as
  * the sparsity pattern of the respective triangular matrix.
  *
+ * For a general (nonsymmetric) matrix A, the `general` type computes a sparse
+ * approximate inverse (SPAI) M with the sparsity pattern of A^n, which
+ * minimizes the Frobenius norm of M * A - I. Every row of M is the solution
+ * of an independent small dense least-squares problem, which is solved by a
+ * Householder QR decomposition. Applying the preconditioner only requires a
+ * sparse matrix-vector product with M, no triangular solves.
+ *
  * For more details on the algorithm, see the paper
  * <a href="https://doi.org/10.1016/j.parco.2017.10.003">
  * Incomplete Sparse Approximate Inverses for Parallel Preconditioning</a>,
@@ -82,10 +91,11 @@ enum struct isai_type { lower, upper };
  * @note GPU implementations can only handle the vector unit width `width`
  *       (warp size for CUDA) as number of elements per row in the sparse
  *       matrix. If there are more than `width` elements per row, the remaining
- *       elements will be ignored.
+ *       elements will be ignored. The general ISAI is only implemented for
+ *       the reference and OpenMP executors.
  *
  * @tparam IsaiType  determines if the ISAI is generated for a lower triangular
- *                   matrix or an upper triangular matrix
+ *                   matrix, an upper triangular matrix or a general matrix
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -98,22 +108,27 @@ class Isai : public EnableLinOp<Isai<IsaiType, ValueType, IndexType>>,
              public Transposable {
     friend class EnableLinOp<Isai>;
     friend class EnablePolymorphicObject<Isai, LinOp>;
-    friend class Isai<IsaiType == isai_type::lower ? isai_type::upper
-                                                   : isai_type::lower,
+    friend class Isai<IsaiType == isai_type::lower
+                          ? isai_type::upper
+                          : IsaiType == isai_type::upper ? isai_type::lower
+                                                         : isai_type::general,
                       ValueType, IndexType>;
 
 public:
     using value_type = ValueType;
     using index_type = IndexType;
     using transposed_type =
-        Isai<IsaiType == isai_type::lower ? isai_type::upper : isai_type::lower,
+        Isai<IsaiType == isai_type::lower
+                 ? isai_type::upper
+                 : IsaiType == isai_type::upper ? isai_type::lower
+                                                : isai_type::general,
              ValueType, IndexType>;
     using Csr = matrix::Csr<ValueType, IndexType>;
     static constexpr isai_type type{IsaiType};
 
     /**
-     * Returns the approximate inverse of the given matrix (either L or U,
-     * depending on the template parameter IsaiType).
+     * Returns the approximate inverse of the given matrix (either L, U or a
+     * general matrix, depending on the template parameter IsaiType).
      *
      * @returns the generated approximate inverse
      */
@@ -148,6 +163,34 @@ public:
     GKO_ENABLE_LIN_OP_FACTORY(Isai, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
 
+    /**
+     * Writes the generated approximate inverse to a stream in Ginkgo's binary
+     * format, so it can be restored by Isai::load instead of being generated
+     * again. The data is preceded by a checksum of the system matrix.
+     *
+     * @param os  output stream where the data is to be written, it needs to be
+     *            opened in binary mode
+     * @param system_matrix  the matrix this preconditioner was generated from
+     */
+    void save(std::ostream &os, const LinOp *system_matrix) const;
+
+    /**
+     * Restores a preconditioner written by Isai::save.
+     *
+     * @param is  input stream from which to read the data, it needs to be
+     *            opened in binary mode
+     * @param factory  the factory the preconditioner was generated with
+     * @param system_matrix  the matrix the preconditioner was generated from
+     *
+     * @return the preconditioner stored in the stream
+     *
+     * @throw StreamError  if the stream does not contain an ISAI of the same
+     *                     type with the same value and index types, or if it
+     *                     was generated from a different system matrix
+     */
+    static std::unique_ptr<Isai> load(std::istream &is, const Factory *factory,
+                                      const LinOp *system_matrix);
+
     std::unique_ptr<LinOp> transpose() const override;
 
     std::unique_ptr<LinOp> conj_transpose() const override;
@@ -187,10 +230,10 @@ protected:
 
 private:
     /**
-     * Generates the approximate inverse for a triangular matrix and
-     * stores the result in `approximate_inverse_`.
+     * Generates the approximate inverse for a triangular or general matrix
+     * and stores the result in `approximate_inverse_`.
      *
-     * @param to_invert  the source triangular matrix used to generate
+     * @param to_invert  the source matrix used to generate
      *                     the approximate inverse
      *
      * @param skip_sorting  dictates if the sorting of the input matrix should
@@ -210,6 +253,9 @@ using LowerIsai = Isai<isai_type::lower, ValueType, IndexType>;
 template <typename ValueType = default_precision, typename IndexType = int32>
 using UpperIsai = Isai<isai_type::upper, ValueType, IndexType>;
 
+template <typename ValueType = default_precision, typename IndexType = int32>
+using GeneralIsai = Isai<isai_type::general, ValueType, IndexType>;
+
 
 }  // namespace preconditioner
 }  // namespace gko
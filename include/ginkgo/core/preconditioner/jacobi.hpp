@@ -34,6 +34,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_PRECONDITIONER_JACOBI_HPP_
 
 
+#include <istream>
+#include <memory>
+#include <ostream>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
@@ -293,6 +298,19 @@ public:
 
     std::unique_ptr<LinOp> conj_transpose() const override;
 
+    /**
+     * Recomputes the preconditioner for a matrix with new values, but the same
+     * sparsity pattern as the matrix it was generated from.
+     *
+     * The diagonal block structure and the storage allocated for the blocks
+     * are reused, only the blocks are extracted and inverted again. If the
+     * adaptive precision variant is used, the storage precision of each block
+     * is selected anew.
+     *
+     * @param system_matrix  the matrix with the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix);
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -470,6 +488,44 @@ public:
     GKO_ENABLE_LIN_OP_FACTORY(Jacobi, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
 
+    /**
+     * Writes the generated preconditioner to a stream in Ginkgo's binary
+     * format, so it can be restored by Jacobi::load instead of being generated
+     * again.
+     *
+     * The data contains the block structure, the storage precisions and the
+     * inverted blocks, and is preceded by a checksum of the system matrix.
+     *
+     * @param os  output stream where the data is to be written, it needs to be
+     *            opened in binary mode
+     * @param system_matrix  the matrix this preconditioner was generated from
+     */
+    void save(std::ostream &os, const LinOp *system_matrix) const;
+
+    /**
+     * Restores a preconditioner written by Jacobi::save.
+     *
+     * The block structure, the storage precisions and the inverted blocks are
+     * read from the stream, all remaining parameters are taken from the
+     * factory.
+     *
+     * @param is  input stream from which to read the data, it needs to be
+     *            opened in binary mode
+     * @param factory  the factory the preconditioner was generated with
+     * @param system_matrix  the matrix the preconditioner was generated from
+     *
+     * @return the preconditioner stored in the stream
+     *
+     * @throw StreamError  if the stream does not contain a Jacobi
+     *                     preconditioner with the same value and index types,
+     *                     if it was generated from a different system matrix,
+     *                     or if its block layout is not supported by the
+     *                     factory's executor
+     */
+    static std::unique_ptr<Jacobi> load(std::istream &is,
+                                        const Factory *factory,
+                                        const LinOp *system_matrix);
+
 protected:
     /**
      * Creates an empty Jacobi preconditioner.
@@ -480,7 +536,8 @@ protected:
         : EnableLinOp<Jacobi>(exec),
           num_blocks_{},
           blocks_(exec),
-          conditioning_(exec)
+          conditioning_(exec),
+          requested_precisions_(exec)
     {
         parameters_.block_pointers.set_executor(exec);
         parameters_.storage_optimization.block_wise.set_executor(exec);
@@ -504,7 +561,8 @@ protected:
           blocks_(factory->get_executor(),
                   storage_scheme_.compute_storage_space(
                       parameters_.block_pointers.get_num_elems() - 1)),
-          conditioning_(factory->get_executor())
+          conditioning_(factory->get_executor()),
+          requested_precisions_(factory->get_executor())
     {
         parameters_.block_pointers.set_executor(this->get_executor());
         parameters_.storage_optimization.block_wise.set_executor(
@@ -581,6 +639,9 @@ private:
     size_type num_blocks_;
     Array<value_type> blocks_;
     Array<remove_complex<value_type>> conditioning_;
+    // block-wise precisions as requested by the user, which are overwritten
+    // with the detected precisions in parameters_ during generation
+    Array<precision_reduction> requested_precisions_;
 };
 
 
@@ -0,0 +1,234 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_PRECONDITIONER_POLYNOMIAL_HPP_
+#define GKO_CORE_PRECONDITIONER_POLYNOMIAL_HPP_
+
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * This enum lists the kinds of polynomials the Polynomial preconditioner can
+ * use to approximate the inverse of the system matrix.
+ */
+enum struct polynomial_type {
+    /**
+     * A truncated Neumann series of the Jacobi-scaled system matrix,
+     * $p(A) = \sum_{k=0}^{d} (I - D^{-1}A)^k D^{-1}$. It converges if the
+     * Jacobi iteration converges, e.g. for diagonally dominant matrices.
+     */
+    neumann,
+    /**
+     * The polynomial minimizing the residual of GMRES after $d + 1$
+     * iterations. It is represented by its roots, the harmonic Ritz values
+     * obtained from an Arnoldi process on the system matrix, and does not
+     * require any special matrix structure.
+     */
+    gmres
+};
+
+
+/**
+ * The Polynomial preconditioner approximates the inverse of the system matrix
+ * $A$ by a polynomial $p(A)$ of low degree $d$.
+ *
+ * Its application only consists of $d$ sparse matrix-vector products with $A$
+ * and vector updates, which are fused into a single pass over the vectors
+ * wherever possible. Apart from the output vector, it only requires two work
+ * vectors of the size of the right-hand side. In contrast to triangular
+ * solves, all of these operations parallelize well, which makes the
+ * preconditioner attractive on many-core systems.
+ *
+ * For polynomial_type::neumann, the polynomial is evaluated by the Horner
+ * scheme $x_0 = D^{-1}b$, $x_{k+1} = x_k + D^{-1}(b - Ax_k)$, where $D$ is
+ * the diagonal of $A$. For polynomial_type::gmres, it is evaluated in its
+ * product form, with the roots in a modified Leja order for numerical
+ * stability. For real value types, conjugate pairs of complex roots are
+ * combined into real quadratic factors.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup precond
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Polynomial : public EnableLinOp<Polynomial<ValueType>> {
+    friend class EnableLinOp<Polynomial>;
+    friend class EnablePolymorphicObject<Polynomial, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using root_type = std::complex<remove_complex<ValueType>>;
+
+    /**
+     * Returns the system matrix the polynomial is evaluated on.
+     *
+     * @return the system matrix
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * Returns the roots of the residual polynomial $1 - zp(z)$ in the order
+     * they are applied. Only used for polynomial_type::gmres.
+     *
+     * For real value types, a root with non-zero imaginary part represents
+     * both itself and its complex conjugate.
+     *
+     * @return the roots of the residual polynomial
+     */
+    const std::vector<root_type> &get_roots() const noexcept { return roots_; }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The kind of polynomial that is used.
+         */
+        polynomial_type GKO_FACTORY_PARAMETER_SCALAR(type,
+                                                     polynomial_type::neumann);
+
+        /**
+         * The degree of the polynomial, which equals the number of sparse
+         * matrix-vector products in each application.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(degree, 3u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Polynomial, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit Polynomial(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Polynomial>(std::move(exec))
+    {}
+
+    /**
+     * Creates a Polynomial preconditioner from a matrix using a
+     * Polynomial::Factory.
+     *
+     * @param factory  the factory to use to create the preconditoner
+     * @param system_matrix  the matrix this preconditioner should be created
+     *                       from
+     */
+    explicit Polynomial(const Factory *factory,
+                        std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Polynomial>(factory->get_executor(),
+                                  gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          system_matrix_{std::move(system_matrix)}
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix_);
+        if (parameters_.type == polynomial_type::neumann) {
+            generate_neumann();
+        } else {
+            generate_gmres();
+        }
+    }
+
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+private:
+    /**
+     * Extracts and inverts the diagonal of the system matrix.
+     */
+    void generate_neumann();
+
+    /**
+     * Computes the harmonic Ritz values of an Arnoldi process on the system
+     * matrix and stores them in `roots_`.
+     */
+    void generate_gmres();
+
+    void apply_neumann(const matrix::Dense<ValueType> *b,
+                       matrix::Dense<ValueType> *x) const;
+
+    void apply_gmres(const matrix::Dense<ValueType> *b,
+                     matrix::Dense<ValueType> *x) const;
+
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::shared_ptr<const matrix::Diagonal<ValueType>> inverse_diagonal_{};
+    std::vector<root_type> roots_{};
+    // the scalar of each root applied with the system matrix or added to the
+    // solution, precomputed by generate_gmres()
+    std::vector<std::shared_ptr<const matrix::Dense<ValueType>>>
+        root_scalars_{};
+    std::shared_ptr<const matrix::Dense<ValueType>> one_op_{};
+
+    // TODO: solve race conditions when multithreading
+    mutable struct cache_struct {
+        cache_struct() = default;
+        ~cache_struct() = default;
+        cache_struct(const cache_struct &other) {}
+        cache_struct &operator=(const cache_struct &other) { return *this; }
+
+        // allocates the work vectors `r` and `ar` of the given size, reusing
+        // them from previous applications if the size did not change
+        void allocate(std::shared_ptr<const Executor> exec, dim<2> size)
+        {
+            using vec = matrix::Dense<ValueType>;
+            if (r == nullptr || r->get_size() != size) {
+                r = vec::create(exec, size);
+                ar = vec::create(exec, size);
+            }
+        }
+
+        std::unique_ptr<matrix::Dense<ValueType>> r;
+        std::unique_ptr<matrix::Dense<ValueType>> ar;
+    } cache_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_POLYNOMIAL_HPP_
@@ -0,0 +1,226 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_PRECONDITIONER_SCHWARZ_HPP_
+#define GKO_CORE_PRECONDITIONER_SCHWARZ_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace preconditioner {
+
+
+/**
+ * A restricted additive Schwarz preconditioner with incomplete LU
+ * factorizations as local solvers.
+ *
+ * The rows of the system matrix are partitioned into contiguous blocks with
+ * roughly equal numbers of nonzeros. Each block is extended by `overlap`
+ * layers of neighboring rows in the adjacency graph of the matrix to form a
+ * subdomain. The principal submatrix of each subdomain is factorized by ILU(0)
+ * independently of all others, which on the OpenMP executor happens
+ * concurrently, with one subdomain per thread.
+ *
+ * When applied, every subdomain solves its local system with the restriction
+ * of the right-hand side, but only writes the solution of the rows of its own
+ * block ("restricted" additive Schwarz). As these blocks are disjoint, all
+ * local solves run concurrently without any synchronization, and the
+ * preconditioner does not depend on the order in which they finish.
+ *
+ * Without overlap, this is a block-Jacobi preconditioner with ILU(0) on the
+ * diagonal blocks. More overlap improves the convergence at the price of
+ * larger local systems.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  integral type used to store pointers and indices
+ *
+ * @ingroup precond
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Schwarz : public EnableLinOp<Schwarz<ValueType, IndexType>> {
+    friend class EnableLinOp<Schwarz>;
+    friend class EnablePolymorphicObject<Schwarz, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using Csr = matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the number of subdomains.
+     *
+     * @return the number of subdomains
+     */
+    size_type get_num_subdomains() const noexcept
+    {
+        return block_ptrs_.get_num_elems() - 1;
+    }
+
+    /**
+     * Returns the partition of the rows into blocks: block `i` consists of
+     * the rows `block_ptrs[i]` to `block_ptrs[i + 1] - 1`.
+     *
+     * @return the block pointers
+     */
+    const Array<IndexType> &get_block_pointers() const noexcept
+    {
+        return block_ptrs_;
+    }
+
+    /**
+     * Returns the pointers into the rows of all subdomains: the rows of
+     * subdomain `i` are stored at positions `subdomain_ptrs[i]` to
+     * `subdomain_ptrs[i + 1] - 1` of get_subdomain_rows().
+     *
+     * @return the subdomain pointers
+     */
+    const Array<IndexType> &get_subdomain_pointers() const noexcept
+    {
+        return subdomain_ptrs_;
+    }
+
+    /**
+     * Returns the sorted global row indices of all subdomains, concatenated.
+     *
+     * @return the subdomain rows
+     */
+    const Array<IndexType> &get_subdomain_rows() const noexcept
+    {
+        return subdomain_rows_;
+    }
+
+    /**
+     * Returns the block-diagonal matrix of the local incomplete factors. The
+     * diagonal block of each subdomain stores its strictly lower triangular
+     * factor L with implicit unit diagonal and its upper triangular factor U
+     * in the same sparsity pattern.
+     *
+     * @return the local factors
+     */
+    std::shared_ptr<const Csr> get_local_factors() const noexcept
+    {
+        return local_factors_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The number of subdomains. The default value 0 uses one subdomain
+         * per thread of the executor.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(num_subdomains, 0u);
+
+        /**
+         * The number of layers of neighboring rows every block is extended
+         * by.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(overlap, 0u);
+
+        /**
+         * @brief Optimization parameter that skips the sorting of the input
+         *        matrix (only skip if it is known that it is already sorted).
+         *
+         * The local factorizations require the input matrix to be sorted. If
+         * it is, this parameter can be set to `true` to skip the sorting for
+         * better performance.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Schwarz, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit Schwarz(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Schwarz>(exec),
+          block_ptrs_(exec, {0}),
+          subdomain_ptrs_(exec, {0}),
+          subdomain_rows_(exec),
+          local_factors_{Csr::create(exec)}
+    {}
+
+    /**
+     * Creates a Schwarz preconditioner from a matrix using a Schwarz::Factory.
+     *
+     * @param factory  the factory to use to create the preconditoner
+     * @param system_matrix  the matrix this preconditioner should be created
+     *                       from
+     */
+    explicit Schwarz(const Factory *factory,
+                     std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Schwarz>(factory->get_executor(),
+                               gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          block_ptrs_(factory->get_executor()),
+          subdomain_ptrs_(factory->get_executor()),
+          subdomain_rows_(factory->get_executor())
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+        generate(std::move(system_matrix));
+    }
+
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+private:
+    /**
+     * Partitions the system matrix into subdomains and factorizes them.
+     *
+     * @param system_matrix  the source matrix
+     */
+    void generate(std::shared_ptr<const LinOp> system_matrix);
+
+    Array<IndexType> block_ptrs_;
+    Array<IndexType> subdomain_ptrs_;
+    Array<IndexType> subdomain_rows_;
+    std::shared_ptr<Csr> local_factors_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_SCHWARZ_HPP_
@@ -0,0 +1,273 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_SOLVER_CB_GMRES_HPP_
+#define GKO_CORE_SOLVER_CB_GMRES_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+namespace cb_gmres {
+
+
+/**
+ * Describes the precision in which the Krylov basis of CbGmres is stored.
+ */
+enum class storage_precision {
+    /**
+     * The basis is stored in the working precision (e.g. double for double).
+     */
+    keep,
+    /**
+     * The basis is stored in the next lower precision, e.g. float for double
+     * and half for float.
+     */
+    reduce1,
+    /**
+     * The basis is stored in the precision two levels lower, e.g. half for
+     * double. As there is no precision below half, this is the same as
+     * `reduce1` for float.
+     */
+    reduce2
+};
+
+
+}  // namespace cb_gmres
+
+
+/**
+ * CB-GMRES or the compressed basis generalized minimal residual method is a
+ * GMRES variant which stores the Krylov basis in a lower precision than the
+ * working precision.
+ *
+ * Restarted GMRES keeps `krylov_dim` basis vectors and reads all of them in
+ * every Arnoldi step and when updating the solution, so it is usually limited
+ * by memory bandwidth. CB-GMRES stores the basis in the precision given by
+ * `storage_precision` and converts it to the working precision on the fly, so
+ * all arithmetic operations (including the Arnoldi orthogonalization and the
+ * Hessenberg system) are still performed in ValueType. This halves (or
+ * quarters) the memory footprint and memory traffic of the basis, usually
+ * with only a small increase in the number of iterations.
+ *
+ * The current basis vector is additionally kept in ValueType, so the
+ * preconditioner and the system matrix are applied to full-precision vectors.
+ *
+ * @tparam ValueType  precision of matrix elements and of all arithmetic
+ *                    operations
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class CbGmres : public EnableLinOp<CbGmres<ValueType>>,
+                public Preconditionable,
+                public Transposable {
+    friend class EnableLinOp<CbGmres>;
+    friend class EnablePolymorphicObject<CbGmres, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = CbGmres<ValueType>;
+
+    /**
+     * Gets the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    /**
+     * Gets the krylov dimension of the solver
+     *
+     * @return the krylov dimension
+     */
+    size_type get_krylov_dim() const { return krylov_dim_; }
+
+    /**
+     * Sets the krylov dimension
+     *
+     * @param other  the new krylov dimension
+     */
+    void set_krylov_dim(const size_type &other) { krylov_dim_ = other; }
+
+    /**
+     * Gets the precision in which the Krylov basis is stored.
+     *
+     * @return the storage precision of the Krylov basis
+     */
+    cb_gmres::storage_precision get_storage_precision() const
+    {
+        return parameters_.storage_precision;
+    }
+
+    /**
+     * Gets the stopping criterion factory of the solver.
+     *
+     * @return the stopping criterion factory
+     */
+    std::shared_ptr<const stop::CriterionFactory> get_stop_criterion_factory()
+        const
+    {
+        return stop_criterion_factory_;
+    }
+
+    /**
+     * Sets the stopping criterion of the solver.
+     *
+     * @param other  the new stopping criterion factory
+     */
+    void set_stop_criterion_factory(
+        std::shared_ptr<const stop::CriterionFactory> other)
+    {
+        stop_criterion_factory_ = std::move(other);
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER_VECTOR(criteria, nullptr);
+
+        /**
+         * Preconditioner factory.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            preconditioner, nullptr);
+
+        /**
+         * Already generated preconditioner. If one is provided, the factory
+         * `preconditioner` will be ignored.
+         */
+        std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
+            generated_preconditioner, nullptr);
+
+        /**
+         * krylov dimension factory.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 0u);
+
+        /**
+         * Precision in which the Krylov basis is stored.
+         */
+        cb_gmres::storage_precision GKO_FACTORY_PARAMETER_SCALAR(
+            storage_precision, cb_gmres::storage_precision::reduce1);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(CbGmres, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    template <typename StorageType>
+    void apply_dense_impl(const matrix::Dense<ValueType> *b,
+                          matrix::Dense<ValueType> *x) const;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    explicit CbGmres(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<CbGmres>(std::move(exec))
+    {}
+
+    explicit CbGmres(const Factory *factory,
+                     std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<CbGmres>(factory->get_executor(),
+                               gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          system_matrix_{std::move(system_matrix)}
+    {
+        if (parameters_.generated_preconditioner) {
+            GKO_ASSERT_EQUAL_DIMENSIONS(parameters_.generated_preconditioner,
+                                        this);
+            set_preconditioner(parameters_.generated_preconditioner);
+        } else if (parameters_.preconditioner) {
+            set_preconditioner(
+                parameters_.preconditioner->generate(system_matrix_));
+        } else {
+            set_preconditioner(matrix::Identity<ValueType>::create(
+                this->get_executor(), this->get_size()[0]));
+        }
+        if (parameters_.krylov_dim) {
+            krylov_dim_ = parameters_.krylov_dim;
+        } else {
+            krylov_dim_ = default_krylov_dim;
+        }
+        stop_criterion_factory_ =
+            stop::combine(std::move(parameters_.criteria));
+    }
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::shared_ptr<const stop::CriterionFactory> stop_criterion_factory_{};
+    size_type krylov_dim_;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_CB_GMRES_HPP_
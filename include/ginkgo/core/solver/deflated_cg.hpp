@@ -0,0 +1,279 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_CORE_SOLVER_DEFLATED_CG_HPP_
+#define GKO_CORE_SOLVER_DEFLATED_CG_HPP_
+
+
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Deflated CG is a conjugate gradient method with Krylov subspace recycling
+ * for sequences of symmetric (Hermitian) positive definite systems.
+ *
+ * The solver keeps a deflation space W of (at most) `deflation_dim` vectors
+ * that approximates the eigenvectors belonging to the smallest eigenvalues of
+ * the system matrix A. The initial guess is corrected such that the residual
+ * is orthogonal to W, and all search directions are kept A-orthogonal to W,
+ * which removes the corresponding eigenvalues from the convergence behavior
+ * of CG (see Saad, Yeung, Erhel, Guyomarc'h: "A deflated version of the
+ * conjugate gradient algorithm", SIAM J. Sci. Comput. 21(5), 2000).
+ *
+ * During each solve with a single right-hand side, the first `krylov_dim`
+ * search directions are collected. After the solve, W is replaced by the
+ * harmonic Ritz vectors with the smallest harmonic Ritz values from the span
+ * of the old deflation space and the collected directions. Subsequent solves
+ * with the same solver (e.g. for a sequence of right-hand sides) thus
+ * converge faster. For a sequence of changing system matrices, the
+ * deflation space can be transferred to a new solver using
+ * get_deflation_space() and set_deflation_space().
+ *
+ * The deflation space update is a small dense eigenvalue problem that is
+ * solved on the master executor of the solver's executor.
+ *
+ * @note Since the deflation space is updated by every apply, the iterates of a
+ *       solve depend on the previous solves with the same solver. Concurrent
+ *       applies are safe: each of them uses the deflation space present when
+ *       it started, and the last one to finish determines the space used by
+ *       later applies. Setting `krylov_dim` to zero disables the update and
+ *       makes the solver independent of its call history.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class DeflatedCg : public EnableLinOp<DeflatedCg<ValueType>>,
+                   public Preconditionable,
+                   public Transposable {
+    friend class EnableLinOp<DeflatedCg>;
+    friend class EnablePolymorphicObject<DeflatedCg, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = DeflatedCg<ValueType>;
+
+    /**
+     * Gets the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    /**
+     * Gets the stopping criterion factory of the solver.
+     *
+     * @return the stopping criterion factory
+     */
+    std::shared_ptr<const stop::CriterionFactory> get_stop_criterion_factory()
+        const
+    {
+        return stop_criterion_factory_;
+    }
+
+    /**
+     * Sets the stopping criterion of the solver.
+     *
+     * @param other  the new stopping criterion factory
+     */
+    void set_stop_criterion_factory(
+        std::shared_ptr<const stop::CriterionFactory> other)
+    {
+        stop_criterion_factory_ = std::move(other);
+    }
+
+    /**
+     * Gets the current deflation space.
+     *
+     * @return the deflation space as a dense matrix with one A-orthonormal
+     *         vector per column, or nullptr if no space has been computed yet
+     */
+    std::shared_ptr<const matrix::Dense<ValueType>> get_deflation_space() const
+    {
+        auto deflation = std::atomic_load(&deflation_);
+        return deflation ? deflation->space : nullptr;
+    }
+
+    /**
+     * Sets the deflation space of the solver, e.g. to recycle the space
+     * computed by a solver for a previous system matrix.
+     *
+     * The vectors are A-orthonormalized with respect to the system matrix of
+     * this solver. If they are linearly dependent (or the projected matrix is
+     * not positive definite), the deflation space is discarded.
+     *
+     * @param space  a dense matrix with one vector per column, or nullptr to
+     *               disable deflation
+     */
+    void set_deflation_space(
+        std::shared_ptr<const matrix::Dense<ValueType>> space);
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER_VECTOR(criteria, nullptr);
+
+        /**
+         * Preconditioner factory.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            preconditioner, nullptr);
+
+        /**
+         * Already generated preconditioner. If one is provided, the factory
+         * `preconditioner` will be ignored.
+         */
+        std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
+            generated_preconditioner, nullptr);
+
+        /**
+         * Maximum number of vectors in the deflation space.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(deflation_dim, 4u);
+
+        /**
+         * Number of search directions collected during a solve to update the
+         * deflation space. If it is zero, the deflation space is not updated.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 16u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(DeflatedCg, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    /**
+     * The deflation space W, A * W and their conjugate transposes, which are
+     * only ever replaced as a whole.
+     */
+    struct deflation_data {
+        std::shared_ptr<const matrix::Dense<ValueType>> space;
+        std::shared_ptr<const matrix::Dense<ValueType>> a_space;
+        std::shared_ptr<const matrix::Dense<ValueType>> space_h;
+        std::shared_ptr<const matrix::Dense<ValueType>> a_space_h;
+    };
+
+    /**
+     * Computes the deflation space made up of the `deflation_dim` harmonic
+     * Ritz vectors from the span of the rows of `basis`.
+     *
+     * @param basis  the search space, one vector per row
+     * @param a_basis  the system matrix applied to the search space, one
+     *                 vector per row
+     * @param num_vectors  the number of rows of `basis` to use
+     *
+     * @return the new deflation space, or nullptr if the projected system
+     *         matrix is not positive definite
+     */
+    std::shared_ptr<const deflation_data> compute_deflation_space(
+        const matrix::Dense<ValueType> *basis,
+        const matrix::Dense<ValueType> *a_basis, size_type num_vectors) const;
+
+    explicit DeflatedCg(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<DeflatedCg>(std::move(exec))
+    {}
+
+    explicit DeflatedCg(const Factory *factory,
+                        std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<DeflatedCg>(factory->get_executor(),
+                                  gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()},
+          system_matrix_{std::move(system_matrix)}
+    {
+        if (parameters_.generated_preconditioner) {
+            GKO_ASSERT_EQUAL_DIMENSIONS(parameters_.generated_preconditioner,
+                                        this);
+            set_preconditioner(parameters_.generated_preconditioner);
+        } else if (parameters_.preconditioner) {
+            set_preconditioner(
+                parameters_.preconditioner->generate(system_matrix_));
+        } else {
+            set_preconditioner(matrix::Identity<ValueType>::create(
+                this->get_executor(), this->get_size()[0]));
+        }
+        stop_criterion_factory_ =
+            stop::combine(std::move(parameters_.criteria));
+    }
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::shared_ptr<const stop::CriterionFactory> stop_criterion_factory_{};
+    // updated by apply, only accessed through std::atomic_load/atomic_store
+    mutable std::shared_ptr<const deflation_data> deflation_{};
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_DEFLATED_CG_HPP_
@@ -0,0 +1,181 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_DIRECT_HPP_
+#define GKO_CORE_SOLVER_DIRECT_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/solver/lower_trs.hpp>
+#include <ginkgo/core/solver/upper_trs.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Direct is a sparse direct solver, which solves the system $Ax = b$ by
+ * computing a complete factorization $A = LU$ and solving the triangular
+ * systems $Ly = b$ and $Ux = y$.
+ *
+ * By default, the factorization is computed by factorization::Lu, but any
+ * factorization returning a gko::Composition of a lower and an upper
+ * triangular factor can be used instead, e.g. factorization::Cholesky for
+ * Hermitian positive definite systems. The triangular systems are solved by
+ * solver::LowerTrs and solver::UpperTrs.
+ *
+ * Since the setup of the solver is expensive, it is mostly suited as a
+ * coarse-grid solver or for moderately sized, ill-conditioned systems on which
+ * iterative solvers stall.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indices
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Direct : public EnableLinOp<Direct<ValueType, IndexType>>,
+               public Transposable {
+    friend class EnableLinOp<Direct>;
+    friend class EnablePolymorphicObject<Direct, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using transposed_type = Direct<ValueType, IndexType>;
+    using l_solver_type = LowerTrs<ValueType, IndexType>;
+    using u_solver_type = UpperTrs<ValueType, IndexType>;
+
+    /**
+     * Returns the solver which is used for the lower triangular factor.
+     *
+     * @returns  the solver which is used for the lower triangular factor
+     */
+    std::shared_ptr<const l_solver_type> get_l_solver() const
+    {
+        return l_solver_;
+    }
+
+    /**
+     * Returns the solver which is used for the upper triangular factor.
+     *
+     * @returns  the solver which is used for the upper triangular factor
+     */
+    std::shared_ptr<const u_solver_type> get_u_solver() const
+    {
+        return u_solver_;
+    }
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Factory for the factorization. It needs to generate a
+         * gko::Composition of the lower and the upper triangular factor.
+         * The default value `nullptr` results in factorization::Lu.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            factorization, nullptr);
+
+        /**
+         * Number of right hand sides, passed on to the triangular solvers.
+         */
+        gko::size_type GKO_FACTORY_PARAMETER_SCALAR(num_rhs, 1u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Direct, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp *b, LinOp *x) const override;
+
+    void apply_impl(const LinOp *alpha, const LinOp *b, const LinOp *beta,
+                    LinOp *x) const override;
+
+    explicit Direct(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Direct>(std::move(exec))
+    {}
+
+    explicit Direct(const Factory *factory,
+                    std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Direct>(factory->get_executor(),
+                              gko::transpose(system_matrix->get_size())),
+          parameters_{factory->get_parameters()}
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+        const auto exec = this->get_executor();
+        if (!parameters_.factorization) {
+            parameters_.factorization =
+                factorization::Lu<ValueType, IndexType>::build().on(exec);
+        }
+        auto factors = std::shared_ptr<const LinOp>(
+            parameters_.factorization->generate(system_matrix));
+        // ensure that the result is a composition of L and U
+        auto comp =
+            std::dynamic_pointer_cast<const Composition<ValueType>>(factors);
+        if (!comp || comp->get_operators().size() != 2) {
+            GKO_NOT_SUPPORTED(factors);
+        }
+        l_solver_ = l_solver_type::build()
+                        .with_num_rhs(parameters_.num_rhs)
+                        .on(exec)
+                        ->generate(comp->get_operators()[0]);
+        u_solver_ = u_solver_type::build()
+                        .with_num_rhs(parameters_.num_rhs)
+                        .on(exec)
+                        ->generate(comp->get_operators()[1]);
+    }
+
+private:
+    std::shared_ptr<const l_solver_type> l_solver_{};
+    std::shared_ptr<const u_solver_type> u_solver_{};
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_DIRECT_HPP_
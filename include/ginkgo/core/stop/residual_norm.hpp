@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_STOP_RESIDUAL_NORM_HPP_
 
 
+#include <algorithm>
 #include <type_traits>
 
 
@@ -54,6 +55,20 @@ namespace stop {
  * initialize starting_tau_, so in the value they compare the
  * residual norm against.
  *
+ * The residual norm is taken from the `residual_norm` passed to the updater
+ * if available. Otherwise, the `implicit_sq_residual_norm` is used if the
+ * solver provides one, and only as a last resort the norm of the `residual`
+ * is computed explicitly.
+ *
+ * Since evaluating the criterion requires a reduction over the residual and
+ * a synchronization with the executor, it can be deferred: with a
+ * `check_interval` of k, the criterion is only evaluated every k-th check,
+ * all other checks report no convergence. If the interval is adaptive, the
+ * criterion estimates the convergence rate from the last two evaluations and
+ * defers the next evaluation up to half of the predicted number of remaining
+ * iterations, but at most `check_interval` checks. Deferred evaluation can
+ * cause the solver to perform a few more iterations than necessary.
+ *
  * @ingroup stop
  */
 template <typename ValueType = default_precision>
@@ -76,12 +91,26 @@ protected:
     {}
 
     explicit ResidualNorm(std::shared_ptr<const gko::Executor> exec,
-                          remove_complex<ValueType> tolerance)
+                          remove_complex<ValueType> tolerance,
+                          size_type check_interval = 1,
+                          bool adaptive_check_interval = false)
         : EnablePolymorphicObject<ResidualNorm, Criterion>(exec),
           device_storage_{exec, 2},
-          tolerance_{tolerance}
+          tolerance_{tolerance},
+          check_interval_{std::max(check_interval, size_type{1})},
+          adaptive_check_interval_{adaptive_check_interval},
+          last_tau_{exec->get_master()}
     {}
 
+    /**
+     * Updates the number of checks until the next evaluation of the
+     * criterion from the convergence rate observed between the last two
+     * evaluations.
+     *
+     * @param dense_tau  the residual norms of the current evaluation
+     */
+    void update_check_interval(const NormVector *dense_tau);
+
     std::unique_ptr<NormVector> starting_tau_{};
     std::unique_ptr<NormVector> u_dense_tau_{};
 
@@ -89,6 +118,15 @@ private:
     remove_complex<ValueType> tolerance_{};
     /* Contains device side: all_converged and one_changed booleans */
     Array<bool> device_storage_;
+    size_type check_interval_{1};
+    bool adaptive_check_interval_{false};
+    /* Number of checks performed and the check of the next evaluation */
+    size_type num_checks_{};
+    size_type next_check_{};
+    size_type last_check_{};
+    /* Host side copies of the norms of the last evaluation */
+    Array<remove_complex<ValueType>> last_tau_;
+    std::unique_ptr<NormVector> host_starting_tau_{};
 };
 
 
@@ -121,6 +159,19 @@ public:
          */
         remove_complex<ValueType> GKO_FACTORY_PARAMETER_SCALAR(reduction_factor,
                                                                1e-15);
+
+        /**
+         * Number of checks between two evaluations of the criterion. If
+         * `adaptive_check_interval` is set, this is the maximum number of
+         * checks between two evaluations.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(check_interval, 1u);
+
+        /**
+         * Adapts the number of checks between two evaluations to the
+         * observed convergence rate.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(adaptive_check_interval, false);
     };
     GKO_ENABLE_CRITERION_FACTORY(ResidualNormReduction<ValueType>, parameters,
                                  Factory);
@@ -134,7 +185,10 @@ protected:
     explicit ResidualNormReduction(const Factory *factory,
                                    const CriterionArgs &args)
         : ResidualNorm<ValueType>(factory->get_executor(),
-                                  factory->get_parameters().reduction_factor),
+                                  factory->get_parameters().reduction_factor,
+                                  factory->get_parameters().check_interval,
+                                  factory->get_parameters()
+                                      .adaptive_check_interval),
           parameters_{factory->get_parameters()}
     {
         if (args.initial_residual == nullptr) {
@@ -181,6 +235,19 @@ public:
          */
         remove_complex<ValueType> GKO_FACTORY_PARAMETER_SCALAR(tolerance,
                                                                1e-15);
+
+        /**
+         * Number of checks between two evaluations of the criterion. If
+         * `adaptive_check_interval` is set, this is the maximum number of
+         * checks between two evaluations.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(check_interval, 1u);
+
+        /**
+         * Adapts the number of checks between two evaluations to the
+         * observed convergence rate.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(adaptive_check_interval, false);
     };
     GKO_ENABLE_CRITERION_FACTORY(RelativeResidualNorm<ValueType>, parameters,
                                  Factory);
@@ -194,7 +261,10 @@ protected:
     explicit RelativeResidualNorm(const Factory *factory,
                                   const CriterionArgs &args)
         : ResidualNorm<ValueType>(factory->get_executor(),
-                                  factory->get_parameters().tolerance),
+                                  factory->get_parameters().tolerance,
+                                  factory->get_parameters().check_interval,
+                                  factory->get_parameters()
+                                      .adaptive_check_interval),
           parameters_{factory->get_parameters()}
     {
         if (args.b == nullptr) {
@@ -240,6 +310,19 @@ public:
          */
         remove_complex<ValueType> GKO_FACTORY_PARAMETER_SCALAR(tolerance,
                                                                1e-15);
+
+        /**
+         * Number of checks between two evaluations of the criterion. If
+         * `adaptive_check_interval` is set, this is the maximum number of
+         * checks between two evaluations.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(check_interval, 1u);
+
+        /**
+         * Adapts the number of checks between two evaluations to the
+         * observed convergence rate.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(adaptive_check_interval, false);
     };
     GKO_ENABLE_CRITERION_FACTORY(AbsoluteResidualNorm<ValueType>, parameters,
                                  Factory);
@@ -255,7 +338,10 @@ protected:
     explicit AbsoluteResidualNorm(const Factory *factory,
                                   const CriterionArgs &args)
         : ResidualNorm<ValueType>(factory->get_executor(),
-                                  factory->get_parameters().tolerance),
+                                  factory->get_parameters().tolerance,
+                                  factory->get_parameters().check_interval,
+                                  factory->get_parameters()
+                                      .adaptive_check_interval),
           parameters_{factory->get_parameters()}
     {
         if (args.b == nullptr) {
@@ -0,0 +1,150 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/ic_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The ic factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace ic_factorization {
+
+
+template <typename ValueType, typename IndexType>
+void compute_row(IndexType row, const IndexType *row_ptrs,
+                 const IndexType *col_idxs, ValueType *vals)
+{
+    const auto row_begin = row_ptrs[row];
+    // the diagonal entry is stored last
+    const auto row_diag = row_ptrs[row + 1] - 1;
+    auto diag = vals[row_diag];
+    for (auto nz = row_begin; nz < row_diag; ++nz) {
+        const auto dep = col_idxs[nz];
+        const auto dep_diag = row_ptrs[dep + 1] - 1;
+        // sum_{k < dep} l(row, k) * conj(l(dep, k)) on the pattern of L
+        auto sum = zero<ValueType>();
+        auto dep_nz = row_ptrs[dep];
+        for (auto row_nz = row_begin; row_nz < nz; ++row_nz) {
+            const auto col = col_idxs[row_nz];
+            while (dep_nz < dep_diag && col_idxs[dep_nz] < col) {
+                ++dep_nz;
+            }
+            if (dep_nz < dep_diag && col_idxs[dep_nz] == col) {
+                sum += vals[row_nz] * conj(vals[dep_nz]);
+            }
+        }
+        const auto val = (vals[nz] - sum) / vals[dep_diag];
+        vals[nz] = val;
+        diag -= squared_norm(val);
+    }
+    // the dropped fill-in may cause a breakdown, use a sentinel then
+    diag = sqrt(diag);
+    if (!is_finite(diag) || diag == zero<ValueType>()) {
+        diag = one<ValueType>();
+    }
+    vals[row_diag] = diag;
+}
+
+
+template <typename ValueType, typename IndexType>
+void compute(std::shared_ptr<const OmpExecutor> exec,
+             matrix::Csr<ValueType, IndexType> *l_factor)
+{
+    const auto row_ptrs = l_factor->get_const_row_ptrs();
+    const auto col_idxs = l_factor->get_const_col_idxs();
+    auto vals = l_factor->get_values();
+    const auto num_rows = static_cast<IndexType>(l_factor->get_size()[0]);
+    // row i depends on all rows j with l(i, j) != 0, so its level in the
+    // dependency graph is one above the highest level of these rows
+    vector<IndexType> levels(num_rows, exec);
+    IndexType num_levels{};
+    for (IndexType row = 0; row < num_rows; ++row) {
+        IndexType level{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1] - 1; ++nz) {
+            level = std::max(level, levels[col_idxs[nz]] + 1);
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    // bucket the rows by level, keeping them sorted within each level
+    vector<IndexType> level_ptrs(num_levels + 1, 0, exec);
+    for (IndexType row = 0; row < num_rows; ++row) {
+        ++level_ptrs[levels[row] + 1];
+    }
+    std::partial_sum(level_ptrs.begin(), level_ptrs.end(), level_ptrs.begin());
+    vector<IndexType> level_rows(num_rows, exec);
+    {
+        vector<IndexType> level_fill(level_ptrs.begin(), level_ptrs.end() - 1,
+                                     exec);
+        for (IndexType row = 0; row < num_rows; ++row) {
+            level_rows[level_fill[levels[row]]++] = row;
+        }
+    }
+    // the rows within a level are independent, the implicit barrier at the end
+    // of each worksharing loop separates the levels
+#pragma omp parallel
+    for (IndexType level = 0; level < num_levels; ++level) {
+#pragma omp for schedule(dynamic, 16)
+        for (auto i = level_ptrs[level]; i < level_ptrs[level + 1]; ++i) {
+            compute_row(level_rows[i], row_ptrs, col_idxs, vals);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC_COMPUTE_KERNEL);
+
+
+}  // namespace ic_factorization
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
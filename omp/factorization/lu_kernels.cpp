@@ -0,0 +1,164 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/lu_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The LU factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace lu_factorization {
+
+
+template <typename ValueType, typename IndexType>
+void initialize(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Csr<ValueType, IndexType> *mtx,
+                matrix::Csr<ValueType, IndexType> *factors)
+{
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto vals = mtx->get_const_values();
+    const auto factor_row_ptrs = factors->get_const_row_ptrs();
+    const auto factor_col_idxs = factors->get_const_col_idxs();
+    auto factor_vals = factors->get_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < mtx->get_size()[0]; ++row) {
+        const auto factor_begin = factor_row_ptrs[row];
+        const auto factor_end = factor_row_ptrs[row + 1];
+        std::fill(factor_vals + factor_begin, factor_vals + factor_end,
+                  zero<ValueType>());
+        // both rows are sorted and the factor pattern contains the pattern of
+        // mtx, except for entries that are not part of the factor (Cholesky)
+        auto factor_nz = factor_begin;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            const auto col = col_idxs[nz];
+            while (factor_nz < factor_end && factor_col_idxs[factor_nz] < col) {
+                ++factor_nz;
+            }
+            if (factor_nz < factor_end && factor_col_idxs[factor_nz] == col) {
+                factor_vals[factor_nz] = vals[nz];
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_INITIALIZE_KERNEL);
+
+
+/**
+ * Eliminates the entries of a row left of the diagonal.
+ *
+ * @return true iff the pivot of the row is missing, zero or not finite
+ */
+template <typename ValueType, typename IndexType>
+bool factorize_row(IndexType row, const IndexType *row_ptrs,
+                   const IndexType *col_idxs, ValueType *vals)
+{
+    const auto row_end = row_ptrs[row + 1];
+    auto nz = row_ptrs[row];
+    for (; nz < row_end && col_idxs[nz] < row; ++nz) {
+        const auto dep = col_idxs[nz];
+        const auto dep_end = row_ptrs[dep + 1];
+        const auto dep_diag =
+            std::lower_bound(col_idxs + row_ptrs[dep], col_idxs + dep_end,
+                             dep) -
+            col_idxs;
+        const auto scale = vals[nz] / vals[dep_diag];
+        vals[nz] = scale;
+        // row -= scale * U(dep, :), U(dep, :) is contained in the row
+        auto out_nz = nz + 1;
+        for (auto dep_nz = dep_diag + 1; dep_nz < dep_end; ++dep_nz) {
+            const auto col = col_idxs[dep_nz];
+            while (out_nz < row_end && col_idxs[out_nz] < col) {
+                ++out_nz;
+            }
+            if (out_nz < row_end && col_idxs[out_nz] == col) {
+                vals[out_nz] -= scale * vals[dep_nz];
+            }
+        }
+    }
+    // nz now points to the diagonal entry, which is the pivot of the row
+    return nz == row_end || col_idxs[nz] != row ||
+           vals[nz] == zero<ValueType>() || !is_finite(vals[nz]);
+}
+
+
+template <typename ValueType, typename IndexType>
+void factorize(std::shared_ptr<const OmpExecutor> exec,
+               const gko::factorization::elimination_forest<IndexType> &forest,
+               matrix::Csr<ValueType, IndexType> *factors, bool *breakdowns)
+{
+    const auto row_ptrs = factors->get_const_row_ptrs();
+    const auto col_idxs = factors->get_const_col_idxs();
+    auto vals = factors->get_values();
+    const auto chain_ptrs = forest.chain_ptrs.get_const_data();
+    const auto level_ptrs = forest.level_ptrs.get_const_data();
+    const auto level_nodes = forest.level_nodes.get_const_data();
+    // the chains within a level only depend on those of previous levels,
+    // the rows of a chain depend on each other and are processed in order
+    for (size_type level = 0; level < forest.get_num_levels(); ++level) {
+#pragma omp parallel for schedule(dynamic)
+        for (auto i = level_ptrs[level]; i < level_ptrs[level + 1]; ++i) {
+            const auto chain = level_nodes[i];
+            for (auto row = chain_ptrs[chain];
+                 row < chain_ptrs[chain + 1]; ++row) {
+                breakdowns[row] =
+                    factorize_row(row, row_ptrs, col_idxs, vals);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_FACTORIZE_KERNEL);
+
+
+}  // namespace lu_factorization
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
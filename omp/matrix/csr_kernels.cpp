@@ -829,6 +829,122 @@ void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void find_value_slots(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType> *source,
+                      const Array<IndexType> &rows,
+                      const Array<IndexType> &cols, IndexType *slots)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto row_idxs = rows.get_const_data();
+    const auto col_in = cols.get_const_data();
+    const auto num_entries = static_cast<int64>(rows.get_num_elems());
+#pragma omp parallel for
+    for (int64 i = 0; i < num_entries; ++i) {
+        const auto begin = col_idxs + row_ptrs[row_idxs[i]];
+        const auto end = col_idxs + row_ptrs[row_idxs[i] + 1];
+        const auto it = std::find(begin, end, col_in[i]);
+        slots[i] = it == end ? -1 : static_cast<IndexType>(it - col_idxs);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_FIND_VALUE_SLOTS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void build_value_map(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType> *source,
+                     const Array<IndexType> &slots, IndexType *slot_ptrs,
+                     IndexType *contribution_idxs)
+{
+    const auto num_slots =
+        static_cast<int64>(source->get_num_stored_elements());
+    const auto slot_idxs = slots.get_const_data();
+    const auto num_entries = static_cast<int64>(slots.get_num_elems());
+#pragma omp parallel for
+    for (int64 slot = 0; slot <= num_slots; ++slot) {
+        slot_ptrs[slot] = zero<IndexType>();
+    }
+#pragma omp parallel for
+    for (int64 i = 0; i < num_entries; ++i) {
+#pragma omp atomic
+        ++slot_ptrs[slot_idxs[i]];
+    }
+    components::prefix_sum(exec, slot_ptrs, num_slots + 1);
+    Array<IndexType> cursors{exec, slot_ptrs, slot_ptrs + num_slots};
+    auto cursor_data = cursors.get_data();
+#pragma omp parallel for
+    for (int64 i = 0; i < num_entries; ++i) {
+        IndexType out{};
+#pragma omp atomic capture
+        out = cursor_data[slot_idxs[i]]++;
+        contribution_idxs[out] = i;
+    }
+    // the atomic scatter does not preserve the order of the contributions,
+    // restore it to make the summation deterministic
+#pragma omp parallel for
+    for (int64 slot = 0; slot < num_slots; ++slot) {
+        std::sort(contribution_idxs + slot_ptrs[slot],
+                  contribution_idxs + slot_ptrs[slot + 1]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_BUILD_VALUE_MAP_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void update_values(std::shared_ptr<const OmpExecutor> exec,
+                   const Array<IndexType> &slot_ptrs,
+                   const Array<IndexType> &contribution_idxs,
+                   const Array<ValueType> &contributions,
+                   matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto ptrs = slot_ptrs.get_const_data();
+    const auto idxs = contribution_idxs.get_const_data();
+    const auto contrib = contributions.get_const_data();
+    const auto num_slots = static_cast<int64>(mtx->get_num_stored_elements());
+    auto values = mtx->get_values();
+#pragma omp parallel for
+    for (int64 slot = 0; slot < num_slots; ++slot) {
+        auto sum = zero<ValueType>();
+        for (auto k = ptrs[slot]; k < ptrs[slot + 1]; ++k) {
+            sum += contrib[idxs[k]];
+        }
+        values[slot] = sum;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_UPDATE_VALUES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void write_matrix_data(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::Csr<ValueType, IndexType> *source,
+                       matrix_data<ValueType, IndexType> &data)
+{
+    using nonzero_type =
+        typename matrix_data<ValueType, IndexType>::nonzero_type;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto values = source->get_const_values();
+    data.nonzeros.resize(source->get_num_stored_elements());
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            data.nonzeros[nz] = nonzero_type(static_cast<IndexType>(row),
+                                             col_idxs[nz], values[nz]);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_WRITE_MATRIX_DATA_KERNEL);
+
+
 }  // namespace csr
 }  // namespace omp
 }  // namespace kernels
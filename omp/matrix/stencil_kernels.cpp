@@ -0,0 +1,268 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/matrix/stencil_kernels.hpp"
+
+
+#include <algorithm>
+#include <vector>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/components/prefix_sum.hpp"
+#include "core/matrix/stencil_utils.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Stencil matrix format namespace.
+ *
+ * @ingroup stencil
+ */
+namespace stencil {
+namespace {
+
+
+// The grid is split into tiles of tile_size_x points times tile_size_y lines,
+// which are swept along z. This keeps the three planes of the input vector
+// touched by a 3D stencil in cache while they are reused.
+constexpr int64 tile_size_x = 512;
+constexpr int64 tile_size_y = 8;
+
+
+/**
+ * Computes c = alpha * A * b + beta * c on a single tile of the grid.
+ *
+ * If alpha is nullptr, it is treated as 1, if beta is nullptr, c is
+ * overwritten. For each stencil point, the range of grid points for which the
+ * point lies inside of the grid is computed in advance, so the innermost loop
+ * over the x direction is free of branches and can be vectorized.
+ */
+template <typename ValueType>
+void apply_tile(const matrix::Stencil<ValueType> *a,
+                const std::vector<matrix::detail::stencil_offset> &offsets,
+                const ValueType *alpha, const matrix::Dense<ValueType> *b,
+                const ValueType *beta, matrix::Dense<ValueType> *c,
+                int64 x_begin, int64 x_end, int64 y_begin, int64 y_end)
+{
+    const auto nx = static_cast<int64>(a->get_grid_size()[0]);
+    const auto ny = static_cast<int64>(a->get_grid_size()[1]);
+    const auto nz = static_cast<int64>(a->get_grid_size()[2]);
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto num_cols = static_cast<int64>(c->get_size()[1]);
+    const auto coeffs = a->get_const_coefficients();
+    const auto variable = a->has_variable_coefficients();
+    const auto scale = alpha ? *alpha : one<ValueType>();
+    const auto b_vals = b->get_const_values();
+    const auto b_stride = static_cast<int64>(b->get_stride());
+    auto c_vals = c->get_values();
+    const auto c_stride = static_cast<int64>(c->get_stride());
+    for (int64 z = 0; z < nz; ++z) {
+        for (auto y = y_begin; y < y_end; ++y) {
+            const auto line = nx * (y + ny * z);
+            for (int64 j = 0; j < num_cols; ++j) {
+                if (beta) {
+                    const auto vbeta = *beta;
+#pragma omp simd
+                    for (auto x = x_begin; x < x_end; ++x) {
+                        c_vals[(line + x) * c_stride + j] *= vbeta;
+                    }
+                } else {
+#pragma omp simd
+                    for (auto x = x_begin; x < x_end; ++x) {
+                        c_vals[(line + x) * c_stride + j] = zero<ValueType>();
+                    }
+                }
+            }
+            for (size_type p = 0; p < offsets.size(); ++p) {
+                const auto &offset = offsets[p];
+                if (y + offset.y < 0 || y + offset.y >= ny ||
+                    z + offset.z < 0 || z + offset.z >= nz) {
+                    continue;
+                }
+                const auto begin = std::max(x_begin, int64{offset.x < 0});
+                const auto end = std::min(x_end, nx - (offset.x > 0));
+                const auto shift = offset.x + nx * (offset.y + ny * offset.z);
+                for (int64 j = 0; j < num_cols; ++j) {
+                    if (variable) {
+                        const auto point_coeffs = coeffs + p * num_rows + line;
+#pragma omp simd
+                        for (auto x = begin; x < end; ++x) {
+                            c_vals[(line + x) * c_stride + j] +=
+                                scale * point_coeffs[x] *
+                                b_vals[(line + shift + x) * b_stride + j];
+                        }
+                    } else {
+                        const auto coeff = scale * coeffs[p];
+#pragma omp simd
+                        for (auto x = begin; x < end; ++x) {
+                            c_vals[(line + x) * c_stride + j] +=
+                                coeff *
+                                b_vals[(line + shift + x) * b_stride + j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+template <typename ValueType>
+void apply(const matrix::Stencil<ValueType> *a, const ValueType *alpha,
+           const matrix::Dense<ValueType> *b, const ValueType *beta,
+           matrix::Dense<ValueType> *c)
+{
+    const auto offsets = matrix::detail::get_stencil_offsets(
+        a->get_num_dimensions(), a->get_shape());
+    const auto nx = static_cast<int64>(a->get_grid_size()[0]);
+    const auto ny = static_cast<int64>(a->get_grid_size()[1]);
+    const auto num_tiles_x = ceildiv(nx, tile_size_x);
+    const auto num_tiles_y = ceildiv(ny, tile_size_y);
+#pragma omp parallel for
+    for (int64 tile = 0; tile < num_tiles_x * num_tiles_y; ++tile) {
+        const auto x_begin = tile % num_tiles_x * tile_size_x;
+        const auto y_begin = tile / num_tiles_x * tile_size_y;
+        apply_tile(a, offsets, alpha, b, beta, c, x_begin,
+                   std::min(x_begin + tile_size_x, nx), y_begin,
+                   std::min(y_begin + tile_size_y, ny));
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Stencil<ValueType> *a,
+          const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *c)
+{
+    apply<ValueType>(a, nullptr, b, nullptr, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType> *alpha,
+                   const matrix::Stencil<ValueType> *a,
+                   const matrix::Dense<ValueType> *b,
+                   const matrix::Dense<ValueType> *beta,
+                   matrix::Dense<ValueType> *c)
+{
+    apply(a, alpha->get_const_values(), b, beta->get_const_values(), c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Stencil<ValueType> *source,
+                    matrix::Csr<ValueType, IndexType> *result)
+{
+    const auto offsets = matrix::detail::get_stencil_offsets(
+        source->get_num_dimensions(), source->get_shape());
+    const auto &grid_size = source->get_grid_size();
+    const auto num_rows = static_cast<int64>(source->get_size()[0]);
+    const auto coeffs = source->get_const_coefficients();
+    const auto variable = source->has_variable_coefficients();
+    auto row_ptrs = result->get_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto values = result->get_values();
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        IndexType row_nnz{};
+        for (const auto &offset : offsets) {
+            const auto col =
+                matrix::detail::get_stencil_column(grid_size, row, offset);
+            if (col >= 0) {
+                ++row_nnz;
+            }
+        }
+        row_ptrs[row] = row_nnz;
+    }
+    components::prefix_sum(exec, row_ptrs, num_rows + 1);
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        auto nz = row_ptrs[row];
+        for (size_type p = 0; p < offsets.size(); ++p) {
+            const auto col = matrix::detail::get_stencil_column(grid_size, row,
+                                                                offsets[p]);
+            if (col >= 0) {
+                col_idxs[nz] = static_cast<IndexType>(col);
+                values[nz] = variable ? coeffs[p * num_rows + row] : coeffs[p];
+                ++nz;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_CONVERT_TO_CSR_KERNEL);
+
+
+template <typename ValueType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Stencil<ValueType> *source,
+                      matrix::Diagonal<ValueType> *diag)
+{
+    // the center point is always in the middle of the stencil points
+    const auto center = source->get_num_points() / 2;
+    const auto num_rows = static_cast<int64>(source->get_size()[0]);
+    const auto coeffs = source->get_const_coefficients();
+    const auto variable = source->has_variable_coefficients();
+    auto diag_values = diag->get_values();
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        diag_values[row] =
+            variable ? coeffs[center * num_rows + row] : coeffs[center];
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
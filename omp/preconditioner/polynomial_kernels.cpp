@@ -0,0 +1,139 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/polynomial_kernels.hpp"
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Polynomial preconditioner namespace.
+ *
+ * @ingroup precond
+ */
+namespace polynomial {
+
+
+template <typename ValueType>
+void invert_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                     matrix::Diagonal<ValueType> *diag)
+{
+    auto values = diag->get_values();
+    const auto size = diag->get_size()[0];
+#pragma omp parallel for
+    for (size_type i = 0; i < size; ++i) {
+        // a missing diagonal entry leaves the row unscaled
+        if (values[i] == zero<ValueType>()) {
+            values[i] = one<ValueType>();
+        } else {
+            values[i] = one<ValueType>() / values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_INVERT_DIAGONAL_KERNEL);
+
+
+template <typename ValueType>
+void neumann_step(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Diagonal<ValueType> *inv_diag,
+                  const matrix::Dense<ValueType> *b,
+                  const matrix::Dense<ValueType> *ax,
+                  matrix::Dense<ValueType> *x)
+{
+    const auto inv_diag_vals = inv_diag->get_const_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            x->at(row, col) +=
+                inv_diag_vals[row] * (b->at(row, col) - ax->at(row, col));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_POLYNOMIAL_NEUMANN_STEP_KERNEL);
+
+
+template <typename ValueType>
+void root_step(std::shared_ptr<const OmpExecutor> exec, ValueType inv_root,
+               matrix::Dense<ValueType> *r, const matrix::Dense<ValueType> *ar,
+               matrix::Dense<ValueType> *x)
+{
+#pragma omp parallel for
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            x->at(row, col) += inv_root * r->at(row, col);
+            r->at(row, col) -= inv_root * ar->at(row, col);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_ROOT_STEP_KERNEL);
+
+
+template <typename ValueType>
+void pair_step(std::shared_ptr<const OmpExecutor> exec,
+               remove_complex<ValueType> two_real_part,
+               remove_complex<ValueType> inv_squared_abs,
+               const matrix::Dense<ValueType> *r, matrix::Dense<ValueType> *ar,
+               matrix::Dense<ValueType> *x)
+{
+#pragma omp parallel for
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            const auto update =
+                two_real_part * r->at(row, col) - ar->at(row, col);
+            ar->at(row, col) = update;
+            x->at(row, col) += inv_squared_abs * update;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_POLYNOMIAL_PAIR_STEP_KERNEL);
+
+
+}  // namespace polynomial
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
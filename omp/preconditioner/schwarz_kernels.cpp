@@ -0,0 +1,398 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/preconditioner/schwarz_kernels.hpp"
+
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Schwarz preconditioner namespace.
+ *
+ * @ingroup schwarz
+ */
+namespace schwarz {
+
+
+template <typename ValueType, typename IndexType>
+void partition(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Csr<ValueType, IndexType> *system_matrix,
+               size_type num_subdomains, Array<IndexType> &block_ptrs)
+{
+    const auto num_rows = system_matrix->get_size()[0];
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    if (num_subdomains == 0) {
+        num_subdomains = omp_get_max_threads();
+    }
+    num_subdomains = std::max<size_type>(1, std::min(num_subdomains, num_rows));
+    block_ptrs.resize_and_reset(num_subdomains + 1);
+    auto ptrs = block_ptrs.get_data();
+    // balance the number of nonzeros, which determines the cost of the
+    // factorization and the local solves
+    const auto nnz = static_cast<size_type>(row_ptrs[num_rows]);
+    ptrs[0] = 0;
+    for (size_type i = 1; i < num_subdomains; ++i) {
+        const auto target = static_cast<IndexType>(nnz * i / num_subdomains);
+        const auto split = static_cast<IndexType>(
+            std::lower_bound(row_ptrs, row_ptrs + num_rows, target) -
+            row_ptrs);
+        ptrs[i] = std::max(ptrs[i - 1], split);
+    }
+    ptrs[num_subdomains] = static_cast<IndexType>(num_rows);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_PARTITION_KERNEL);
+
+
+template <typename IndexType>
+vector<IndexType> find_subdomain_rows(
+    std::shared_ptr<const OmpExecutor> exec, const IndexType *row_ptrs,
+    const IndexType *col_idxs, IndexType begin, IndexType end,
+    size_type overlap)
+{
+    vector<IndexType> rows(end - begin, exec);
+    std::iota(rows.begin(), rows.end(), begin);
+    vector<IndexType> frontier(rows);
+    vector<IndexType> candidates(exec);
+    vector<IndexType> new_rows(exec);
+    vector<IndexType> merged(exec);
+    // add one layer of neighbors of the previously added rows at a time
+    for (size_type layer = 0; layer < overlap && !frontier.empty(); ++layer) {
+        candidates.clear();
+        for (auto row : frontier) {
+            candidates.insert(candidates.end(), col_idxs + row_ptrs[row],
+                              col_idxs + row_ptrs[row + 1]);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                         candidates.end());
+        new_rows.clear();
+        std::set_difference(candidates.begin(), candidates.end(),
+                            rows.begin(), rows.end(),
+                            std::back_inserter(new_rows));
+        merged.clear();
+        std::merge(rows.begin(), rows.end(), new_rows.begin(), new_rows.end(),
+                   std::back_inserter(merged));
+        std::swap(rows, merged);
+        std::swap(frontier, new_rows);
+    }
+    return rows;
+}
+
+
+template <typename ValueType, typename IndexType>
+void find_subdomains(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType> *system_matrix,
+                     const Array<IndexType> &block_ptrs, size_type overlap,
+                     Array<IndexType> &subdomain_ptrs,
+                     Array<IndexType> &subdomain_rows)
+{
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto blocks = block_ptrs.get_const_data();
+    const auto num_subdomains = block_ptrs.get_num_elems() - 1;
+    subdomain_ptrs.resize_and_reset(num_subdomains + 1);
+    auto ptrs = subdomain_ptrs.get_data();
+    ptrs[0] = 0;
+    std::vector<vector<IndexType>> rows(num_subdomains,
+                                        vector<IndexType>(exec));
+#pragma omp parallel for schedule(dynamic)
+    for (size_type s = 0; s < num_subdomains; ++s) {
+        rows[s] = find_subdomain_rows(exec, row_ptrs, col_idxs, blocks[s],
+                                      blocks[s + 1], overlap);
+    }
+    for (size_type s = 0; s < num_subdomains; ++s) {
+        ptrs[s + 1] = ptrs[s] + static_cast<IndexType>(rows[s].size());
+    }
+    subdomain_rows.resize_and_reset(ptrs[num_subdomains]);
+#pragma omp parallel for
+    for (size_type s = 0; s < num_subdomains; ++s) {
+        std::copy(rows[s].begin(), rows[s].end(),
+                  subdomain_rows.get_data() + ptrs[s]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FIND_SUBDOMAINS_KERNEL);
+
+
+/**
+ * Extracts the entries of a row of the principal submatrix of a subdomain,
+ * including an explicit diagonal entry. The columns are shifted by `offset`.
+ * Returns the number of entries, which are only written if `out_cols` is not
+ * null.
+ */
+template <typename ValueType, typename IndexType>
+IndexType extract_local_row(IndexType local_row, const IndexType *sd_begin,
+                            const IndexType *sd_end, IndexType offset,
+                            const IndexType *row_ptrs,
+                            const IndexType *col_idxs, const ValueType *vals,
+                            IndexType *out_cols, ValueType *out_vals)
+{
+    const auto row = sd_begin[local_row];
+    IndexType count{};
+    bool has_diag{};
+    auto write = [&](IndexType local_col, ValueType val) {
+        if (out_cols) {
+            out_cols[count] = offset + local_col;
+            out_vals[count] = val;
+        }
+        ++count;
+    };
+    auto search_begin = sd_begin;
+    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+        const auto col = col_idxs[nz];
+        search_begin = std::lower_bound(search_begin, sd_end, col);
+        if (search_begin == sd_end) {
+            break;
+        }
+        if (*search_begin != col) {
+            continue;
+        }
+        const auto local_col = static_cast<IndexType>(search_begin - sd_begin);
+        if (!has_diag && local_col > local_row) {
+            write(local_row, zero<ValueType>());
+        }
+        has_diag = has_diag || local_col >= local_row;
+        write(local_col, vals[nz]);
+    }
+    if (!has_diag) {
+        write(local_row, zero<ValueType>());
+    }
+    return count;
+}
+
+
+template <typename IndexType>
+IndexType find_diagonal(IndexType row, const IndexType *row_ptrs,
+                        const IndexType *col_idxs)
+{
+    return static_cast<IndexType>(
+        std::lower_bound(col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+                         row) -
+        col_idxs);
+}
+
+
+/**
+ * Computes the ILU(0) factorization of the rows `begin` to `end - 1` in-place.
+ */
+template <typename ValueType, typename IndexType>
+void factorize_block(IndexType begin, IndexType end, const IndexType *row_ptrs,
+                     const IndexType *col_idxs, ValueType *vals)
+{
+    for (auto row = begin; row < end; ++row) {
+        const auto row_end = row_ptrs[row + 1];
+        for (auto nz = row_ptrs[row]; nz < row_end && col_idxs[nz] < row;
+             ++nz) {
+            const auto dep = col_idxs[nz];
+            const auto dep_diag = find_diagonal(dep, row_ptrs, col_idxs);
+            const auto factor = vals[nz] / vals[dep_diag];
+            vals[nz] = factor;
+            // a(row, col) -= l(row, dep) * u(dep, col) on the pattern of row
+            auto row_nz = nz + 1;
+            for (auto dep_nz = dep_diag + 1; dep_nz < row_ptrs[dep + 1];
+                 ++dep_nz) {
+                const auto col = col_idxs[dep_nz];
+                while (row_nz < row_end && col_idxs[row_nz] < col) {
+                    ++row_nz;
+                }
+                if (row_nz == row_end) {
+                    break;
+                }
+                if (col_idxs[row_nz] == col) {
+                    vals[row_nz] -= factor * vals[dep_nz];
+                }
+            }
+        }
+        // replace zero pivots to keep the local solves well-defined
+        const auto diag = find_diagonal(row, row_ptrs, col_idxs);
+        if (vals[diag] == zero<ValueType>() || !is_finite(vals[diag])) {
+            vals[diag] = one<ValueType>();
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void factorize(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Csr<ValueType, IndexType> *system_matrix,
+               const Array<IndexType> &subdomain_ptrs,
+               const Array<IndexType> &subdomain_rows,
+               matrix::Csr<ValueType, IndexType> *local_factors)
+{
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto vals = system_matrix->get_const_values();
+    const auto sd_ptrs = subdomain_ptrs.get_const_data();
+    const auto sd_rows = subdomain_rows.get_const_data();
+    const auto num_subdomains = subdomain_ptrs.get_num_elems() - 1;
+    auto factor_row_ptrs = local_factors->get_row_ptrs();
+    factor_row_ptrs[0] = 0;
+#pragma omp parallel for schedule(dynamic)
+    for (size_type s = 0; s < num_subdomains; ++s) {
+        const auto begin = sd_ptrs[s];
+        const auto end = sd_ptrs[s + 1];
+        for (auto row = begin; row < end; ++row) {
+            factor_row_ptrs[row + 1] =
+                extract_local_row<ValueType, IndexType>(
+                    row - begin, sd_rows + begin, sd_rows + end, begin,
+                    row_ptrs, col_idxs, vals, nullptr, nullptr);
+        }
+    }
+    const auto num_rows = sd_ptrs[num_subdomains];
+    std::partial_sum(factor_row_ptrs, factor_row_ptrs + num_rows + 1,
+                     factor_row_ptrs);
+    const auto nnz = factor_row_ptrs[num_rows];
+    {
+        matrix::CsrBuilder<ValueType, IndexType> builder{local_factors};
+        builder.get_col_idx_array().resize_and_reset(nnz);
+        builder.get_value_array().resize_and_reset(nnz);
+    }
+    auto factor_cols = local_factors->get_col_idxs();
+    auto factor_vals = local_factors->get_values();
+    // every subdomain is extracted and factorized by a single thread
+#pragma omp parallel for schedule(dynamic)
+    for (size_type s = 0; s < num_subdomains; ++s) {
+        const auto begin = sd_ptrs[s];
+        const auto end = sd_ptrs[s + 1];
+        for (auto row = begin; row < end; ++row) {
+            const auto out = factor_row_ptrs[row];
+            extract_local_row(row - begin, sd_rows + begin, sd_rows + end,
+                              begin, row_ptrs, col_idxs, vals,
+                              factor_cols + out, factor_vals + out);
+        }
+        factorize_block(begin, end, factor_row_ptrs, factor_cols,
+                        factor_vals);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SCHWARZ_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void apply(std::shared_ptr<const OmpExecutor> exec,
+           const Array<IndexType> &block_ptrs,
+           const Array<IndexType> &subdomain_ptrs,
+           const Array<IndexType> &subdomain_rows,
+           const matrix::Csr<ValueType, IndexType> *local_factors,
+           const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *x)
+{
+    const auto row_ptrs = local_factors->get_const_row_ptrs();
+    const auto col_idxs = local_factors->get_const_col_idxs();
+    const auto vals = local_factors->get_const_values();
+    const auto blocks = block_ptrs.get_const_data();
+    const auto sd_ptrs = subdomain_ptrs.get_const_data();
+    const auto sd_rows = subdomain_rows.get_const_data();
+    const auto num_subdomains = subdomain_ptrs.get_num_elems() - 1;
+    const auto num_rhs = b->get_size()[1];
+    // the subdomains write to disjoint rows of x, so they need no
+    // synchronization
+#pragma omp parallel
+    {
+        vector<ValueType> local(exec);
+#pragma omp for schedule(dynamic)
+        for (size_type s = 0; s < num_subdomains; ++s) {
+            const auto begin = sd_ptrs[s];
+            const auto end = sd_ptrs[s + 1];
+            local.resize((end - begin) * num_rhs);
+            auto local_at = [&](IndexType row, size_type rhs) -> ValueType & {
+                return local[(row - begin) * num_rhs + rhs];
+            };
+            for (auto row = begin; row < end; ++row) {
+                for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                    local_at(row, rhs) = b->at(sd_rows[row], rhs);
+                }
+            }
+            // forward substitution with the unit lower triangular factor
+            for (auto row = begin; row < end; ++row) {
+                for (auto nz = row_ptrs[row]; col_idxs[nz] < row; ++nz) {
+                    const auto col = col_idxs[nz];
+                    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                        local_at(row, rhs) -= vals[nz] * local_at(col, rhs);
+                    }
+                }
+            }
+            // backward substitution with the upper triangular factor
+            for (auto row = end; row-- > begin;) {
+                const auto diag = find_diagonal(row, row_ptrs, col_idxs);
+                for (auto nz = diag + 1; nz < row_ptrs[row + 1]; ++nz) {
+                    const auto col = col_idxs[nz];
+                    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                        local_at(row, rhs) -= vals[nz] * local_at(col, rhs);
+                    }
+                }
+                for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                    local_at(row, rhs) /= vals[diag];
+                }
+            }
+            // only write back the rows owned by this subdomain
+            for (auto row = begin; row < end; ++row) {
+                const auto global_row = sd_rows[row];
+                if (global_row >= blocks[s] && global_row < blocks[s + 1]) {
+                    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                        x->at(global_row, rhs) = local_at(row, rhs);
+                    }
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SCHWARZ_APPLY_KERNEL);
+
+
+}  // namespace schwarz
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,363 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/cb_gmres_kernels.hpp"
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The CB_GMRES solver namespace.
+ *
+ * @ingroup cb_gmres
+ */
+namespace cb_gmres {
+
+
+namespace {
+
+
+template <typename ValueType, typename StorageType>
+void orthogonalize(matrix::Dense<ValueType> *next_krylov_basis,
+                   krylov_range<ValueType, StorageType> krylov_bases,
+                   matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
+                   size_type rhs)
+{
+    const auto num_rows = next_krylov_basis->get_size()[0];
+#pragma omp declare reduction(add:ValueType : omp_out = omp_out + omp_in)
+    for (size_type k = 0; k < iter + 1; ++k) {
+        auto projection = zero<ValueType>();
+
+#pragma omp parallel for reduction(add : projection)
+        for (size_type j = 0; j < num_rows; ++j) {
+            projection +=
+                next_krylov_basis->at(j, rhs) *
+                conj(static_cast<ValueType>(
+                    krylov_bases(j + k * num_rows, rhs)));
+        }
+#pragma omp parallel for
+        for (size_type j = 0; j < num_rows; ++j) {
+            next_krylov_basis->at(j, rhs) -=
+                projection *
+                static_cast<ValueType>(krylov_bases(j + k * num_rows, rhs));
+        }
+        hessenberg_iter->at(k, rhs) += projection;
+    }
+}
+
+
+template <typename ValueType>
+remove_complex<ValueType> compute_norm(
+    const matrix::Dense<ValueType> *next_krylov_basis, size_type rhs)
+{
+    const auto num_rows = next_krylov_basis->get_size()[0];
+#pragma omp declare reduction(add:ValueType : omp_out = omp_out + omp_in)
+    ValueType norm = zero<ValueType>();
+
+#pragma omp parallel for reduction(add : norm)
+    for (size_type j = 0; j < num_rows; ++j) {
+        norm += squared_norm(next_krylov_basis->at(j, rhs));
+    }
+    return sqrt(real(norm));
+}
+
+
+template <typename ValueType, typename StorageType>
+void finish_arnoldi(matrix::Dense<ValueType> *next_krylov_basis,
+                    krylov_range<ValueType, StorageType> krylov_bases,
+                    matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
+                    const stopping_status *stop_status)
+{
+    const auto num_rows = next_krylov_basis->get_size()[0];
+    for (size_type i = 0; i < next_krylov_basis->get_size()[1]; ++i) {
+        if (stop_status[i].has_stopped()) {
+            continue;
+        }
+        for (size_type k = 0; k < iter + 1; ++k) {
+            hessenberg_iter->at(k, i) = zero<ValueType>();
+        }
+        const auto previous_norm = compute_norm(next_krylov_basis, i);
+        orthogonalize(next_krylov_basis, krylov_bases, hessenberg_iter, iter,
+                      i);
+        // for k in 0:iter
+        //     hessenberg(k, iter) = next_krylov_basis' * krylov_bases(:, k)
+        //     next_krylov_basis  -= hessenberg(k, iter) * krylov_bases(:, k)
+        // end
+
+        auto norm = compute_norm(next_krylov_basis, i);
+        // the reduced precision basis loses orthogonality quickly, so a
+        // second pass is done whenever cancellation occurred
+        if (norm < previous_norm / sqrt(remove_complex<ValueType>{2})) {
+            orthogonalize(next_krylov_basis, krylov_bases, hessenberg_iter,
+                          iter, i);
+            norm = compute_norm(next_krylov_basis, i);
+        }
+        hessenberg_iter->at(iter + 1, i) = norm;
+        // hessenberg(iter + 1, iter) = norm(next_krylov_basis)
+        const auto next_norm = hessenberg_iter->at(iter + 1, i);
+#pragma omp parallel for
+        for (size_type j = 0; j < num_rows; ++j) {
+            next_krylov_basis->at(j, i) /= next_norm;
+            krylov_bases(j + (iter + 1) * num_rows, i) =
+                next_krylov_basis->at(j, i);
+            next_krylov_basis->at(j, i) = static_cast<ValueType>(
+                krylov_bases(j + (iter + 1) * num_rows, i));
+        }
+        // next_krylov_basis /= hessenberg(iter + 1, iter)
+        // krylov_bases(:, iter + 1) = next_krylov_basis
+        // next_krylov_basis = krylov_bases(:, iter + 1)
+        // End of arnoldi
+    }
+}
+
+
+template <typename ValueType>
+void calculate_sin_and_cos(matrix::Dense<ValueType> *givens_sin,
+                           matrix::Dense<ValueType> *givens_cos,
+                           matrix::Dense<ValueType> *hessenberg_iter,
+                           size_type iter, const size_type rhs)
+{
+    if (hessenberg_iter->at(iter, rhs) == zero<ValueType>()) {
+        givens_cos->at(iter, rhs) = zero<ValueType>();
+        givens_sin->at(iter, rhs) = one<ValueType>();
+    } else {
+        auto this_hess = hessenberg_iter->at(iter, rhs);
+        auto next_hess = hessenberg_iter->at(iter + 1, rhs);
+        const auto scale = abs(this_hess) + abs(next_hess);
+        const auto hypotenuse =
+            scale * sqrt(abs(this_hess / scale) * abs(this_hess / scale) +
+                         abs(next_hess / scale) * abs(next_hess / scale));
+        givens_cos->at(iter, rhs) = conj(this_hess) / hypotenuse;
+        givens_sin->at(iter, rhs) = conj(next_hess) / hypotenuse;
+    }
+}
+
+
+template <typename ValueType>
+void givens_rotation(matrix::Dense<ValueType> *givens_sin,
+                     matrix::Dense<ValueType> *givens_cos,
+                     matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
+                     const stopping_status *stop_status)
+{
+#pragma omp parallel for
+    for (size_type i = 0; i < hessenberg_iter->get_size()[1]; ++i) {
+        if (stop_status[i].has_stopped()) {
+            continue;
+        }
+        for (size_type j = 0; j < iter; ++j) {
+            auto temp = givens_cos->at(j, i) * hessenberg_iter->at(j, i) +
+                        givens_sin->at(j, i) * hessenberg_iter->at(j + 1, i);
+            hessenberg_iter->at(j + 1, i) =
+                -conj(givens_sin->at(j, i)) * hessenberg_iter->at(j, i) +
+                conj(givens_cos->at(j, i)) * hessenberg_iter->at(j + 1, i);
+            hessenberg_iter->at(j, i) = temp;
+        }
+
+        calculate_sin_and_cos(givens_sin, givens_cos, hessenberg_iter, iter, i);
+
+        hessenberg_iter->at(iter, i) =
+            givens_cos->at(iter, i) * hessenberg_iter->at(iter, i) +
+            givens_sin->at(iter, i) * hessenberg_iter->at(iter + 1, i);
+        hessenberg_iter->at(iter + 1, i) = zero<ValueType>();
+    }
+}
+
+
+template <typename ValueType>
+void calculate_next_residual_norm(
+    matrix::Dense<ValueType> *givens_sin, matrix::Dense<ValueType> *givens_cos,
+    matrix::Dense<remove_complex<ValueType>> *residual_norm,
+    matrix::Dense<ValueType> *residual_norm_collection, size_type iter,
+    const stopping_status *stop_status)
+{
+#pragma omp parallel for
+    for (size_type i = 0; i < residual_norm->get_size()[1]; ++i) {
+        if (stop_status[i].has_stopped()) {
+            continue;
+        }
+        residual_norm_collection->at(iter + 1, i) =
+            -conj(givens_sin->at(iter, i)) *
+            residual_norm_collection->at(iter, i);
+        residual_norm_collection->at(iter, i) =
+            givens_cos->at(iter, i) * residual_norm_collection->at(iter, i);
+        residual_norm->at(0, i) =
+            abs(residual_norm_collection->at(iter + 1, i));
+    }
+}
+
+
+template <typename ValueType>
+void solve_upper_triangular(
+    const matrix::Dense<ValueType> *residual_norm_collection,
+    const matrix::Dense<ValueType> *hessenberg, matrix::Dense<ValueType> *y,
+    const size_type *final_iter_nums)
+{
+    const auto num_rhs = residual_norm_collection->get_size()[1];
+#pragma omp parallel for
+    for (size_type k = 0; k < num_rhs; ++k) {
+        for (int i = final_iter_nums[k] - 1; i >= 0; --i) {
+            auto temp = residual_norm_collection->at(i, k);
+            for (size_type j = i + 1; j < final_iter_nums[k]; ++j) {
+                temp -= hessenberg->at(i, j * num_rhs + k) * y->at(j, k);
+            }
+            y->at(i, k) = temp / hessenberg->at(i, i * num_rhs + k);
+        }
+    }
+}
+
+
+template <typename ValueType, typename StorageType>
+void calculate_qy(krylov_range<ValueType, StorageType> krylov_bases,
+                  const matrix::Dense<ValueType> *y,
+                  matrix::Dense<ValueType> *before_preconditioner,
+                  const size_type *final_iter_nums)
+{
+    const auto num_rows = before_preconditioner->get_size()[0];
+#pragma omp parallel for
+    for (size_type i = 0; i < num_rows; ++i) {
+        for (size_type k = 0; k < before_preconditioner->get_size()[1]; ++k) {
+            before_preconditioner->at(i, k) = zero<ValueType>();
+            for (size_type j = 0; j < final_iter_nums[k]; ++j) {
+                before_preconditioner->at(i, k) +=
+                    static_cast<ValueType>(krylov_bases(i + j * num_rows, k)) *
+                    y->at(j, k);
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename StorageType>
+void initialize_2(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Dense<ValueType> *residual,
+                  matrix::Dense<remove_complex<ValueType>> *residual_norm,
+                  matrix::Dense<ValueType> *residual_norm_collection,
+                  krylov_range<ValueType, StorageType> krylov_bases,
+                  matrix::Dense<ValueType> *next_krylov_basis,
+                  Array<size_type> *final_iter_nums, size_type krylov_dim)
+{
+    using norm_type = remove_complex<ValueType>;
+    for (size_type j = 0; j < residual->get_size()[1]; ++j) {
+        // Calculate residual norm
+        norm_type res_norm = zero<norm_type>();
+#pragma omp declare reduction(add:norm_type : omp_out = omp_out + omp_in)
+
+#pragma omp parallel for reduction(add : res_norm)
+        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
+            res_norm += squared_norm(residual->at(i, j));
+        }
+        residual_norm->at(0, j) = sqrt(res_norm);
+        residual_norm_collection->at(0, j) = residual_norm->at(0, j);
+#pragma omp parallel for
+        for (size_type i = 0; i < residual->get_size()[0]; ++i) {
+            next_krylov_basis->at(i, j) =
+                residual->at(i, j) / residual_norm->at(0, j);
+            krylov_bases(i, j) = next_krylov_basis->at(i, j);
+            // continue with the stored vector, so the Arnoldi relation
+            // holds for the basis that is used to update the solution
+            next_krylov_basis->at(i, j) =
+                static_cast<ValueType>(krylov_bases(i, j));
+        }
+        final_iter_nums->get_data()[j] = 0;
+    }
+}
+
+
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(
+    GKO_DECLARE_CB_GMRES_INITIALIZE_2_KERNEL);
+
+
+template <typename ValueType, typename StorageType>
+void step_1(std::shared_ptr<const OmpExecutor> exec,
+            matrix::Dense<ValueType> *next_krylov_basis,
+            matrix::Dense<ValueType> *givens_sin,
+            matrix::Dense<ValueType> *givens_cos,
+            matrix::Dense<remove_complex<ValueType>> *residual_norm,
+            matrix::Dense<ValueType> *residual_norm_collection,
+            krylov_range<ValueType, StorageType> krylov_bases,
+            matrix::Dense<ValueType> *hessenberg_iter, size_type iter,
+            Array<size_type> *final_iter_nums,
+            const Array<stopping_status> *stop_status)
+{
+#pragma omp parallel for
+    for (size_type i = 0; i < final_iter_nums->get_num_elems(); ++i) {
+        final_iter_nums->get_data()[i] +=
+            (1 - stop_status->get_const_data()[i].has_stopped());
+    }
+
+    finish_arnoldi(next_krylov_basis, krylov_bases, hessenberg_iter, iter,
+                   stop_status->get_const_data());
+    givens_rotation(givens_sin, givens_cos, hessenberg_iter, iter,
+                    stop_status->get_const_data());
+    calculate_next_residual_norm(givens_sin, givens_cos, residual_norm,
+                                 residual_norm_collection, iter,
+                                 stop_status->get_const_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(GKO_DECLARE_CB_GMRES_STEP_1_KERNEL);
+
+
+template <typename ValueType, typename StorageType>
+void step_2(std::shared_ptr<const OmpExecutor> exec,
+            const matrix::Dense<ValueType> *residual_norm_collection,
+            krylov_range<ValueType, StorageType> krylov_bases,
+            const matrix::Dense<ValueType> *hessenberg,
+            matrix::Dense<ValueType> *y,
+            matrix::Dense<ValueType> *before_preconditioner,
+            const Array<size_type> *final_iter_nums)
+{
+    solve_upper_triangular(residual_norm_collection, hessenberg, y,
+                           final_iter_nums->get_const_data());
+    calculate_qy(krylov_bases, y, before_preconditioner,
+                 final_iter_nums->get_const_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_CB_GMRES_TYPE(GKO_DECLARE_CB_GMRES_STEP_2_KERNEL);
+
+
+}  // namespace cb_gmres
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
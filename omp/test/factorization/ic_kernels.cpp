@@ -0,0 +1,171 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/ic_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/factorization/ic.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Ic : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using ic_type = gko::factorization::Ic<value_type, index_type>;
+
+    std::ranlux48 rand_engine;
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::shared_ptr<Csr> spd_ref;
+    std::shared_ptr<Csr> spd_omp;
+
+    Ic()
+        : rand_engine(42),
+          ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create())
+    {}
+
+    void SetUp() override
+    {
+        spd_ref = gen_spd_mtx(300);
+        spd_omp = gko::clone(omp, spd_ref);
+    }
+
+    std::unique_ptr<Csr> gen_spd_mtx(index_type size)
+    {
+        auto mtx = gko::test::generate_random_matrix<Csr>(
+            size, size, std::uniform_int_distribution<index_type>(0, 5),
+            std::normal_distribution<gko::remove_complex<value_type>>(0.0, 1.0),
+            rand_engine, ref);
+        gko::matrix_data<value_type, index_type> data;
+        mtx->write(data);
+        // make the matrix Hermitian and strictly diagonally dominant
+        gko::matrix_data<value_type, index_type> spd_data{data.size};
+        std::vector<gko::remove_complex<value_type>> row_sums(size);
+        for (const auto &entry : data.nonzeros) {
+            if (entry.row != entry.column) {
+                spd_data.nonzeros.emplace_back(entry.row, entry.column,
+                                               entry.value);
+                spd_data.nonzeros.emplace_back(entry.column, entry.row,
+                                               gko::conj(entry.value));
+                row_sums[entry.row] += std::abs(entry.value);
+                row_sums[entry.column] += std::abs(entry.value);
+            }
+        }
+        for (index_type row = 0; row < size; ++row) {
+            spd_data.nonzeros.emplace_back(row, row,
+                                           value_type{row_sums[row] + 1});
+        }
+        spd_data.ensure_row_major_order();
+        // merge entries which occur twice
+        gko::matrix_data<value_type, index_type> merged{data.size};
+        for (const auto &entry : spd_data.nonzeros) {
+            if (!merged.nonzeros.empty() &&
+                merged.nonzeros.back().row == entry.row &&
+                merged.nonzeros.back().column == entry.column) {
+                merged.nonzeros.back().value += entry.value;
+            } else {
+                merged.nonzeros.push_back(entry);
+            }
+        }
+        auto result = Csr::create(ref);
+        result->read(merged);
+        return result;
+    }
+};
+
+TYPED_TEST_CASE(Ic, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Ic, KernelComputeIsEquivalentToRef)
+{
+    using Csr = typename TestFixture::Csr;
+    auto factor_ref = gko::as<Csr>(this->spd_ref->clone());
+    factor_ref->sort_by_column_index();
+    // keep only the lower triangle
+    gko::matrix_data<typename TestFixture::value_type,
+                     typename TestFixture::index_type>
+        data;
+    factor_ref->write(data);
+    data.nonzeros.erase(
+        std::remove_if(data.nonzeros.begin(), data.nonzeros.end(),
+                       [](const auto &nz) { return nz.column > nz.row; }),
+        data.nonzeros.end());
+    factor_ref->read(data);
+    auto factor_omp = gko::clone(this->omp, factor_ref);
+
+    gko::kernels::reference::ic_factorization::compute(this->ref,
+                                                       factor_ref.get());
+    gko::kernels::omp::ic_factorization::compute(this->omp, factor_omp.get());
+
+    GKO_ASSERT_MTX_NEAR(factor_omp, factor_ref, r<typename TestFixture::value_type>::value);
+}
+
+
+TYPED_TEST(Ic, GenerateIsEquivalentToRef)
+{
+    auto fact_ref = TestFixture::ic_type::build().on(this->ref)->generate(
+        this->spd_ref);
+    auto fact_omp = TestFixture::ic_type::build().on(this->omp)->generate(
+        this->spd_omp);
+
+    GKO_ASSERT_MTX_NEAR(fact_omp->get_l_factor(), fact_ref->get_l_factor(),
+                        r<typename TestFixture::value_type>::value);
+    GKO_ASSERT_MTX_NEAR(fact_omp->get_lt_factor(), fact_ref->get_lt_factor(),
+                        r<typename TestFixture::value_type>::value);
+}
+
+
+}  // namespace
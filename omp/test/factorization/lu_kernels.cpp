@@ -0,0 +1,243 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/lu_kernels.hpp"
+
+
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/factorization/cholesky.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/factorization/cholesky_kernels.hpp"
+#include "core/factorization/factorization_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Lu : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using forest_type = gko::factorization::elimination_forest<index_type>;
+
+    std::ranlux48 rand_engine;
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::shared_ptr<Csr> csr_ref;
+    std::shared_ptr<Csr> spd_ref;
+
+    Lu()
+        : rand_engine(42),
+          ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create())
+    {}
+
+    void SetUp() override
+    {
+        std::string file_name(gko::matrices::location_ani1_mtx);
+        auto input_file = std::ifstream(file_name, std::ios::in);
+        if (!input_file) {
+            FAIL() << "Could not find the file \"" << file_name
+                   << "\", which is required for this test.\n";
+        }
+        auto csr_ref_temp = gko::read<Csr>(input_file, ref);
+        // Make sure there are diagonal elements present
+        gko::kernels::reference::factorization::add_diagonal_elements(
+            ref, gko::lend(csr_ref_temp), false);
+        csr_ref = gko::give(csr_ref_temp);
+        spd_ref = gen_spd_mtx(100);
+    }
+
+    std::unique_ptr<Csr> gen_spd_mtx(index_type size)
+    {
+        auto mtx = gko::test::generate_random_matrix<Csr>(
+            size, size, std::uniform_int_distribution<index_type>(0, 5),
+            std::normal_distribution<gko::remove_complex<value_type>>(0.0, 1.0),
+            rand_engine, ref);
+        gko::matrix_data<value_type, index_type> data;
+        mtx->write(data);
+        // make the matrix Hermitian and strictly diagonally dominant
+        gko::matrix_data<value_type, index_type> spd_data{data.size};
+        std::vector<gko::remove_complex<value_type>> row_sums(size);
+        for (const auto &entry : data.nonzeros) {
+            if (entry.row != entry.column) {
+                spd_data.nonzeros.emplace_back(entry.row, entry.column,
+                                               entry.value);
+                spd_data.nonzeros.emplace_back(entry.column, entry.row,
+                                               gko::conj(entry.value));
+                row_sums[entry.row] += std::abs(entry.value);
+                row_sums[entry.column] += std::abs(entry.value);
+            }
+        }
+        for (index_type row = 0; row < size; ++row) {
+            spd_data.nonzeros.emplace_back(row, row,
+                                           value_type{row_sums[row] + 1});
+        }
+        spd_data.ensure_row_major_order();
+        // merge entries which occur twice
+        gko::matrix_data<value_type, index_type> merged{data.size};
+        for (const auto &entry : spd_data.nonzeros) {
+            if (!merged.nonzeros.empty() &&
+                merged.nonzeros.back().row == entry.row &&
+                merged.nonzeros.back().column == entry.column) {
+                merged.nonzeros.back().value += entry.value;
+            } else {
+                merged.nonzeros.push_back(entry);
+            }
+        }
+        auto result = Csr::create(ref);
+        result->read(merged);
+        return result;
+    }
+};
+
+TYPED_TEST_CASE(Lu, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Lu, KernelInitializeIsEquivalentToRef)
+{
+    using forest_type = typename TestFixture::forest_type;
+    forest_type forest{this->ref, this->csr_ref->get_size()[0]};
+    auto factors_ref =
+        gko::factorization::symbolic_lu(this->csr_ref.get(), forest);
+    auto factors_omp = gko::clone(this->omp, factors_ref);
+    auto csr_omp = gko::clone(this->omp, this->csr_ref);
+
+    gko::kernels::reference::lu_factorization::initialize(
+        this->ref, this->csr_ref.get(), factors_ref.get());
+    gko::kernels::omp::lu_factorization::initialize(
+        this->omp, csr_omp.get(), factors_omp.get());
+
+    GKO_ASSERT_MTX_NEAR(factors_ref, factors_omp, 0.);
+}
+
+
+TYPED_TEST(Lu, KernelFactorizeIsEquivalentToRef)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using value_type = typename TestFixture::value_type;
+    forest_type forest{this->ref, this->csr_ref->get_size()[0]};
+    auto factors_ref =
+        gko::factorization::symbolic_lu(this->csr_ref.get(), forest);
+    gko::kernels::reference::lu_factorization::initialize(
+        this->ref, this->csr_ref.get(), factors_ref.get());
+    auto factors_omp = gko::clone(this->omp, factors_ref);
+    const auto num_rows = factors_ref->get_size()[0];
+    gko::Array<bool> breakdowns_ref{this->ref, num_rows};
+    gko::Array<bool> breakdowns_omp{this->omp, num_rows};
+
+    gko::kernels::reference::lu_factorization::factorize(
+        this->ref, forest, factors_ref.get(), breakdowns_ref.get_data());
+    gko::kernels::omp::lu_factorization::factorize(
+        this->omp, forest, factors_omp.get(), breakdowns_omp.get_data());
+
+    GKO_ASSERT_MTX_NEAR(factors_ref, factors_omp, r<value_type>::value);
+    GKO_ASSERT_ARRAY_EQ(breakdowns_ref, breakdowns_omp);
+}
+
+
+TYPED_TEST(Lu, CholeskyKernelFactorizeIsEquivalentToRef)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using value_type = typename TestFixture::value_type;
+    forest_type forest{this->ref, this->spd_ref->get_size()[0]};
+    auto factor_ref =
+        gko::factorization::symbolic_cholesky(this->spd_ref.get(), forest);
+    gko::kernels::reference::lu_factorization::initialize(
+        this->ref, this->spd_ref.get(), factor_ref.get());
+    auto factor_omp = gko::clone(this->omp, factor_ref);
+    const auto num_rows = factor_ref->get_size()[0];
+    gko::Array<bool> breakdowns_ref{this->ref, num_rows};
+    gko::Array<bool> breakdowns_omp{this->omp, num_rows};
+
+    gko::kernels::reference::cholesky_factorization::factorize(
+        this->ref, forest, factor_ref.get(), breakdowns_ref.get_data());
+    gko::kernels::omp::cholesky_factorization::factorize(
+        this->omp, forest, factor_omp.get(), breakdowns_omp.get_data());
+
+    GKO_ASSERT_MTX_NEAR(factor_ref, factor_omp, r<value_type>::value);
+    GKO_ASSERT_ARRAY_EQ(breakdowns_ref, breakdowns_omp);
+}
+
+
+TYPED_TEST(Lu, LuIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Lu = gko::factorization::Lu<value_type, index_type>;
+
+    auto fact_ref = Lu::build().on(this->ref)->generate(this->csr_ref);
+    auto fact_omp = Lu::build().on(this->omp)->generate(this->csr_ref);
+
+    GKO_ASSERT_MTX_NEAR(fact_ref->get_l_factor(), fact_omp->get_l_factor(),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(fact_ref->get_u_factor(), fact_omp->get_u_factor(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Lu, CholeskyIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Cholesky = gko::factorization::Cholesky<value_type, index_type>;
+
+    auto fact_ref = Cholesky::build().on(this->ref)->generate(this->spd_ref);
+    auto fact_omp = Cholesky::build().on(this->omp)->generate(this->spd_ref);
+
+    GKO_ASSERT_MTX_NEAR(fact_ref->get_l_factor(), fact_omp->get_l_factor(),
+                        r<value_type>::value);
+}
+
+
+}  // namespace
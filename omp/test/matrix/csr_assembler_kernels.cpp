@@ -0,0 +1,197 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/matrix/csr_assembler_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class CsrAssembler : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Assembler = gko::matrix::CsrAssembler<value_type, index_type>;
+    using index_array = gko::Array<index_type>;
+    using value_array = gko::Array<value_type>;
+
+    CsrAssembler() : rand_engine(42) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+        mtx = gko::test::generate_random_matrix<Csr>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<index_type>(0, 30),
+            std::normal_distribution<value_type>(0.0, 1.0), rand_engine, ref);
+        gko::matrix_data<value_type, index_type> data;
+        mtx->write(data);
+        std::shuffle(data.nonzeros.begin(), data.nonzeros.end(), rand_engine);
+        const auto nnz = data.nonzeros.size();
+        rows = index_array{ref, nnz};
+        cols = index_array{ref, nnz};
+        values = value_array{ref, nnz};
+        for (gko::size_type i = 0; i < nnz; ++i) {
+            rows.get_data()[i] = data.nonzeros[i].row;
+            cols.get_data()[i] = data.nonzeros[i].column;
+            values.get_data()[i] = data.nonzeros[i].value;
+        }
+    }
+
+    const gko::size_type num_rows = 1023;
+    const gko::size_type num_cols = 517;
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+    std::default_random_engine rand_engine;
+    std::unique_ptr<Csr> mtx;
+    index_array rows;
+    index_array cols;
+    value_array values;
+};
+
+
+TEST_F(CsrAssembler, CountNonzerosPerRowIsEquivalentToRef)
+{
+    index_array row_nnz{ref, num_rows + 1};
+    std::fill_n(row_nnz.get_data(), num_rows + 1, 0);
+    index_array d_row_nnz{omp, row_nnz};
+
+    gko::kernels::reference::csr_assembler::count_nonzeros_per_row(
+        ref, rows, values, row_nnz.get_data());
+    gko::kernels::omp::csr_assembler::count_nonzeros_per_row(
+        omp, index_array{omp, rows}, value_array{omp, values},
+        d_row_nnz.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(d_row_nnz, row_nnz);
+}
+
+
+TEST_F(CsrAssembler, AssemblyIsEquivalentToRef)
+{
+    Assembler assembler{ref, mtx->get_size()};
+    Assembler d_assembler{omp, mtx->get_size()};
+    const auto nnz = rows.get_num_elems();
+    const auto chunk_size = nnz / 3;
+    for (gko::size_type begin = 0; begin < nnz; begin += chunk_size) {
+        const auto size = std::min(chunk_size, nnz - begin);
+        assembler.insert(size, rows.get_const_data() + begin,
+                         cols.get_const_data() + begin,
+                         values.get_const_data() + begin);
+        d_assembler.insert(size, rows.get_const_data() + begin,
+                           cols.get_const_data() + begin,
+                           values.get_const_data() + begin);
+    }
+
+    auto result = assembler.finalize();
+    auto d_result = d_assembler.finalize();
+
+    ASSERT_EQ(d_result->get_executor(), omp);
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_result, result);
+    GKO_ASSERT_MTX_NEAR(d_result, result, 0.0);
+    GKO_ASSERT_MTX_NEAR(d_result, mtx, 0.0);
+}
+
+
+TEST_F(CsrAssembler, SummedAssemblyIsEquivalentToRef)
+{
+    Assembler assembler{ref, mtx->get_size(), true};
+    Assembler d_assembler{omp, mtx->get_size(), true};
+    // every entry is split into two halves, which are inserted separately
+    value_array halves{ref, values};
+    for (gko::size_type i = 0; i < halves.get_num_elems(); ++i) {
+        halves.get_data()[i] /= 2.0;
+    }
+    for (auto a : {&assembler, &d_assembler}) {
+        a->insert(rows, cols, halves);
+        a->insert(rows, cols, halves);
+    }
+
+    auto result = assembler.finalize();
+    auto d_result = d_assembler.finalize();
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_result, result);
+    GKO_ASSERT_MTX_NEAR(d_result, result, 0.0);
+    GKO_ASSERT_MTX_NEAR(d_result, mtx, 0.0);
+}
+
+
+TEST_F(CsrAssembler, SummedAssemblyIsBitwiseEqualToRef)
+{
+    Assembler assembler{ref, mtx->get_size(), true};
+    Assembler d_assembler{omp, mtx->get_size(), true};
+    // every entry is inserted three times within one chunk, so the copies
+    // are scattered concurrently, and their sum depends on the order
+    const auto nnz = rows.get_num_elems();
+    index_array all_rows{ref, 3 * nnz};
+    index_array all_cols{ref, 3 * nnz};
+    value_array all_values{ref, 3 * nnz};
+    for (gko::size_type i = 0; i < nnz; ++i) {
+        const auto value = values.get_const_data()[i];
+        for (int copy = 0; copy < 3; ++copy) {
+            all_rows.get_data()[3 * i + copy] = rows.get_const_data()[i];
+            all_cols.get_data()[3 * i + copy] = cols.get_const_data()[i];
+        }
+        all_values.get_data()[3 * i] = value;
+        all_values.get_data()[3 * i + 1] = value * 1e16;
+        all_values.get_data()[3 * i + 2] = value * -1e16;
+    }
+    assembler.insert(all_rows, all_cols, all_values);
+    d_assembler.insert(all_rows, all_cols, all_values);
+
+    auto result = assembler.finalize();
+    auto d_result = d_assembler.finalize();
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_result, result);
+    GKO_ASSERT_MTX_NEAR(d_result, result, 0.0);
+}
+
+
+}  // namespace
@@ -36,6 +36,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <utility>
 #include <vector>
 
 
@@ -136,6 +137,34 @@ protected:
             std::unique_ptr<Arr>(new Arr{omp, tmp2.begin(), tmp2.end()});
     }
 
+    // returns the positions of all stored entries of mtx in random order, each
+    // of them repeated between one and three times
+    std::pair<Arr, Arr> gen_contributions()
+    {
+        std::vector<int> rows;
+        std::vector<int> cols;
+        std::uniform_int_distribution<> num_repeats(1, 3);
+        for (int row = 0; row < mtx->get_size()[0]; ++row) {
+            for (auto nz = mtx->get_const_row_ptrs()[row];
+                 nz < mtx->get_const_row_ptrs()[row + 1]; ++nz) {
+                for (auto i = num_repeats(rand_engine); i > 0; --i) {
+                    rows.push_back(row);
+                    cols.push_back(mtx->get_const_col_idxs()[nz]);
+                }
+            }
+        }
+        std::vector<int> order(rows.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rand_engine);
+        Arr perm_rows{ref, rows.size()};
+        Arr perm_cols{ref, cols.size()};
+        for (gko::size_type i = 0; i < order.size(); ++i) {
+            perm_rows.get_data()[i] = rows[order[i]];
+            perm_cols.get_data()[i] = cols[order[i]];
+        }
+        return {std::move(perm_rows), std::move(perm_cols)};
+    }
+
     struct matrix_pair {
         std::unique_ptr<Mtx> ref;
         std::unique_ptr<Mtx> omp;
@@ -549,4 +578,57 @@ TEST_F(Csr, ExtractDiagonalIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, WriteIsEquivalentToRef)
+{
+    set_up_apply_data();
+    gko::matrix_data<> data;
+    gko::matrix_data<> ddata;
+
+    mtx->write(data);
+    dmtx->write(ddata);
+
+    ASSERT_EQ(data.size, ddata.size);
+    ASSERT_EQ(data.nonzeros.size(), ddata.nonzeros.size());
+    for (gko::size_type i = 0; i < data.nonzeros.size(); ++i) {
+        ASSERT_EQ(data.nonzeros[i].row, ddata.nonzeros[i].row);
+        ASSERT_EQ(data.nonzeros[i].column, ddata.nonzeros[i].column);
+        ASSERT_EQ(data.nonzeros[i].value, ddata.nonzeros[i].value);
+    }
+}
+
+TEST_F(Csr, BuildValueMapIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto contributions = gen_contributions();
+
+    auto map =
+        mtx->build_value_map(contributions.first, contributions.second);
+    auto dmap =
+        dmtx->build_value_map(contributions.first, contributions.second);
+
+    GKO_ASSERT_ARRAY_EQ(dmap.slot_ptrs, map.slot_ptrs);
+    GKO_ASSERT_ARRAY_EQ(dmap.contribution_idxs, map.contribution_idxs);
+}
+
+
+TEST_F(Csr, UpdateValuesIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto contributions = gen_contributions();
+    auto values = gen_mtx<Vec>(contributions.first.get_num_elems(), 1, 1);
+    auto value_array = gko::Array<double>::view(
+        ref, values->get_size()[0], values->get_values());
+    auto map =
+        mtx->build_value_map(contributions.first, contributions.second);
+    auto dmap =
+        dmtx->build_value_map(contributions.first, contributions.second);
+
+    mtx->update_values(map, value_array);
+    dmtx->update_values(dmap, value_array);
+
+    // the contributions are summed up in the same order
+    GKO_ASSERT_MTX_NEAR(mtx, dmtx, 0);
+}
+
+
 }  // namespace
@@ -0,0 +1,197 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Stencil : public ::testing::Test {
+protected:
+    using value_type = double;
+    using Mtx = gko::matrix::Stencil<value_type>;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using shape = gko::matrix::stencil_shape;
+
+    Stencil() : rand_engine(42) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    template <gko::size_type Dimensionality>
+    void set_up_stencil(const gko::dim<Dimensionality> &grid_size,
+                        shape stencil_shape, bool variable)
+    {
+        mtx = Mtx::create(ref, grid_size, stencil_shape, variable);
+        std::normal_distribution<value_type> dist(0.0, 1.0);
+        for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); ++i) {
+            mtx->get_coefficients()[i] = dist(rand_engine);
+        }
+        dmtx = Mtx::create(omp);
+        dmtx->copy_from(mtx.get());
+    }
+
+    void set_up_apply_data(int num_vectors)
+    {
+        const auto num_rows = mtx->get_size()[0];
+        b = gko::test::generate_random_matrix<Vec>(
+            num_rows, num_vectors,
+            std::uniform_int_distribution<>(num_vectors, num_vectors),
+            std::normal_distribution<value_type>(0.0, 1.0), rand_engine, ref);
+        x = gko::test::generate_random_matrix<Vec>(
+            num_rows, num_vectors,
+            std::uniform_int_distribution<>(num_vectors, num_vectors),
+            std::normal_distribution<value_type>(0.0, 1.0), rand_engine, ref);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        db = Vec::create(omp);
+        db->copy_from(b.get());
+        dx = Vec::create(omp);
+        dx->copy_from(x.get());
+        dalpha = Vec::create(omp);
+        dalpha->copy_from(alpha.get());
+        dbeta = Vec::create(omp);
+        dbeta->copy_from(beta.get());
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(Stencil, SimpleApply1DIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<1>{5000}, shape::star, false);
+    set_up_apply_data(1);
+
+    mtx->apply(b.get(), x.get());
+    dmtx->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(Stencil, SimpleApply2DVariableIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<2>{600, 21}, shape::star, true);
+    set_up_apply_data(1);
+
+    mtx->apply(b.get(), x.get());
+    dmtx->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(Stencil, SimpleApply3DBoxToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<3>{17, 19, 13}, shape::box, false);
+    set_up_apply_data(3);
+
+    mtx->apply(b.get(), x.get());
+    dmtx->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(Stencil, AdvancedApply3DVariableIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<3>{23, 11, 9}, shape::star, true);
+    set_up_apply_data(2);
+
+    mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+    dmtx->apply(dalpha.get(), db.get(), dbeta.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(Stencil, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<3>{15, 7, 9}, shape::box, true);
+    auto csr = Csr::create(ref);
+    auto dcsr = Csr::create(omp);
+
+    mtx->convert_to(csr.get());
+    dmtx->convert_to(dcsr.get());
+
+    GKO_ASSERT_MTX_NEAR(dcsr, csr, 0.0);
+}
+
+
+TEST_F(Stencil, ExtractDiagonalIsEquivalentToRef)
+{
+    set_up_stencil(gko::dim<2>{31, 17}, shape::box, true);
+
+    auto diag = mtx->extract_diagonal();
+    auto ddiag = dmtx->extract_diagonal();
+
+    GKO_ASSERT_MTX_NEAR(ddiag, diag, 0.0);
+}
+
+
+}  // namespace
@@ -52,7 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace {
 
 
-enum struct matrix_type { lower, upper };
+enum struct matrix_type { lower, upper, general };
 class Isai : public ::testing::Test {
 protected:
     using value_type = double;
@@ -89,9 +89,14 @@ protected:
         auto nz_dist = std::uniform_int_distribution<index_type>(1, row_limit);
         auto val_dist = std::uniform_real_distribution<value_type>(-1., 1.);
         mtx = Csr::create(ref);
-        mtx = gko::test::generate_random_triangular_matrix<Csr>(
-            n, n, true, for_lower_tm, nz_dist, val_dist, rand_engine, ref,
-            gko::dim<2>{n, n});
+        if (type == matrix_type::general) {
+            mtx = gko::test::generate_random_matrix<Csr>(
+                n, n, nz_dist, val_dist, rand_engine, ref, gko::dim<2>{n, n});
+        } else {
+            mtx = gko::test::generate_random_triangular_matrix<Csr>(
+                n, n, true, for_lower_tm, nz_dist, val_dist, rand_engine, ref,
+                gko::dim<2>{n, n});
+        }
         inverse = clone_allocations(mtx.get());
 
         d_mtx = Csr::create(omp);
@@ -321,4 +326,18 @@ TEST_F(Isai, OmpIsaiScatterExcessSolutionUIsEquivalentToRef)
 }
 
 
+TEST_F(Isai, OmpIsaiGenerateGeneralInverseIsEquivalentToRef)
+{
+    initialize_data(matrix_type::general, 536, 20);
+
+    gko::kernels::reference::isai::generate_general_inverse(ref, mtx.get(),
+                                                            inverse.get());
+    gko::kernels::omp::isai::generate_general_inverse(omp, d_mtx.get(),
+                                                      d_inverse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(inverse, d_inverse);
+    GKO_ASSERT_MTX_NEAR(inverse, d_inverse, r<value_type>::value);
+}
+
+
 }  // namespace
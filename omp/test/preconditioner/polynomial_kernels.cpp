@@ -0,0 +1,187 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/polynomial.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/preconditioner/polynomial_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Polynomial : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Polynomial_type = gko::preconditioner::Polynomial<value_type>;
+
+    Polynomial() : rand_engine(42) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+        mtx = gko::share(gko::test::generate_random_matrix<Csr>(
+            num_rows, num_rows,
+            std::uniform_int_distribution<index_type>(1, 10),
+            std::uniform_real_distribution<value_type>(-1., 1.), rand_engine,
+            ref));
+        // shift the diagonal to make the matrix diagonally dominant
+        gko::matrix_data<value_type, index_type> data;
+        mtx->write(data);
+        for (gko::size_type row = 0; row < num_rows; ++row) {
+            data.nonzeros.emplace_back(row, row, 12.);
+        }
+        data.ensure_row_major_order();
+        gko::matrix_data<value_type, index_type> merged{data.size};
+        for (const auto &entry : data.nonzeros) {
+            if (!merged.nonzeros.empty() &&
+                merged.nonzeros.back().row == entry.row &&
+                merged.nonzeros.back().column == entry.column) {
+                merged.nonzeros.back().value += entry.value;
+            } else {
+                merged.nonzeros.push_back(entry);
+            }
+        }
+        mtx->read(merged);
+        d_mtx = gko::share(gko::clone(omp, mtx));
+        b = gen_mtx(num_rows, 3);
+        d_b = gko::clone(omp, b);
+    }
+
+    std::unique_ptr<Dense> gen_mtx(gko::size_type num_rows,
+                                   gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Dense>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::uniform_real_distribution<value_type>(-1., 1.), rand_engine,
+            ref);
+    }
+
+    const gko::size_type num_rows = 123;
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::default_random_engine rand_engine;
+
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> d_b;
+};
+
+
+TEST_F(Polynomial, OmpRootStepIsEquivalentToRef)
+{
+    auto r = gen_mtx(num_rows, 3);
+    auto ar = gen_mtx(num_rows, 3);
+    auto x = gen_mtx(num_rows, 3);
+    auto d_r = gko::clone(omp, r);
+    auto d_ar = gko::clone(omp, ar);
+    auto d_x = gko::clone(omp, x);
+
+    gko::kernels::reference::polynomial::root_step(ref, 0.5, r.get(),
+                                                   ar.get(), x.get());
+    gko::kernels::omp::polynomial::root_step(omp, 0.5, d_r.get(), d_ar.get(),
+                                             d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_r, r, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, 0);
+}
+
+
+TEST_F(Polynomial, OmpPairStepIsEquivalentToRef)
+{
+    auto r = gen_mtx(num_rows, 3);
+    auto ar = gen_mtx(num_rows, 3);
+    auto x = gen_mtx(num_rows, 3);
+    auto d_r = gko::clone(omp, r);
+    auto d_ar = gko::clone(omp, ar);
+    auto d_x = gko::clone(omp, x);
+
+    gko::kernels::reference::polynomial::pair_step(ref, 3.0, 0.25, r.get(),
+                                                   ar.get(), x.get());
+    gko::kernels::omp::polynomial::pair_step(omp, 3.0, 0.25, d_r.get(),
+                                             d_ar.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_ar, ar, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, 0);
+}
+
+
+TEST_F(Polynomial, OmpNeumannApplyIsEquivalentToRef)
+{
+    auto x = Dense::create(ref, b->get_size());
+    auto d_x = Dense::create(omp, b->get_size());
+    auto factory = Polynomial_type::build().with_degree(4u);
+
+    factory.on(ref)->generate(mtx)->apply(b.get(), x.get());
+    factory.on(omp)->generate(d_mtx)->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value);
+}
+
+
+TEST_F(Polynomial, OmpGmresApplyIsEquivalentToRef)
+{
+    auto x = Dense::create(ref, b->get_size());
+    auto d_x = Dense::create(omp, b->get_size());
+    auto factory = Polynomial_type::build()
+                       .with_type(gko::preconditioner::polynomial_type::gmres)
+                       .with_degree(6u);
+
+    factory.on(ref)->generate(mtx)->apply(b.get(), x.get());
+    factory.on(omp)->generate(d_mtx)->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
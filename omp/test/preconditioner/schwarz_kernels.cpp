@@ -0,0 +1,131 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/schwarz.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/preconditioner/schwarz_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Schwarz : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Schwarz_type = gko::preconditioner::Schwarz<value_type, index_type>;
+
+    Schwarz() : rand_engine(42) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+        mtx = gko::share(gko::test::generate_random_matrix<Csr>(
+            num_rows, num_rows,
+            std::uniform_int_distribution<index_type>(1, 10),
+            std::uniform_real_distribution<value_type>(-1., 1.), rand_engine,
+            ref));
+        d_mtx = gko::share(gko::clone(omp, mtx));
+        b = gko::test::generate_random_matrix<Dense>(
+            num_rows, 3, std::uniform_int_distribution<>(3, 3),
+            std::uniform_real_distribution<value_type>(-1., 1.), rand_engine,
+            ref);
+        d_b = gko::clone(omp, b);
+    }
+
+    const gko::size_type num_rows = 234;
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::default_random_engine rand_engine;
+
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> d_mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> d_b;
+};
+
+
+TEST_F(Schwarz, OmpGenerateIsEquivalentToRef)
+{
+    auto factory =
+        Schwarz_type::build().with_num_subdomains(7u).with_overlap(2u);
+
+    auto precond = factory.on(ref)->generate(mtx);
+    auto d_precond = factory.on(omp)->generate(d_mtx);
+
+    GKO_ASSERT_ARRAY_EQ(d_precond->get_block_pointers(),
+                        precond->get_block_pointers());
+    GKO_ASSERT_ARRAY_EQ(d_precond->get_subdomain_pointers(),
+                        precond->get_subdomain_pointers());
+    GKO_ASSERT_ARRAY_EQ(d_precond->get_subdomain_rows(),
+                        precond->get_subdomain_rows());
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_precond->get_local_factors(),
+                               precond->get_local_factors());
+    GKO_ASSERT_MTX_NEAR(d_precond->get_local_factors(),
+                        precond->get_local_factors(), 0.0);
+}
+
+
+TEST_F(Schwarz, OmpApplyIsEquivalentToRef)
+{
+    auto factory =
+        Schwarz_type::build().with_num_subdomains(7u).with_overlap(2u);
+    auto x = Dense::create(ref, b->get_size());
+    auto d_x = Dense::create(omp, b->get_size());
+
+    factory.on(ref)->generate(mtx)->apply(b.get(), x.get());
+    factory.on(omp)->generate(d_mtx)->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 0.0);
+}
+
+
+}  // namespace
@@ -0,0 +1,298 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/cb_gmres.hpp>
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/solver/cb_gmres_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class CbGmres : public ::testing::Test {
+protected:
+    using value_type = double;
+    using storage_type = float;
+    using norm_type = gko::remove_complex<value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using NormVector = gko::matrix::Dense<norm_type>;
+    using StorageMtx = gko::matrix::Dense<storage_type>;
+    using range_type =
+        gko::kernels::cb_gmres::krylov_range<value_type, storage_type>;
+
+    CbGmres() : rand_engine(30) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    void TearDown()
+    {
+        if (omp != nullptr) {
+            ASSERT_NO_THROW(omp->synchronize());
+        }
+    }
+
+    template <typename ValueType = value_type>
+    std::unique_ptr<gko::matrix::Dense<ValueType>> gen_mtx(int num_rows,
+                                                           int num_cols)
+    {
+        return gko::test::generate_random_matrix<gko::matrix::Dense<ValueType>>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    // views the reduced precision storage of a Krylov basis as a matrix
+    std::unique_ptr<StorageMtx> view_bases(
+        std::shared_ptr<const gko::Executor> exec,
+        gko::Array<storage_type> &storage)
+    {
+        return StorageMtx::create(
+            exec, gko::dim<2>{storage.get_num_elems() / n, n},
+            gko::Array<storage_type>::view(exec, storage.get_num_elems(),
+                                           storage.get_data()),
+            n);
+    }
+
+    range_type make_range(gko::Array<storage_type> &storage)
+    {
+        return range_type(storage.get_data(), storage.get_num_elems() / n, n,
+                          n);
+    }
+
+    void initialize_data()
+    {
+        auto bases = gen_mtx<storage_type>(m * (krylov_dim + 1), n);
+        krylov_storage = gko::Array<storage_type>(
+            ref, bases->get_const_values(),
+            bases->get_const_values() + bases->get_num_stored_elements());
+        d_krylov_storage = gko::Array<storage_type>(omp, krylov_storage);
+        next_krylov_basis = gen_mtx(m, n);
+        residual = gen_mtx(m, n);
+        residual_norm = gen_mtx<norm_type>(1, n);
+        residual_norm_collection = gen_mtx(krylov_dim + 1, n);
+        hessenberg = gen_mtx(krylov_dim + 1, krylov_dim * n);
+        hessenberg_iter = gen_mtx(krylov_dim + 1, n);
+        givens_sin = gen_mtx(krylov_dim, n);
+        givens_cos = gen_mtx(krylov_dim, n);
+        y = gen_mtx(krylov_dim, n);
+        before_preconditioner = gen_mtx(m, n);
+        stop_status = gko::Array<gko::stopping_status>(ref, n);
+        for (size_t i = 0; i < stop_status.get_num_elems(); ++i) {
+            stop_status.get_data()[i].reset();
+        }
+        final_iter_nums = gko::Array<gko::size_type>(ref, n);
+        for (size_t i = 0; i < final_iter_nums.get_num_elems(); ++i) {
+            final_iter_nums.get_data()[i] = 5;
+        }
+
+        d_next_krylov_basis = clone(omp, next_krylov_basis);
+        d_residual = clone(omp, residual);
+        d_residual_norm = clone(omp, residual_norm);
+        d_residual_norm_collection = clone(omp, residual_norm_collection);
+        d_hessenberg = clone(omp, hessenberg);
+        d_hessenberg_iter = clone(omp, hessenberg_iter);
+        d_givens_sin = clone(omp, givens_sin);
+        d_givens_cos = clone(omp, givens_cos);
+        d_y = clone(omp, y);
+        d_before_preconditioner = clone(omp, before_preconditioner);
+        d_stop_status = gko::Array<gko::stopping_status>(omp, stop_status);
+        d_final_iter_nums = gko::Array<gko::size_type>(omp, final_iter_nums);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::ranlux48 rand_engine;
+
+    const gko::size_type m = 597;
+    const gko::size_type n = 7;
+    const gko::size_type krylov_dim = 10;
+
+    gko::Array<storage_type> krylov_storage;
+    std::unique_ptr<Mtx> next_krylov_basis;
+    std::unique_ptr<Mtx> residual;
+    std::unique_ptr<NormVector> residual_norm;
+    std::unique_ptr<Mtx> residual_norm_collection;
+    std::unique_ptr<Mtx> hessenberg;
+    std::unique_ptr<Mtx> hessenberg_iter;
+    std::unique_ptr<Mtx> givens_sin;
+    std::unique_ptr<Mtx> givens_cos;
+    std::unique_ptr<Mtx> y;
+    std::unique_ptr<Mtx> before_preconditioner;
+    gko::Array<gko::stopping_status> stop_status;
+    gko::Array<gko::size_type> final_iter_nums;
+
+    gko::Array<storage_type> d_krylov_storage;
+    std::unique_ptr<Mtx> d_next_krylov_basis;
+    std::unique_ptr<Mtx> d_residual;
+    std::unique_ptr<NormVector> d_residual_norm;
+    std::unique_ptr<Mtx> d_residual_norm_collection;
+    std::unique_ptr<Mtx> d_hessenberg;
+    std::unique_ptr<Mtx> d_hessenberg_iter;
+    std::unique_ptr<Mtx> d_givens_sin;
+    std::unique_ptr<Mtx> d_givens_cos;
+    std::unique_ptr<Mtx> d_y;
+    std::unique_ptr<Mtx> d_before_preconditioner;
+    gko::Array<gko::stopping_status> d_stop_status;
+    gko::Array<gko::size_type> d_final_iter_nums;
+};
+
+
+TEST_F(CbGmres, OmpCbGmresInitialize2IsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::cb_gmres::initialize_2(
+        ref, residual.get(), residual_norm.get(),
+        residual_norm_collection.get(), make_range(krylov_storage),
+        next_krylov_basis.get(), &final_iter_nums, krylov_dim);
+    gko::kernels::omp::cb_gmres::initialize_2(
+        omp, d_residual.get(), d_residual_norm.get(),
+        d_residual_norm_collection.get(), make_range(d_krylov_storage),
+        d_next_krylov_basis.get(), &d_final_iter_nums, krylov_dim);
+
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-14);
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-14);
+    GKO_ASSERT_MTX_NEAR(view_bases(omp, d_krylov_storage),
+                        view_bases(ref, krylov_storage), 1e-6);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
+TEST_F(CbGmres, OmpCbGmresStep1IsEquivalentToRef)
+{
+    initialize_data();
+    gko::size_type iter = 5;
+
+    gko::kernels::reference::cb_gmres::step_1(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(),
+        make_range(krylov_storage), hessenberg_iter.get(), iter,
+        &final_iter_nums, &stop_status);
+    gko::kernels::omp::cb_gmres::step_1(
+        omp, d_next_krylov_basis.get(), d_givens_sin.get(),
+        d_givens_cos.get(), d_residual_norm.get(),
+        d_residual_norm_collection.get(), make_range(d_krylov_storage),
+        d_hessenberg_iter.get(), iter, &d_final_iter_nums, &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        1e-14);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis, 1e-14);
+    GKO_ASSERT_MTX_NEAR(view_bases(omp, d_krylov_storage),
+                        view_bases(ref, krylov_storage), 1e-6);
+    GKO_ASSERT_ARRAY_EQ(d_final_iter_nums, final_iter_nums);
+}
+
+
+TEST_F(CbGmres, OmpCbGmresStep2IsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::cb_gmres::step_2(
+        ref, residual_norm_collection.get(), make_range(krylov_storage),
+        hessenberg.get(), y.get(), before_preconditioner.get(),
+        &final_iter_nums);
+    gko::kernels::omp::cb_gmres::step_2(
+        omp, d_residual_norm_collection.get(), make_range(d_krylov_storage),
+        d_hessenberg.get(), d_y.get(), d_before_preconditioner.get(),
+        &d_final_iter_nums);
+
+    GKO_ASSERT_MTX_NEAR(d_y, y, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_before_preconditioner, before_preconditioner,
+                        1e-14);
+}
+
+
+TEST_F(CbGmres, OmpCbGmresApplyIsEquivalentToRef)
+{
+    auto mtx = gen_mtx(50, 50);
+    for (int i = 0; i < 50; ++i) {
+        mtx->at(i, i) += 50.0;
+    }
+    auto b = gen_mtx(50, 3);
+    auto x = gen_mtx(50, 3);
+    auto d_mtx = clone(omp, mtx);
+    auto d_b = clone(omp, b);
+    auto d_x = clone(omp, x);
+    auto factory =
+        gko::solver::CbGmres<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(ref),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(1e-6)
+                    .on(ref))
+            .with_krylov_dim(20u)
+            .on(ref);
+    auto d_factory =
+        gko::solver::CbGmres<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(omp),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(1e-6)
+                    .on(omp))
+            .with_krylov_dim(20u)
+            .on(omp);
+
+    factory->generate(gko::share(mtx))->apply(b.get(), x.get());
+    d_factory->generate(gko::share(d_mtx))->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+}  // namespace
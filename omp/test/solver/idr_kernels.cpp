@@ -0,0 +1,295 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/idr.hpp>
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/solver/idr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Idr : public ::testing::Test {
+protected:
+    using value_type = double;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using NormVector = gko::matrix::Dense<gko::remove_complex<value_type>>;
+    using Solver = gko::solver::Idr<value_type>;
+
+    Idr() : rand_engine(30) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    void TearDown()
+    {
+        if (omp != nullptr) {
+            ASSERT_NO_THROW(omp->synchronize());
+        }
+    }
+
+    template <typename ValueType = value_type>
+    std::unique_ptr<gko::matrix::Dense<ValueType>> gen_mtx(int num_rows,
+                                                           int num_cols)
+    {
+        return gko::test::generate_random_matrix<gko::matrix::Dense<ValueType>>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(0.0, 1.0), rand_engine, ref);
+    }
+
+    std::unique_ptr<Solver::Factory> make_factory(
+        std::shared_ptr<const gko::Executor> exec)
+    {
+        return Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(1e-12)
+                    .on(exec))
+            .with_subspace_dim(4u)
+            .with_deterministic(true)
+            .on(exec);
+    }
+
+    void initialize_data()
+    {
+        p = gen_mtx(s, n);
+        g = gen_mtx(n, s * nrhs);
+        g_k = gen_mtx(n, nrhs);
+        u = gen_mtx(n, s * nrhs);
+        m = gen_mtx(s, s * nrhs);
+        // keep the pivots of the small system away from zero
+        for (gko::size_type j = 0; j < s; ++j) {
+            for (gko::size_type i = 0; i < nrhs; ++i) {
+                m->at(j, j * nrhs + i) += 10.0;
+            }
+        }
+        f = gen_mtx(s, nrhs);
+        c = gen_mtx(s, nrhs);
+        v = gen_mtx(n, nrhs);
+        alpha = gen_mtx(1, nrhs);
+        omega = gen_mtx(1, nrhs);
+        tht = gen_mtx(1, nrhs);
+        residual = gen_mtx(n, nrhs);
+        residual_norm = gen_mtx<gko::remove_complex<value_type>>(1, nrhs);
+        x = gen_mtx(n, nrhs);
+        stop_status = gko::Array<gko::stopping_status>(ref, nrhs);
+        for (gko::size_type i = 0; i < nrhs; ++i) {
+            stop_status.get_data()[i].reset();
+        }
+        // exercise the skipping of converged columns
+        stop_status.get_data()[1].converge(1, true);
+
+        d_p = clone(omp, p);
+        d_g = clone(omp, g);
+        d_g_k = clone(omp, g_k);
+        d_u = clone(omp, u);
+        d_m = clone(omp, m);
+        d_f = clone(omp, f);
+        d_c = clone(omp, c);
+        d_v = clone(omp, v);
+        d_alpha = clone(omp, alpha);
+        d_omega = clone(omp, omega);
+        d_tht = clone(omp, tht);
+        d_residual = clone(omp, residual);
+        d_residual_norm = clone(omp, residual_norm);
+        d_x = clone(omp, x);
+        d_stop_status = gko::Array<gko::stopping_status>(omp, stop_status);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::ranlux48 rand_engine;
+
+    const gko::size_type n = 597;
+    const gko::size_type nrhs = 3;
+    const gko::size_type s = 4;
+
+    std::unique_ptr<Mtx> p;
+    std::unique_ptr<Mtx> g;
+    std::unique_ptr<Mtx> g_k;
+    std::unique_ptr<Mtx> u;
+    std::unique_ptr<Mtx> m;
+    std::unique_ptr<Mtx> f;
+    std::unique_ptr<Mtx> c;
+    std::unique_ptr<Mtx> v;
+    std::unique_ptr<Mtx> alpha;
+    std::unique_ptr<Mtx> omega;
+    std::unique_ptr<Mtx> tht;
+    std::unique_ptr<Mtx> residual;
+    std::unique_ptr<NormVector> residual_norm;
+    std::unique_ptr<Mtx> x;
+    gko::Array<gko::stopping_status> stop_status;
+
+    std::unique_ptr<Mtx> d_p;
+    std::unique_ptr<Mtx> d_g;
+    std::unique_ptr<Mtx> d_g_k;
+    std::unique_ptr<Mtx> d_u;
+    std::unique_ptr<Mtx> d_m;
+    std::unique_ptr<Mtx> d_f;
+    std::unique_ptr<Mtx> d_c;
+    std::unique_ptr<Mtx> d_v;
+    std::unique_ptr<Mtx> d_alpha;
+    std::unique_ptr<Mtx> d_omega;
+    std::unique_ptr<Mtx> d_tht;
+    std::unique_ptr<Mtx> d_residual;
+    std::unique_ptr<NormVector> d_residual_norm;
+    std::unique_ptr<Mtx> d_x;
+    gko::Array<gko::stopping_status> d_stop_status;
+};
+
+
+TEST_F(Idr, OmpIdrInitializeIsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::idr::initialize(ref, nrhs, m.get(), p.get(),
+                                             true, &stop_status);
+    gko::kernels::omp::idr::initialize(omp, nrhs, d_m.get(), d_p.get(), true,
+                                       &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_m, m, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_p, p, 1e-14);
+}
+
+
+TEST_F(Idr, OmpIdrStep1IsEquivalentToRef)
+{
+    initialize_data();
+    gko::size_type k = 2;
+
+    gko::kernels::reference::idr::step_1(ref, nrhs, k, m.get(), f.get(),
+                                         residual.get(), g.get(), c.get(),
+                                         v.get(), &stop_status);
+    gko::kernels::omp::idr::step_1(omp, nrhs, k, d_m.get(), d_f.get(),
+                                   d_residual.get(), d_g.get(), d_c.get(),
+                                   d_v.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_c, c, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_v, v, 1e-14);
+}
+
+
+TEST_F(Idr, OmpIdrStep2IsEquivalentToRef)
+{
+    initialize_data();
+    gko::size_type k = 2;
+
+    gko::kernels::reference::idr::step_2(ref, nrhs, k, omega.get(), v.get(),
+                                         c.get(), u.get(), &stop_status);
+    gko::kernels::omp::idr::step_2(omp, nrhs, k, d_omega.get(), d_v.get(),
+                                   d_c.get(), d_u.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_u, u, 1e-14);
+}
+
+
+TEST_F(Idr, OmpIdrStep3IsEquivalentToRef)
+{
+    initialize_data();
+    gko::size_type k = 2;
+
+    gko::kernels::reference::idr::step_3(
+        ref, nrhs, k, p.get(), g.get(), g_k.get(), u.get(), m.get(), f.get(),
+        alpha.get(), residual.get(), x.get(), &stop_status);
+    gko::kernels::omp::idr::step_3(
+        omp, nrhs, k, d_p.get(), d_g.get(), d_g_k.get(), d_u.get(), d_m.get(),
+        d_f.get(), d_alpha.get(), d_residual.get(), d_x.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_g, g, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_g_k, g_k, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_u, u, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_m, m, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_f, f, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual, residual, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+}
+
+
+TEST_F(Idr, OmpIdrComputeOmegaIsEquivalentToRef)
+{
+    initialize_data();
+    value_type kappa = 0.7;
+
+    gko::kernels::reference::idr::compute_omega(ref, nrhs, kappa, tht.get(),
+                                                residual_norm.get(),
+                                                omega.get(), &stop_status);
+    gko::kernels::omp::idr::compute_omega(omp, nrhs, kappa, d_tht.get(),
+                                          d_residual_norm.get(),
+                                          d_omega.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_omega, omega, 1e-14);
+}
+
+
+TEST_F(Idr, OmpIdrApplyIsEquivalentToRef)
+{
+    auto mtx = gen_mtx(123, 123);
+    for (int i = 0; i < 123; ++i) {
+        mtx->at(i, i) += 123.0;
+    }
+    auto b = gen_mtx(123, 3);
+    auto x = gen_mtx(123, 3);
+    auto d_mtx = clone(omp, mtx);
+    auto d_b = clone(omp, b);
+    auto d_x = clone(omp, x);
+
+    make_factory(ref)->generate(gko::share(mtx))->apply(b.get(), x.get());
+    make_factory(omp)->generate(gko::share(d_mtx))->apply(d_b.get(),
+                                                          d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+}  // namespace
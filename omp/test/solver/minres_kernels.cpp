@@ -0,0 +1,306 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/minres.hpp>
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/solver/minres_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Minres : public ::testing::Test {
+protected:
+    using value_type = double;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using NormVector = gko::matrix::Dense<gko::remove_complex<value_type>>;
+    using Solver = gko::solver::Minres<value_type>;
+
+    Minres() : rand_engine(30) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    void TearDown()
+    {
+        if (omp != nullptr) {
+            ASSERT_NO_THROW(omp->synchronize());
+        }
+    }
+
+    template <typename ValueType = value_type>
+    std::unique_ptr<gko::matrix::Dense<ValueType>> gen_mtx(int num_rows,
+                                                           int num_cols)
+    {
+        return gko::test::generate_random_matrix<gko::matrix::Dense<ValueType>>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(0.0, 1.0), rand_engine, ref);
+    }
+
+    std::unique_ptr<Solver::Factory> make_factory(
+        std::shared_ptr<const gko::Executor> exec)
+    {
+        return Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(400u).on(exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(1e-12)
+                    .on(exec))
+            .on(exec);
+    }
+
+    void initialize_data()
+    {
+        x = gen_mtx(n, nrhs);
+        r = gen_mtx(n, nrhs);
+        z = gen_mtx(n, nrhs);
+        y = gen_mtx(n, nrhs);
+        r_prev = gen_mtx(n, nrhs);
+        v = gen_mtx(n, nrhs);
+        w = gen_mtx(n, nrhs);
+        w_prev = gen_mtx(n, nrhs);
+        tau = gen_mtx(1, nrhs);
+        alpha = gen_mtx(1, nrhs);
+        beta = gen_mtx(1, nrhs);
+        prev_beta = gen_mtx(1, nrhs);
+        // the recurrences take square roots of the (M-)norms
+        for (gko::size_type i = 0; i < nrhs; ++i) {
+            tau->at(0, i) = std::abs(tau->at(0, i)) + 1.0;
+            beta->at(0, i) = std::abs(beta->at(0, i)) + 1.0;
+            prev_beta->at(0, i) = std::abs(prev_beta->at(0, i)) + 1.0;
+        }
+        phibar = gen_mtx(1, nrhs);
+        dbar = gen_mtx(1, nrhs);
+        epsilon = gen_mtx(1, nrhs);
+        cs = gen_mtx(1, nrhs);
+        sn = gen_mtx(1, nrhs);
+        residual_norm = gen_mtx<gko::remove_complex<value_type>>(1, nrhs);
+        stop_status = gko::Array<gko::stopping_status>(ref, nrhs);
+        for (gko::size_type i = 0; i < nrhs; ++i) {
+            stop_status.get_data()[i].reset();
+        }
+        stop_status.get_data()[1].converge(1, true);
+
+        d_x = clone(omp, x);
+        d_r = clone(omp, r);
+        d_z = clone(omp, z);
+        d_y = clone(omp, y);
+        d_r_prev = clone(omp, r_prev);
+        d_v = clone(omp, v);
+        d_w = clone(omp, w);
+        d_w_prev = clone(omp, w_prev);
+        d_tau = clone(omp, tau);
+        d_alpha = clone(omp, alpha);
+        d_beta = clone(omp, beta);
+        d_prev_beta = clone(omp, prev_beta);
+        d_phibar = clone(omp, phibar);
+        d_dbar = clone(omp, dbar);
+        d_epsilon = clone(omp, epsilon);
+        d_cs = clone(omp, cs);
+        d_sn = clone(omp, sn);
+        d_residual_norm = clone(omp, residual_norm);
+        d_stop_status = gko::Array<gko::stopping_status>(omp, stop_status);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    std::ranlux48 rand_engine;
+
+    const gko::size_type n = 597;
+    const gko::size_type nrhs = 7;
+
+    std::unique_ptr<Mtx> x;
+    std::unique_ptr<Mtx> r;
+    std::unique_ptr<Mtx> z;
+    std::unique_ptr<Mtx> y;
+    std::unique_ptr<Mtx> r_prev;
+    std::unique_ptr<Mtx> v;
+    std::unique_ptr<Mtx> w;
+    std::unique_ptr<Mtx> w_prev;
+    std::unique_ptr<Mtx> tau;
+    std::unique_ptr<Mtx> alpha;
+    std::unique_ptr<Mtx> beta;
+    std::unique_ptr<Mtx> prev_beta;
+    std::unique_ptr<Mtx> phibar;
+    std::unique_ptr<Mtx> dbar;
+    std::unique_ptr<Mtx> epsilon;
+    std::unique_ptr<Mtx> cs;
+    std::unique_ptr<Mtx> sn;
+    std::unique_ptr<NormVector> residual_norm;
+    gko::Array<gko::stopping_status> stop_status;
+
+    std::unique_ptr<Mtx> d_x;
+    std::unique_ptr<Mtx> d_r;
+    std::unique_ptr<Mtx> d_z;
+    std::unique_ptr<Mtx> d_y;
+    std::unique_ptr<Mtx> d_r_prev;
+    std::unique_ptr<Mtx> d_v;
+    std::unique_ptr<Mtx> d_w;
+    std::unique_ptr<Mtx> d_w_prev;
+    std::unique_ptr<Mtx> d_tau;
+    std::unique_ptr<Mtx> d_alpha;
+    std::unique_ptr<Mtx> d_beta;
+    std::unique_ptr<Mtx> d_prev_beta;
+    std::unique_ptr<Mtx> d_phibar;
+    std::unique_ptr<Mtx> d_dbar;
+    std::unique_ptr<Mtx> d_epsilon;
+    std::unique_ptr<Mtx> d_cs;
+    std::unique_ptr<Mtx> d_sn;
+    std::unique_ptr<NormVector> d_residual_norm;
+    gko::Array<gko::stopping_status> d_stop_status;
+};
+
+
+TEST_F(Minres, OmpMinresInitializeIsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::minres::initialize(
+        ref, r.get(), z.get(), r_prev.get(), v.get(), w.get(), w_prev.get(),
+        beta.get(), prev_beta.get(), phibar.get(), dbar.get(), epsilon.get(),
+        cs.get(), sn.get(), residual_norm.get(), &stop_status);
+    gko::kernels::omp::minres::initialize(
+        omp, d_r.get(), d_z.get(), d_r_prev.get(), d_v.get(), d_w.get(),
+        d_w_prev.get(), d_beta.get(), d_prev_beta.get(), d_phibar.get(),
+        d_dbar.get(), d_epsilon.get(), d_cs.get(), d_sn.get(),
+        d_residual_norm.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_r_prev, r_prev, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_v, v, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_w, w, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_w_prev, w_prev, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_beta, beta, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_prev_beta, prev_beta, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_phibar, phibar, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_dbar, dbar, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_epsilon, epsilon, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_cs, cs, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_sn, sn, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-14);
+}
+
+
+TEST_F(Minres, OmpMinresStep1IsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::minres::step_1(ref, v.get(), y.get(),
+                                            r_prev.get(), r.get(), alpha.get(),
+                                            beta.get(), prev_beta.get(),
+                                            &stop_status);
+    gko::kernels::omp::minres::step_1(omp, d_v.get(), d_y.get(),
+                                      d_r_prev.get(), d_r.get(), d_alpha.get(),
+                                      d_beta.get(), d_prev_beta.get(),
+                                      &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_y, y, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_r_prev, r_prev, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_r, r, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_alpha, alpha, 1e-14);
+}
+
+
+TEST_F(Minres, OmpMinresStep2IsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::minres::step_2(
+        ref, x.get(), v.get(), z.get(), w.get(), w_prev.get(), tau.get(),
+        alpha.get(), beta.get(), prev_beta.get(), phibar.get(), dbar.get(),
+        epsilon.get(), cs.get(), sn.get(), residual_norm.get(), &stop_status);
+    gko::kernels::omp::minres::step_2(
+        omp, d_x.get(), d_v.get(), d_z.get(), d_w.get(), d_w_prev.get(),
+        d_tau.get(), d_alpha.get(), d_beta.get(), d_prev_beta.get(),
+        d_phibar.get(), d_dbar.get(), d_epsilon.get(), d_cs.get(), d_sn.get(),
+        d_residual_norm.get(), &d_stop_status);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_v, v, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_w, w, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_w_prev, w_prev, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_beta, beta, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_prev_beta, prev_beta, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_phibar, phibar, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_dbar, dbar, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_epsilon, epsilon, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_cs, cs, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_sn, sn, 1e-14);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, 1e-14);
+}
+
+
+TEST_F(Minres, OmpMinresApplyIsEquivalentToRef)
+{
+    // symmetric indefinite matrix
+    auto mtx = gen_mtx(123, 123);
+    for (int i = 0; i < 123; ++i) {
+        for (int j = 0; j < i; ++j) {
+            mtx->at(i, j) = mtx->at(j, i);
+        }
+        mtx->at(i, i) += i % 2 == 0 ? 30.0 : -30.0;
+    }
+    auto b = gen_mtx(123, 3);
+    auto x = gen_mtx(123, 3);
+    auto d_mtx = clone(omp, mtx);
+    auto d_b = clone(omp, b);
+    auto d_x = clone(omp, x);
+
+    make_factory(ref)->generate(gko::share(mtx))->apply(b.get(), x.get());
+    make_factory(omp)->generate(gko::share(d_mtx))->apply(d_b.get(),
+                                                          d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
+}  // namespace
@@ -0,0 +1,103 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/factorization/ic_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The ic factorization namespace.
+ *
+ * @ingroup factor
+ */
+namespace ic_factorization {
+
+
+template <typename ValueType, typename IndexType>
+void compute(std::shared_ptr<const ReferenceExecutor> exec,
+             matrix::Csr<ValueType, IndexType> *l_factor)
+{
+    const auto row_ptrs = l_factor->get_const_row_ptrs();
+    const auto col_idxs = l_factor->get_const_col_idxs();
+    auto vals = l_factor->get_values();
+    const auto num_rows = static_cast<IndexType>(l_factor->get_size()[0]);
+    // processing the rows in their natural order respects all dependencies
+    for (IndexType row = 0; row < num_rows; ++row) {
+        const auto row_begin = row_ptrs[row];
+        // the diagonal entry is stored last
+        const auto row_diag = row_ptrs[row + 1] - 1;
+        auto diag = vals[row_diag];
+        for (auto nz = row_begin; nz < row_diag; ++nz) {
+            const auto dep = col_idxs[nz];
+            const auto dep_diag = row_ptrs[dep + 1] - 1;
+            // sum_{k < dep} l(row, k) * conj(l(dep, k)) on the pattern of L
+            auto sum = zero<ValueType>();
+            auto dep_nz = row_ptrs[dep];
+            for (auto row_nz = row_begin; row_nz < nz; ++row_nz) {
+                const auto col = col_idxs[row_nz];
+                while (dep_nz < dep_diag && col_idxs[dep_nz] < col) {
+                    ++dep_nz;
+                }
+                if (dep_nz < dep_diag && col_idxs[dep_nz] == col) {
+                    sum += vals[row_nz] * conj(vals[dep_nz]);
+                }
+            }
+            const auto val = (vals[nz] - sum) / vals[dep_diag];
+            vals[nz] = val;
+            diag -= squared_norm(val);
+        }
+        // the dropped fill-in may cause a breakdown, use a sentinel then
+        diag = sqrt(diag);
+        if (!is_finite(diag) || diag == zero<ValueType>()) {
+            diag = one<ValueType>();
+        }
+        vals[row_diag] = diag;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC_COMPUTE_KERNEL);
+
+
+}  // namespace ic_factorization
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
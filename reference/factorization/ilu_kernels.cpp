@@ -33,6 +33,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/factorization/ilu_kernels.hpp"
 
 
+#include <algorithm>
+#include <vector>
+
+
 namespace gko {
 namespace kernels {
 namespace reference {
@@ -46,7 +50,47 @@ namespace ilu_factorization {
 
 template <typename ValueType, typename IndexType>
 void compute_lu(std::shared_ptr<const DefaultExecutor> exec,
-                matrix::Csr<ValueType, IndexType> *m) GKO_NOT_IMPLEMENTED;
+                matrix::Csr<ValueType, IndexType> *m)
+{
+    const auto num_rows = m->get_size()[0];
+    const auto row_ptrs = m->get_const_row_ptrs();
+    const auto col_idxs = m->get_const_col_idxs();
+    auto vals = m->get_values();
+    std::vector<IndexType> diag_pos(num_rows, -1);
+    // position of each entry of the current row, indexed by its column
+    std::vector<IndexType> row_pos(m->get_size()[1], -1);
+    std::vector<IndexType> lower;
+    for (size_type row = 0; row < num_rows; ++row) {
+        lower.clear();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            const auto col = static_cast<size_type>(col_idxs[nz]);
+            row_pos[col] = nz;
+            if (col < row) {
+                lower.push_back(nz);
+            } else if (col == row) {
+                diag_pos[row] = nz;
+            }
+        }
+        // eliminate the lower entries in ascending column order
+        std::sort(lower.begin(), lower.end(), [&](IndexType a, IndexType b) {
+            return col_idxs[a] < col_idxs[b];
+        });
+        for (auto nz : lower) {
+            const auto k = col_idxs[nz];
+            vals[nz] /= vals[diag_pos[k]];
+            for (auto k_nz = row_ptrs[k]; k_nz < row_ptrs[k + 1]; ++k_nz) {
+                const auto col = col_idxs[k_nz];
+                // ILU(0): fill-in outside the pattern of the row is dropped
+                if (col > k && row_pos[col] >= 0) {
+                    vals[row_pos[col]] -= vals[nz] * vals[k_nz];
+                }
+            }
+        }
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+            row_pos[col_idxs[nz]] = -1;
+        }
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
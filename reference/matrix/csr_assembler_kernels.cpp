@@ -0,0 +1,179 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/csr_assembler_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The CSR assembler namespace.
+ *
+ * @ingroup csr
+ */
+namespace csr_assembler {
+
+
+template <typename ValueType, typename IndexType>
+void count_nonzeros_per_row(std::shared_ptr<const ReferenceExecutor> exec,
+                            const Array<IndexType> &rows,
+                            const Array<ValueType> &values, IndexType *row_nnz)
+{
+    const auto row_idxs = rows.get_const_data();
+    const auto vals = values.get_const_data();
+    for (size_type i = 0; i < rows.get_num_elems(); ++i) {
+        if (vals[i] != zero<ValueType>()) {
+            ++row_nnz[row_idxs[i]];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_COUNT_NONZEROS_PER_ROW_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in(std::shared_ptr<const ReferenceExecutor> exec,
+             const Array<IndexType> &rows, const Array<IndexType> &cols,
+             const Array<ValueType> &values, int64 first_entry,
+             IndexType *row_cursors, IndexType *col_idxs,
+             ValueType *csr_values, int64 *entry_idxs)
+{
+    const auto row_idxs = rows.get_const_data();
+    const auto col_in = cols.get_const_data();
+    const auto vals = values.get_const_data();
+    for (size_type i = 0; i < rows.get_num_elems(); ++i) {
+        if (vals[i] != zero<ValueType>()) {
+            const auto out = row_cursors[row_idxs[i]]++;
+            col_idxs[out] = col_in[i];
+            csr_values[out] = vals[i];
+            entry_idxs[out] = first_entry + static_cast<int64>(i);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_FILL_IN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sort_by_column_and_entry(std::shared_ptr<const ReferenceExecutor> exec,
+                              matrix::Csr<ValueType, IndexType> *mtx,
+                              const int64 *entry_idxs)
+{
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    auto cols = mtx->get_col_idxs();
+    auto vals = mtx->get_values();
+    std::vector<IndexType> perm;
+    std::vector<IndexType> sorted_cols;
+    std::vector<ValueType> sorted_vals;
+    for (size_type row = 0; row < mtx->get_size()[0]; ++row) {
+        const auto begin = row_ptrs[row];
+        const auto size = row_ptrs[row + 1] - begin;
+        perm.resize(size);
+        std::iota(perm.begin(), perm.end(), begin);
+        std::sort(perm.begin(), perm.end(), [&](IndexType a, IndexType b) {
+            return std::tie(cols[a], entry_idxs[a]) <
+                   std::tie(cols[b], entry_idxs[b]);
+        });
+        sorted_cols.resize(size);
+        sorted_vals.resize(size);
+        for (IndexType i = 0; i < size; ++i) {
+            sorted_cols[i] = cols[perm[i]];
+            sorted_vals[i] = vals[perm[i]];
+        }
+        std::copy(sorted_cols.begin(), sorted_cols.end(), cols + begin);
+        std::copy(sorted_vals.begin(), sorted_vals.end(), vals + begin);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_SORT_BY_COLUMN_AND_ENTRY_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sum_duplicates(std::shared_ptr<const ReferenceExecutor> exec,
+                    matrix::Csr<ValueType, IndexType> *mtx)
+{
+    const auto num_rows = mtx->get_size()[0];
+    auto row_ptrs = mtx->get_row_ptrs();
+    auto cols = mtx->get_col_idxs();
+    auto vals = mtx->get_values();
+    // compact the matrix in place, the output never overtakes the input
+    IndexType out{};
+    auto row_begin = row_ptrs[0];
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto row_end = row_ptrs[row + 1];
+        row_ptrs[row] = out;
+        auto nz = row_begin;
+        while (nz < row_end) {
+            const auto col = cols[nz];
+            auto sum = vals[nz];
+            for (++nz; nz < row_end && cols[nz] == col; ++nz) {
+                sum += vals[nz];
+            }
+            if (sum != zero<ValueType>()) {
+                cols[out] = col;
+                vals[out] = sum;
+                ++out;
+            }
+        }
+        row_begin = row_end;
+    }
+    row_ptrs[num_rows] = out;
+    matrix::CsrBuilder<ValueType, IndexType> builder{mtx};
+    builder.get_col_idx_array() = Array<IndexType>{exec, cols, cols + out};
+    builder.get_value_array() = Array<ValueType>{exec, vals, vals + out};
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLER_SUM_DUPLICATES_KERNEL);
+
+
+}  // namespace csr_assembler
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
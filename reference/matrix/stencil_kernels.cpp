@@ -0,0 +1,169 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/matrix/stencil_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/matrix/stencil_utils.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Stencil matrix format namespace.
+ *
+ * @ingroup stencil
+ */
+namespace stencil {
+namespace {
+
+
+template <typename ValueType, typename Callback>
+void for_each_entry(const matrix::Stencil<ValueType> *a, Callback callback)
+{
+    const auto offsets = matrix::detail::get_stencil_offsets(
+        a->get_num_dimensions(), a->get_shape());
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto coeffs = a->get_const_coefficients();
+    const auto variable = a->has_variable_coefficients();
+    for (int64 row = 0; row < num_rows; ++row) {
+        for (size_type p = 0; p < offsets.size(); ++p) {
+            const auto col = matrix::detail::get_stencil_column(
+                a->get_grid_size(), row, offsets[p]);
+            if (col >= 0) {
+                callback(row, col,
+                         variable ? coeffs[p * num_rows + row] : coeffs[p]);
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::Stencil<ValueType> *a,
+          const matrix::Dense<ValueType> *b, matrix::Dense<ValueType> *c)
+{
+    for (size_type row = 0; row < c->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for_each_entry(a, [&](int64 row, int64 col, ValueType val) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) += val * b->at(col, j);
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType> *alpha,
+                   const matrix::Stencil<ValueType> *a,
+                   const matrix::Dense<ValueType> *b,
+                   const matrix::Dense<ValueType> *beta,
+                   matrix::Dense<ValueType> *c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < c->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for_each_entry(a, [&](int64 row, int64 col, ValueType val) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) += valpha * val * b->at(col, j);
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Stencil<ValueType> *source,
+                    matrix::Csr<ValueType, IndexType> *result)
+{
+    auto row_ptrs = result->get_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto values = result->get_values();
+    // every row contains at least the center point of the stencil
+    row_ptrs[0] = 0;
+    IndexType nz{};
+    for_each_entry(source, [&](int64 row, int64 col, ValueType val) {
+        col_idxs[nz] = static_cast<IndexType>(col);
+        values[nz] = val;
+        ++nz;
+        row_ptrs[row + 1] = nz;
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_CONVERT_TO_CSR_KERNEL);
+
+
+template <typename ValueType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Stencil<ValueType> *source,
+                      matrix::Diagonal<ValueType> *diag)
+{
+    auto diag_values = diag->get_values();
+    for_each_entry(source, [&](int64 row, int64 col, ValueType val) {
+        if (row == col) {
+            diag_values[row] = val;
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/matrix/csr_builder.hpp"
 
 
@@ -310,6 +311,153 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
 
 
+/*
+ * Solves the least-squares problem min ||system * x - rhs|| for the
+ * column-major `num_rows x num_cols` matrix `system` using a Householder QR
+ * decomposition. `system` is overwritten, and the first num_cols entries of
+ * `rhs` (which needs to hold max(num_rows, num_cols) entries) contain x.
+ */
+template <typename ValueType>
+void solve_least_squares(ValueType *system, size_type num_rows,
+                         size_type num_cols, ValueType *rhs)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto num_steps = std::min(num_rows, num_cols);
+    for (size_type k = 0; k < num_steps; ++k) {
+        const auto col = system + k * num_rows;
+        real_type norm{};
+        for (auto i = k; i < num_rows; ++i) {
+            norm += squared_norm(col[i]);
+        }
+        norm = sqrt(norm);
+        if (norm == zero<real_type>()) {
+            continue;
+        }
+        // reflect onto -sign(col[k]) * norm * e(k) to avoid cancellation
+        const auto alpha = col[k] == zero<ValueType>()
+                               ? ValueType{-norm}
+                               : -col[k] / abs(col[k]) * norm;
+        col[k] -= alpha;
+        real_type v_norm{};
+        for (auto i = k; i < num_rows; ++i) {
+            v_norm += squared_norm(col[i]);
+        }
+        // apply I - 2 v v^H / (v^H v) to the remaining columns and the rhs
+        auto reflect = [&](ValueType *target) {
+            auto dot = zero<ValueType>();
+            for (auto i = k; i < num_rows; ++i) {
+                dot += conj(col[i]) * target[i];
+            }
+            const auto factor = real_type{2} * dot / v_norm;
+            for (auto i = k; i < num_rows; ++i) {
+                target[i] -= factor * col[i];
+            }
+        };
+        for (auto j = k + 1; j < num_cols; ++j) {
+            reflect(system + j * num_rows);
+        }
+        reflect(rhs);
+        col[k] = alpha;
+    }
+    // backward substitution with R, unknowns without a pivot are set to zero
+    for (auto k = num_steps; k-- > 0;) {
+        auto value = rhs[k];
+        for (auto j = k + 1; j < num_steps; ++j) {
+            value -= system[j * num_rows + k] * rhs[j];
+        }
+        const auto diag = system[k * num_rows + k];
+        rhs[k] = diag == zero<ValueType>() ? zero<ValueType>() : value / diag;
+    }
+    std::fill(rhs + num_steps, rhs + num_cols, zero<ValueType>());
+}
+
+
+/*
+ * Computes row `row` of the sparse approximate inverse of a general matrix.
+ * `cols`, `system` and `rhs` are work buffers.
+ */
+template <typename ValueType, typename IndexType>
+void generate_general_row(const matrix::Csr<ValueType, IndexType> *mtx,
+                          matrix::Csr<ValueType, IndexType> *inverse_mtx,
+                          size_type row, vector<IndexType> &cols,
+                          vector<ValueType> &system, vector<ValueType> &rhs)
+{
+    /*
+    Consider: aiM := inverse_mtx; M := mtx
+    S(i) := Sparsity pattern of row i of aiM (Set of non-zero columns)
+    C(i) := Union of the sparsity patterns of the rows S(i) of M
+
+    Target: minimize ||aiM[i, :] * M - e(i)^T|| for every row i
+    Only the rows S(i) of M and the columns C(i) contribute, so this is the
+    dense least-squares problem
+    M[S(i), C(i)]^T * aiM[i, S(i)]^T = e(i)[C(i)]
+    */
+    const auto m_row_ptrs = mtx->get_const_row_ptrs();
+    const auto m_cols = mtx->get_const_col_idxs();
+    const auto m_vals = mtx->get_const_values();
+    const auto i_begin = inverse_mtx->get_const_row_ptrs()[row];
+    const auto i_size =
+        static_cast<size_type>(inverse_mtx->get_const_row_ptrs()[row + 1] -
+                               i_begin);
+    const auto i_cols = inverse_mtx->get_const_col_idxs() + i_begin;
+    auto i_vals = inverse_mtx->get_values() + i_begin;
+    cols.clear();
+    for (size_type i = 0; i < i_size; ++i) {
+        const auto m_row = i_cols[i];
+        cols.insert(cols.end(), m_cols + m_row_ptrs[m_row],
+                    m_cols + m_row_ptrs[m_row + 1]);
+    }
+    std::sort(cols.begin(), cols.end());
+    cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+    const auto num_eqs = cols.size();
+    system.assign(num_eqs * i_size, zero<ValueType>());
+    rhs.assign(std::max(num_eqs, i_size), zero<ValueType>());
+    for (size_type i = 0; i < i_size; ++i) {
+        const auto m_row = i_cols[i];
+        for (auto nz = m_row_ptrs[m_row]; nz < m_row_ptrs[m_row + 1]; ++nz) {
+            const auto eq =
+                std::lower_bound(cols.begin(), cols.end(), m_cols[nz]) -
+                cols.begin();
+            system[i * num_eqs + eq] = m_vals[nz];
+        }
+    }
+    const auto diag_eq =
+        std::lower_bound(cols.begin(), cols.end(), static_cast<IndexType>(row));
+    if (diag_eq != cols.end() && *diag_eq == static_cast<IndexType>(row)) {
+        rhs[diag_eq - cols.begin()] = one<ValueType>();
+    }
+    solve_least_squares(system.data(), num_eqs, i_size, rhs.data());
+    for (size_type i = 0; i < i_size; ++i) {
+        // check for non-finite elements which should not be copied over
+        if (is_finite(rhs[i])) {
+            i_vals[i] = rhs[i];
+        } else {
+            // ensure the preconditioner does not prevent convergence
+            i_vals[i] = i_cols[i] == static_cast<IndexType>(row)
+                            ? one<ValueType>()
+                            : zero<ValueType>();
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void generate_general_inverse(std::shared_ptr<const DefaultExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType> *mtx,
+                              matrix::Csr<ValueType, IndexType> *inverse_mtx)
+{
+    vector<IndexType> cols(exec);
+    vector<ValueType> system(exec);
+    vector<ValueType> rhs(exec);
+    for (size_type row = 0; row < mtx->get_size()[0]; ++row) {
+        generate_general_row(mtx, inverse_mtx, row, cols, system, rhs);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_GENERATE_GENERAL_INVERSE_KERNEL);
+
+
 }  // namespace isai
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,308 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/idr_kernels.hpp"
+
+
+#include <random>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The IDR solver namespace.
+ *
+ * @ingroup idr
+ */
+namespace idr {
+namespace {
+
+
+template <typename ValueType, typename Distribution, typename Generator>
+typename std::enable_if<!is_complex_s<ValueType>::value, ValueType>::type
+get_rand_value(Distribution &dist, Generator &gen)
+{
+    return dist(gen);
+}
+
+
+template <typename ValueType, typename Distribution, typename Generator>
+typename std::enable_if<is_complex_s<ValueType>::value, ValueType>::type
+get_rand_value(Distribution &dist, Generator &gen)
+{
+    return ValueType(dist(gen), dist(gen));
+}
+
+
+template <typename ValueType>
+void orthonormalize_subspace_vectors(matrix::Dense<ValueType> *mat)
+{
+    for (size_type i = 0; i < mat->get_size()[0]; ++i) {
+        for (size_type j = 0; j < i; ++j) {
+            auto dot = zero<ValueType>();
+            for (size_type col = 0; col < mat->get_size()[1]; ++col) {
+                dot += conj(mat->at(j, col)) * mat->at(i, col);
+            }
+            for (size_type col = 0; col < mat->get_size()[1]; ++col) {
+                mat->at(i, col) -= dot * mat->at(j, col);
+            }
+        }
+        remove_complex<ValueType> norm{};
+        for (size_type col = 0; col < mat->get_size()[1]; ++col) {
+            norm += squared_norm(mat->at(i, col));
+        }
+        norm = sqrt(norm);
+        for (size_type col = 0; col < mat->get_size()[1]; ++col) {
+            mat->at(i, col) /= norm;
+        }
+    }
+}
+
+
+template <typename ValueType>
+ValueType multi_dot_entry(const matrix::Dense<ValueType> *p,
+                          const matrix::Dense<ValueType> *g_k, size_type i,
+                          size_type rhs)
+{
+    auto dot = zero<ValueType>();
+    for (size_type ind = 0; ind < p->get_size()[1]; ++ind) {
+        dot += p->at(i, ind) * g_k->at(ind, rhs);
+    }
+    return dot;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const size_type nrhs, matrix::Dense<ValueType> *m,
+                matrix::Dense<ValueType> *subspace_vectors, bool deterministic,
+                Array<stopping_status> *stop_status)
+{
+    for (size_type i = 0; i < nrhs; ++i) {
+        stop_status->get_data()[i].reset();
+    }
+
+    // Initialize M
+    for (size_type row = 0; row < m->get_size()[0]; ++row) {
+        for (size_type col = 0; col < m->get_size()[1]; ++col) {
+            m->at(row, col) =
+                (row == col / nrhs) ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+
+    // Initialize and orthonormalize the shadow space
+    auto dist = std::normal_distribution<remove_complex<ValueType>>(0.0, 1.0);
+    auto seed = deterministic ? 15 : std::random_device{}();
+    auto gen = std::ranlux48(seed);
+    for (size_type row = 0; row < subspace_vectors->get_size()[0]; ++row) {
+        for (size_type col = 0; col < subspace_vectors->get_size()[1]; ++col) {
+            subspace_vectors->at(row, col) =
+                get_rand_value<ValueType>(dist, gen);
+        }
+    }
+    orthonormalize_subspace_vectors(subspace_vectors);
+
+    // store P^H, so P^H * residual is a plain matrix product
+    for (size_type row = 0; row < subspace_vectors->get_size()[0]; ++row) {
+        for (size_type col = 0; col < subspace_vectors->get_size()[1]; ++col) {
+            subspace_vectors->at(row, col) =
+                conj(subspace_vectors->at(row, col));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            const size_type nrhs, const size_type k,
+            const matrix::Dense<ValueType> *m,
+            const matrix::Dense<ValueType> *f,
+            const matrix::Dense<ValueType> *residual,
+            const matrix::Dense<ValueType> *g, matrix::Dense<ValueType> *c,
+            matrix::Dense<ValueType> *v,
+            const Array<stopping_status> *stop_status)
+{
+    for (size_type i = 0; i < nrhs; ++i) {
+        if (stop_status->get_const_data()[i].has_stopped()) {
+            continue;
+        }
+
+        // Compute c = M \ f by forward substitution
+        for (size_type row = k; row < m->get_size()[0]; ++row) {
+            auto temp = f->at(row, i);
+            for (size_type col = k; col < row; ++col) {
+                temp -= m->at(row, col * nrhs + i) * c->at(col, i);
+            }
+            c->at(row, i) = temp / m->at(row, row * nrhs + i);
+        }
+
+        // v = residual - G * c
+        for (size_type row = 0; row < v->get_size()[0]; ++row) {
+            auto temp = residual->at(row, i);
+            for (size_type j = k; j < m->get_size()[0]; ++j) {
+                temp -= c->at(j, i) * g->at(row, j * nrhs + i);
+            }
+            v->at(row, i) = temp;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            const size_type nrhs, const size_type k,
+            const matrix::Dense<ValueType> *omega,
+            const matrix::Dense<ValueType> *preconditioned_vector,
+            const matrix::Dense<ValueType> *c, matrix::Dense<ValueType> *u,
+            const Array<stopping_status> *stop_status)
+{
+    const auto subspace_dim = c->get_size()[0];
+    for (size_type i = 0; i < nrhs; ++i) {
+        if (stop_status->get_const_data()[i].has_stopped()) {
+            continue;
+        }
+        for (size_type row = 0; row < u->get_size()[0]; ++row) {
+            auto temp = omega->at(0, i) * preconditioned_vector->at(row, i);
+            for (size_type j = k; j < subspace_dim; ++j) {
+                temp += c->at(j, i) * u->at(row, j * nrhs + i);
+            }
+            u->at(row, k * nrhs + i) = temp;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_2_KERNEL);
+
+
+template <typename ValueType>
+void step_3(std::shared_ptr<const ReferenceExecutor> exec,
+            const size_type nrhs, const size_type k,
+            const matrix::Dense<ValueType> *p, matrix::Dense<ValueType> *g,
+            matrix::Dense<ValueType> *g_k, matrix::Dense<ValueType> *u,
+            matrix::Dense<ValueType> *m, matrix::Dense<ValueType> *f,
+            matrix::Dense<ValueType> *alpha,
+            matrix::Dense<ValueType> *residual, matrix::Dense<ValueType> *x,
+            const Array<stopping_status> *stop_status)
+{
+    const auto subspace_dim = p->get_size()[0];
+    const auto num_rows = g_k->get_size()[0];
+    for (size_type i = 0; i < nrhs; ++i) {
+        if (stop_status->get_const_data()[i].has_stopped()) {
+            continue;
+        }
+        for (size_type j = 0; j < k; ++j) {
+            // biorthogonalize g_k against p_j
+            alpha->at(0, i) =
+                multi_dot_entry(p, g_k, j, i) / m->at(j, j * nrhs + i);
+            for (size_type row = 0; row < num_rows; ++row) {
+                g_k->at(row, i) -= alpha->at(0, i) * g->at(row, j * nrhs + i);
+                u->at(row, k * nrhs + i) -=
+                    alpha->at(0, i) * u->at(row, j * nrhs + i);
+            }
+        }
+        for (size_type row = 0; row < num_rows; ++row) {
+            g->at(row, k * nrhs + i) = g_k->at(row, i);
+        }
+
+        // m(k:s, k) = P(:, k:s)^H * g_k, all in a single sweep over g_k
+        for (size_type j = k; j < subspace_dim; ++j) {
+            m->at(j, k * nrhs + i) = zero<ValueType>();
+        }
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto g_val = g_k->at(row, i);
+            for (size_type j = k; j < subspace_dim; ++j) {
+                m->at(j, k * nrhs + i) += p->at(j, row) * g_val;
+            }
+        }
+
+        // beta = f_k / M_k,k
+        const auto beta = f->at(k, i) / m->at(k, k * nrhs + i);
+        for (size_type row = 0; row < num_rows; ++row) {
+            residual->at(row, i) -= beta * g->at(row, k * nrhs + i);
+            x->at(row, i) += beta * u->at(row, k * nrhs + i);
+        }
+
+        // f(k+1:s) -= beta * m(k+1:s, k)
+        f->at(k, i) = zero<ValueType>();
+        for (size_type j = k + 1; j < subspace_dim; ++j) {
+            f->at(j, i) -= beta * m->at(j, k * nrhs + i);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_STEP_3_KERNEL);
+
+
+template <typename ValueType>
+void compute_omega(
+    std::shared_ptr<const ReferenceExecutor> exec, const size_type nrhs,
+    const remove_complex<ValueType> kappa, const matrix::Dense<ValueType> *tht,
+    const matrix::Dense<remove_complex<ValueType>> *residual_norm,
+    matrix::Dense<ValueType> *omega, const Array<stopping_status> *stop_status)
+{
+    for (size_type i = 0; i < nrhs; ++i) {
+        if (stop_status->get_const_data()[i].has_stopped() ||
+            tht->at(0, i) == zero<ValueType>()) {
+            // leaves the solution and the residual unchanged
+            omega->at(0, i) = zero<ValueType>();
+            continue;
+        }
+        const auto thr = omega->at(0, i);
+        const auto normt = sqrt(real(tht->at(0, i)));
+        omega->at(0, i) = thr / tht->at(0, i);
+        const auto absrho = abs(thr / (normt * residual_norm->at(0, i)));
+        if (absrho < kappa) {
+            omega->at(0, i) *= kappa / absrho;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_IDR_COMPUTE_OMEGA_KERNEL);
+
+
+}  // namespace idr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
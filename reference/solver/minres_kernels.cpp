@@ -0,0 +1,182 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/minres_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The MINRES solver namespace.
+ *
+ * @ingroup minres
+ */
+namespace minres {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType> *r,
+                const matrix::Dense<ValueType> *z,
+                matrix::Dense<ValueType> *r_prev, matrix::Dense<ValueType> *v,
+                matrix::Dense<ValueType> *w, matrix::Dense<ValueType> *w_prev,
+                matrix::Dense<ValueType> *beta,
+                matrix::Dense<ValueType> *prev_beta,
+                matrix::Dense<ValueType> *phibar,
+                matrix::Dense<ValueType> *dbar,
+                matrix::Dense<ValueType> *epsilon,
+                matrix::Dense<ValueType> *cs, matrix::Dense<ValueType> *sn,
+                matrix::Dense<remove_complex<ValueType>> *residual_norm,
+                Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < r->get_size()[1]; ++j) {
+        beta->at(j) = sqrt(real(beta->at(j)));
+        phibar->at(j) = beta->at(j);
+        residual_norm->at(j) = abs(phibar->at(j));
+        prev_beta->at(j) = zero<ValueType>();
+        dbar->at(j) = zero<ValueType>();
+        epsilon->at(j) = zero<ValueType>();
+        cs->at(j) = -one<ValueType>();
+        sn->at(j) = zero<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < r->get_size()[0]; ++i) {
+        for (size_type j = 0; j < r->get_size()[1]; ++j) {
+            r_prev->at(i, j) = r->at(i, j);
+            v->at(i, j) = beta->at(j) == zero<ValueType>()
+                              ? zero<ValueType>()
+                              : z->at(i, j) / beta->at(j);
+            w->at(i, j) = zero<ValueType>();
+            w_prev->at(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            const matrix::Dense<ValueType> *v, matrix::Dense<ValueType> *y,
+            matrix::Dense<ValueType> *r_prev, matrix::Dense<ValueType> *r,
+            matrix::Dense<ValueType> *alpha,
+            const matrix::Dense<ValueType> *beta,
+            const matrix::Dense<ValueType> *prev_beta,
+            const Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < y->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        const auto scale = prev_beta->at(j) == zero<ValueType>()
+                               ? zero<ValueType>()
+                               : beta->at(j) / prev_beta->at(j);
+        alpha->at(j) = zero<ValueType>();
+        for (size_type i = 0; i < y->get_size()[0]; ++i) {
+            y->at(i, j) -= scale * r_prev->at(i, j);
+            alpha->at(j) += conj(v->at(i, j)) * y->at(i, j);
+        }
+        const auto alpha_scale = alpha->at(j) / beta->at(j);
+        for (size_type i = 0; i < y->get_size()[0]; ++i) {
+            r_prev->at(i, j) = r->at(i, j);
+            r->at(i, j) = y->at(i, j) - alpha_scale * r->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType> *x, matrix::Dense<ValueType> *v,
+            const matrix::Dense<ValueType> *z, matrix::Dense<ValueType> *w,
+            matrix::Dense<ValueType> *w_prev,
+            const matrix::Dense<ValueType> *tau,
+            const matrix::Dense<ValueType> *alpha,
+            matrix::Dense<ValueType> *beta,
+            matrix::Dense<ValueType> *prev_beta,
+            matrix::Dense<ValueType> *phibar, matrix::Dense<ValueType> *dbar,
+            matrix::Dense<ValueType> *epsilon, matrix::Dense<ValueType> *cs,
+            matrix::Dense<ValueType> *sn,
+            matrix::Dense<remove_complex<ValueType>> *residual_norm,
+            const Array<stopping_status> *stop_status)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        prev_beta->at(j) = beta->at(j);
+        beta->at(j) = sqrt(real(tau->at(j)));
+        const auto prev_epsilon = epsilon->at(j);
+        const auto delta = cs->at(j) * dbar->at(j) + sn->at(j) * alpha->at(j);
+        const auto gbar = sn->at(j) * dbar->at(j) - cs->at(j) * alpha->at(j);
+        epsilon->at(j) = sn->at(j) * beta->at(j);
+        dbar->at(j) = -cs->at(j) * beta->at(j);
+        const auto gamma =
+            sqrt(squared_norm(gbar) + squared_norm(beta->at(j)));
+        if (gamma == zero<remove_complex<ValueType>>()) {
+            // breakdown, the solution cannot be improved any further
+            continue;
+        }
+        cs->at(j) = gbar / gamma;
+        sn->at(j) = beta->at(j) / gamma;
+        const auto phi = cs->at(j) * phibar->at(j);
+        phibar->at(j) *= sn->at(j);
+        residual_norm->at(j) = abs(phibar->at(j));
+        for (size_type i = 0; i < x->get_size()[0]; ++i) {
+            const auto new_w = (v->at(i, j) - prev_epsilon * w_prev->at(i, j) -
+                                delta * w->at(i, j)) /
+                               gamma;
+            w_prev->at(i, j) = w->at(i, j);
+            w->at(i, j) = new_w;
+            x->at(i, j) += phi * new_w;
+            v->at(i, j) = beta->at(j) == zero<ValueType>()
+                              ? zero<ValueType>()
+                              : z->at(i, j) / beta->at(j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MINRES_STEP_2_KERNEL);
+
+
+}  // namespace minres
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
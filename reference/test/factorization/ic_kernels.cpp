@@ -0,0 +1,207 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/ic.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/ilu.hpp>
+#include <ginkgo/core/solver/lower_trs.hpp>
+#include <ginkgo/core/solver/upper_trs.hpp>
+
+
+#include "core/factorization/ic_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Ic : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using ic_type = gko::factorization::Ic<value_type, index_type>;
+
+    Ic()
+        : ref(gko::ReferenceExecutor::create()),
+          tridiag(gko::initialize<Csr>({{4., -1., 0., 0.},
+                                        {-1., 4., -1., 0.},
+                                        {0., -1., 4., -1.},
+                                        {0., 0., -1., 4.}},
+                                       ref)),
+          spd(gko::initialize<Csr>({{4., 2., 0., 2.},
+                                    {2., 5., 1., 0.},
+                                    {0., 1., 6., 0.},
+                                    {2., 0., 0., 7.}},
+                                   ref)),
+          tol{r<value_type>::value}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<Csr> tridiag;
+    std::shared_ptr<Csr> spd;
+    gko::remove_complex<value_type> tol;
+};
+
+TYPED_TEST_CASE(Ic, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Ic, FactorizesTridiagonalMatrixExactly)
+{
+    using Csr = typename TestFixture::Csr;
+    auto fact = TestFixture::ic_type::build().on(this->ref)->generate(
+        this->tridiag);
+    auto product = Csr::create(this->ref, this->tridiag->get_size());
+
+    fact->get_l_factor()->apply(fact->get_lt_factor().get(), product.get());
+
+    GKO_ASSERT_MTX_NEAR(product, this->tridiag, this->tol);
+}
+
+
+TYPED_TEST(Ic, DropsFillIn)
+{
+    using Csr = typename TestFixture::Csr;
+    auto fact =
+        TestFixture::ic_type::build().on(this->ref)->generate(this->spd);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_l_factor(),
+                               gko::initialize<Csr>({{1., 0., 0., 0.},
+                                                     {1., 1., 0., 0.},
+                                                     {0., 1., 1., 0.},
+                                                     {1., 0., 0., 1.}},
+                                                    this->ref));
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(),
+                        l({{2., 0., 0., 0.},
+                           {1., 2., 0., 0.},
+                           {0., 0.5, std::sqrt(5.75), 0.},
+                           {1., 0., 0., std::sqrt(6.)}}),
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_lt_factor(),
+                        l({{2., 1., 0., 1.},
+                           {0., 2., 0.5, 0.},
+                           {0., 0., std::sqrt(5.75), 0.},
+                           {0., 0., 0., std::sqrt(6.)}}),
+                        this->tol);
+}
+
+
+TYPED_TEST(Ic, UsesLowerTriangleOnly)
+{
+    using Csr = typename TestFixture::Csr;
+    auto lower = gko::initialize<Csr>({{4., 0., 0., 0.},
+                                       {2., 5., 0., 0.},
+                                       {0., 1., 6., 0.},
+                                       {2., 0., 0., 7.}},
+                                      this->ref);
+    auto factory = TestFixture::ic_type::build().on(this->ref);
+
+    auto fact = factory->generate(this->spd);
+    auto fact_lower = factory->generate(gko::share(lower));
+
+    GKO_ASSERT_MTX_NEAR(fact_lower->get_l_factor(), fact->get_l_factor(), 0.);
+}
+
+
+TYPED_TEST(Ic, ReplacesBreakdownBySentinel)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {I<value_type>{4., 2.}, I<value_type>{2., 1.}}, this->ref));
+
+    auto fact = TestFixture::ic_type::build().on(this->ref)->generate(mtx);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), l({{2., 0.}, {1., 1.}}), 0.);
+}
+
+
+TYPED_TEST(Ic, KernelComputesFactorInPlace)
+{
+    using Csr = typename TestFixture::Csr;
+    auto factor = gko::initialize<Csr>({{4., 0., 0., 0.},
+                                        {2., 5., 0., 0.},
+                                        {0., 1., 6., 0.},
+                                        {2., 0., 0., 7.}},
+                                       this->ref);
+
+    gko::kernels::reference::ic_factorization::compute(this->ref,
+                                                       factor.get());
+
+    GKO_ASSERT_MTX_NEAR(factor,
+                        l({{2., 0., 0., 0.},
+                           {1., 2., 0., 0.},
+                           {0., 0.5, std::sqrt(5.75), 0.},
+                           {1., 0., 0., std::sqrt(6.)}}),
+                        this->tol);
+}
+
+
+TYPED_TEST(Ic, CanBeUsedInIluPreconditioner)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Dense = typename TestFixture::Dense;
+    using ilu_type = gko::preconditioner::Ilu<
+        gko::solver::LowerTrs<value_type, index_type>,
+        gko::solver::UpperTrs<value_type, index_type>, false, index_type>;
+    auto fact = gko::share(
+        TestFixture::ic_type::build().on(this->ref)->generate(this->tridiag));
+    auto precond = ilu_type::build().on(this->ref)->generate(fact);
+    auto b = gko::initialize<Dense>({1., 2., 3., 4.}, this->ref);
+    auto x = Dense::create(this->ref, gko::dim<2>{4, 1});
+    auto res = Dense::create(this->ref, gko::dim<2>{4, 1});
+
+    precond->apply(b.get(), x.get());
+
+    // IC(0) of a tridiagonal matrix is exact, so this is a direct solve
+    this->tridiag->apply(x.get(), res.get());
+    GKO_ASSERT_MTX_NEAR(res, b, this->tol * 10);
+}
+
+
+}  // namespace
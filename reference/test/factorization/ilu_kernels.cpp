@@ -0,0 +1,141 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/factorization/ilu.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Ilu : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using ilu_type = gko::factorization::Ilu<value_type, index_type>;
+
+    Ilu()
+        : ref(gko::ReferenceExecutor::create()),
+          mtx(gko::share(gko::initialize<Csr>({{4., 1., 0., 1.},
+                                               {2., 4., 1., 0.},
+                                               {0., 2., 4., 0.},
+                                               {1., 0., 0., 4.}},
+                                              ref))),
+          scaled_mtx(gko::share(gko::initialize<Csr>({{8., 2., 0., 2.},
+                                                      {4., 8., 2., 0.},
+                                                      {0., 4., 8., 0.},
+                                                      {2., 0., 0., 8.}},
+                                                     ref))),
+          // same number of nonzeros as mtx, but a different pattern
+          other_mtx(gko::share(gko::initialize<Csr>({{4., 1., 1., 0.},
+                                                     {2., 4., 1., 0.},
+                                                     {0., 2., 4., 0.},
+                                                     {1., 0., 0., 4.}},
+                                                    ref))),
+          // the ILU(0) factors of mtx, the fill-in at (3, 1) and (1, 3) is
+          // dropped
+          l_expected(gko::initialize<Csr>({{1., 0., 0., 0.},
+                                           {0.5, 1., 0., 0.},
+                                           {0., 4. / 7., 1., 0.},
+                                           {0.25, 0., 0., 1.}},
+                                          ref)),
+          u_expected(gko::initialize<Csr>({{4., 1., 0., 1.},
+                                           {0., 3.5, 1., 0.},
+                                           {0., 0., 24. / 7., 0.},
+                                           {0., 0., 0., 3.75}},
+                                          ref)),
+          factory(ilu_type::build().on(ref)),
+          tol{r<value_type>::value}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<Csr> mtx;
+    std::shared_ptr<Csr> scaled_mtx;
+    std::shared_ptr<Csr> other_mtx;
+    std::shared_ptr<Csr> l_expected;
+    std::shared_ptr<Csr> u_expected;
+    std::unique_ptr<typename ilu_type::Factory> factory;
+    gko::remove_complex<value_type> tol;
+};
+
+TYPED_TEST_CASE(Ilu, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Ilu, ComputesFactors)
+{
+    auto factors = this->factory->generate(this->mtx);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), this->l_expected, this->tol);
+    GKO_ASSERT_MTX_NEAR(factors->get_u_factor(), this->u_expected, this->tol);
+}
+
+
+TYPED_TEST(Ilu, UpdatesValues)
+{
+    auto factors = this->factory->generate(this->scaled_mtx);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    factors->update_values(this->mtx);
+
+    ASSERT_EQ(factors->get_l_factor(), l_factor);
+    ASSERT_EQ(factors->get_u_factor(), u_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, this->l_expected, this->tol);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->u_expected, this->tol);
+}
+
+
+TYPED_TEST(Ilu, UpdateValuesThrowsForDifferentPattern)
+{
+    auto factors = this->factory->generate(this->mtx);
+
+    ASSERT_THROW(factors->update_values(this->other_mtx), gko::ValueMismatch);
+}
+
+
+}  // namespace
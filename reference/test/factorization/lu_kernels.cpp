@@ -0,0 +1,289 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/factorization/lu.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/cholesky.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/factorization/lu_kernels.hpp"
+#include "core/factorization/symbolic.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Lu : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using forest_type = gko::factorization::elimination_forest<index_type>;
+    using index_array = gko::Array<index_type>;
+
+    Lu()
+        : ref(gko::ReferenceExecutor::create()),
+          tridiag(gko::initialize<Csr>({{4., -1., 0., 0.},
+                                        {-2., 4., -1., 0.},
+                                        {0., -2., 4., -1.},
+                                        {0., 0., -2., 4.}},
+                                       ref)),
+          arrow_last(gko::initialize<Csr>({{4., 0., 0., 1.},
+                                           {0., 4., 0., 1.},
+                                           {0., 0., 4., 1.},
+                                           {2., 2., 2., 4.}},
+                                          ref)),
+          arrow_first(gko::initialize<Csr>({{4., 1., 1., 1.},
+                                            {2., 4., 0., 0.},
+                                            {2., 0., 4., 0.},
+                                            {2., 0., 0., 4.}},
+                                           ref)),
+          arrow_first_pattern(gko::initialize<Csr>({{1., 1., 1., 1.},
+                                                    {1., 1., 1., 1.},
+                                                    {1., 1., 1., 1.},
+                                                    {1., 1., 1., 1.}},
+                                                   ref)),
+          spd(gko::initialize<Csr>({{4., 2., 0., 2.},
+                                    {2., 5., 1., 0.},
+                                    {0., 1., 6., 0.},
+                                    {2., 0., 0., 7.}},
+                                   ref)),
+          tol{r<value_type>::value}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<Csr> tridiag;
+    std::shared_ptr<Csr> arrow_last;
+    std::shared_ptr<Csr> arrow_first;
+    std::shared_ptr<Csr> arrow_first_pattern;
+    std::shared_ptr<Csr> spd;
+    gko::remove_complex<value_type> tol;
+};
+
+TYPED_TEST_CASE(Lu, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Lu, SymbolicComputesTridiagonalForest)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using index_array = typename TestFixture::index_array;
+    forest_type forest{this->ref, 4};
+
+    auto factors = gko::factorization::symbolic_lu(this->tridiag.get(), forest);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(factors, this->tridiag);
+    GKO_ASSERT_ARRAY_EQ(forest.parents, index_array(this->ref, {1, 2, 3, 4}));
+    // the last two nodes form a chain
+    GKO_ASSERT_ARRAY_EQ(forest.chain_ptrs,
+                        index_array(this->ref, {0, 1, 2, 4}));
+    GKO_ASSERT_ARRAY_EQ(forest.level_ptrs,
+                        index_array(this->ref, {0, 1, 2, 3}));
+    GKO_ASSERT_ARRAY_EQ(forest.level_nodes, index_array(this->ref, {0, 1, 2}));
+}
+
+
+TYPED_TEST(Lu, SymbolicComputesArrowForestWithoutFill)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using index_array = typename TestFixture::index_array;
+    forest_type forest{this->ref, 4};
+
+    auto factors =
+        gko::factorization::symbolic_lu(this->arrow_last.get(), forest);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(factors, this->arrow_last);
+    GKO_ASSERT_ARRAY_EQ(forest.parents, index_array(this->ref, {3, 3, 3, 4}));
+    GKO_ASSERT_ARRAY_EQ(forest.chain_ptrs,
+                        index_array(this->ref, {0, 1, 2, 3, 4}));
+    GKO_ASSERT_ARRAY_EQ(forest.level_ptrs, index_array(this->ref, {0, 3, 4}));
+    GKO_ASSERT_ARRAY_EQ(forest.level_nodes,
+                        index_array(this->ref, {0, 1, 2, 3}));
+}
+
+
+TYPED_TEST(Lu, SymbolicComputesFill)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using index_array = typename TestFixture::index_array;
+    forest_type forest{this->ref, 4};
+
+    auto factors =
+        gko::factorization::symbolic_lu(this->arrow_first.get(), forest);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(factors, this->arrow_first_pattern);
+    GKO_ASSERT_ARRAY_EQ(forest.parents, index_array(this->ref, {1, 2, 3, 4}));
+    // all nodes form a single chain
+    GKO_ASSERT_ARRAY_EQ(forest.chain_ptrs, index_array(this->ref, {0, 4}));
+    GKO_ASSERT_ARRAY_EQ(forest.level_ptrs, index_array(this->ref, {0, 1}));
+}
+
+
+TYPED_TEST(Lu, SymbolicCholeskyComputesLowerFill)
+{
+    using Csr = typename TestFixture::Csr;
+    using forest_type = typename TestFixture::forest_type;
+    using index_array = typename TestFixture::index_array;
+    forest_type forest{this->ref, 4};
+    auto expected = gko::initialize<Csr>({{1., 0., 0., 0.},
+                                          {1., 1., 0., 0.},
+                                          {0., 1., 1., 0.},
+                                          {1., 1., 1., 1.}},
+                                         this->ref);
+
+    auto factor =
+        gko::factorization::symbolic_cholesky(this->spd.get(), forest);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(factor, expected);
+}
+
+
+TYPED_TEST(Lu, KernelInitializeScattersValues)
+{
+    using forest_type = typename TestFixture::forest_type;
+    using value_type = typename TestFixture::value_type;
+    forest_type forest{this->ref, 4};
+    auto factors =
+        gko::factorization::symbolic_lu(this->arrow_first.get(), forest);
+    // overwrite a fill-in entry, it needs to be reset
+    factors->get_values()[6] = value_type{7.};
+
+    gko::kernels::reference::lu_factorization::initialize(
+        this->ref, this->arrow_first.get(), factors.get());
+
+    GKO_ASSERT_MTX_NEAR(factors, this->arrow_first, 0.);
+}
+
+
+TYPED_TEST(Lu, FactorizesArrowMatrixWithFill)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto fact = gko::factorization::Lu<value_type, typename TestFixture::
+                                                       index_type>::build()
+                    .on(this->ref)
+                    ->generate(this->arrow_first);
+    auto product = Csr::create(this->ref, this->arrow_first->get_size());
+
+    fact->get_l_factor()->apply(fact->get_u_factor().get(), product.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_l_factor(),
+                               gko::initialize<Csr>({{1., 0., 0., 0.},
+                                                     {1., 1., 0., 0.},
+                                                     {1., 1., 1., 0.},
+                                                     {1., 1., 1., 1.}},
+                                                    this->ref));
+    GKO_ASSERT_MTX_NEAR(product, this->arrow_first, this->tol);
+}
+
+
+TYPED_TEST(Lu, FactorizesTridiagonalMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto fact = gko::factorization::Lu<value_type, typename TestFixture::
+                                                       index_type>::build()
+                    .on(this->ref)
+                    ->generate(this->tridiag);
+    auto product = Csr::create(this->ref, this->tridiag->get_size());
+
+    fact->get_l_factor()->apply(fact->get_u_factor().get(), product.get());
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(),
+                        l({{1., 0., 0., 0.},
+                           {-0.5, 1., 0., 0.},
+                           {0., -4. / 7., 1., 0.},
+                           {0., 0., -7. / 12., 1.}}),
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(product, this->tridiag, this->tol);
+}
+
+
+TYPED_TEST(Lu, ThrowsOnMatrixRequiringPivoting)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto factory = gko::factorization::Lu<
+                       value_type, typename TestFixture::index_type>::build()
+                       .on(this->ref);
+    std::shared_ptr<Csr> mtx = gko::initialize<Csr>(
+        {{0., 1., 0.}, {1., 0., 0.}, {0., 0., 1.}}, this->ref);
+
+    ASSERT_THROW(factory->generate(mtx), gko::NumericalBreakdown);
+}
+
+
+TYPED_TEST(Lu, CholeskyFactorizesSpdMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto fact = gko::factorization::Cholesky<
+                    value_type, typename TestFixture::index_type>::build()
+                    .on(this->ref)
+                    ->generate(this->spd);
+    auto product = Csr::create(this->ref, this->spd->get_size());
+
+    fact->get_l_factor()->apply(fact->get_lt_factor().get(), product.get());
+
+    GKO_ASSERT_MTX_NEAR(product, this->spd, this->tol);
+}
+
+
+TYPED_TEST(Lu, CholeskyThrowsOnIndefiniteMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto factory = gko::factorization::Cholesky<
+                       value_type, typename TestFixture::index_type>::build()
+                       .on(this->ref);
+    std::shared_ptr<Csr> mtx = gko::initialize<Csr>(
+        {{1., 2., 0.}, {2., 1., 0.}, {0., 0., 1.}}, this->ref);
+
+    ASSERT_THROW(factory->generate(mtx), gko::NumericalBreakdown);
+}
+
+
+}  // namespace
@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 
@@ -387,4 +388,44 @@ TYPED_TEST(ParIct, GenerateWithApproxLargeLimit)
 }
 
 
+TYPED_TEST(ParIct, UpdatesValuesWithExactSmallLimit)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Dense = typename TestFixture::Dense;
+    auto fact = factorization_type::build()
+                    .with_approximate_select(false)
+                    .with_fill_in_limit(0.6)
+                    .on(this->exec)
+                    ->generate(this->mtx_system);
+    auto scaled_system = gko::share(Dense::create(this->exec));
+    this->mtx_system->convert_to(scaled_system.get());
+    scaled_system->scale(gko::initialize<Dense>({4.0}, this->exec).get());
+    auto l_expect = Dense::create(this->exec);
+    this->mtx_l_small_expect->convert_to(l_expect.get());
+    l_expect->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+
+    fact->update_values(scaled_system);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), l_expect, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_lt_factor(),
+                        gko::as<Dense>(l_expect->transpose()), this->tol);
+}
+
+
+TYPED_TEST(ParIct, SavesAndLoadsFactors)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact = this->fact_fact->generate(this->mtx_system);
+    std::stringstream stream;
+    fact->save(stream, this->mtx_system.get());
+
+    auto loaded = factorization_type::load(stream, this->fact_fact.get(),
+                                           this->mtx_system.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_l_factor(), fact->get_l_factor());
+    GKO_ASSERT_MTX_NEAR(loaded->get_l_factor(), fact->get_l_factor(), 0.0);
+    GKO_ASSERT_MTX_NEAR(loaded->get_lt_factor(), fact->get_lt_factor(), 0.0);
+}
+
+
 }  // namespace
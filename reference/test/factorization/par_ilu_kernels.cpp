@@ -34,8 +34,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 
@@ -754,4 +758,121 @@ TYPED_TEST(ParIlu, GenerateForReverseCsrSmall)
 }
 
 
+TYPED_TEST(ParIlu, UpdatesValuesForDenseSmall)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_small));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+    auto factors = this->ilu_factory_skip->generate(scaled_mtx);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    factors->update_values(this->mtx_small);
+
+    ASSERT_EQ(factors->get_l_factor(), l_factor);
+    ASSERT_EQ(factors->get_u_factor(), u_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, this->small_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->small_u_expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(ParIlu, UpdateValuesThrowsForDifferentPattern)
+{
+    auto factors = this->ilu_factory_sort->generate(this->mtx_small);
+
+    ASSERT_THROW(factors->update_values(this->mtx_small2), gko::ValueMismatch);
+}
+
+
+TYPED_TEST(ParIlu, UpdateValuesThrowsForDifferentPatternWithSameNnz)
+{
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {{4., 1., 0.}, {1., 4., 0.}, {0., 0., 4.}}, this->exec));
+    auto other_mtx = gko::share(gko::initialize<Csr>(
+        {{4., 0., 1.}, {0., 4., 0.}, {1., 0., 4.}}, this->exec));
+    auto factors = this->ilu_factory_sort->generate(mtx);
+
+    ASSERT_THROW(factors->update_values(other_mtx), gko::ValueMismatch);
+}
+
+
+TYPED_TEST(ParIlu, SavesAndLoadsFactors)
+{
+    using par_ilu_type = typename TestFixture::par_ilu_type;
+    auto factors = this->ilu_factory_skip->generate(this->mtx_small);
+    std::stringstream stream;
+    factors->save(stream, this->mtx_small.get());
+
+    auto loaded = par_ilu_type::load(stream, this->ilu_factory_skip.get(),
+                                     this->mtx_small.get());
+
+    ASSERT_EQ(loaded->get_size(), factors->get_size());
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_l_factor(), factors->get_l_factor());
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_u_factor(), factors->get_u_factor());
+    GKO_ASSERT_MTX_NEAR(loaded->get_l_factor(), factors->get_l_factor(), 0.0);
+    GKO_ASSERT_MTX_NEAR(loaded->get_u_factor(), factors->get_u_factor(), 0.0);
+}
+
+
+TYPED_TEST(ParIlu, UpdatesValuesOfLoadedFactors)
+{
+    using Dense = typename TestFixture::Dense;
+    using par_ilu_type = typename TestFixture::par_ilu_type;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_small));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+    auto factors = this->ilu_factory_skip->generate(scaled_mtx);
+    std::stringstream stream;
+    factors->save(stream, scaled_mtx.get());
+    auto loaded = par_ilu_type::load(stream, this->ilu_factory_skip.get(),
+                                     scaled_mtx.get());
+
+    loaded->update_values(this->mtx_small);
+
+    GKO_ASSERT_MTX_NEAR(loaded->get_l_factor(), this->small_l_expected,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(loaded->get_u_factor(), this->small_u_expected,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(ParIlu, LoadThrowsForDifferentMatrix)
+{
+    using par_ilu_type = typename TestFixture::par_ilu_type;
+    auto factors = this->ilu_factory_sort->generate(this->mtx_small);
+    std::stringstream stream;
+    factors->save(stream, this->mtx_small.get());
+
+    ASSERT_THROW(par_ilu_type::load(stream, this->ilu_factory_sort.get(),
+                                    this->mtx_small2.get()),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(ParIlu, LoadThrowsForCorruptedColumnIndex)
+{
+    using par_ilu_type = typename TestFixture::par_ilu_type;
+    using index_type = typename TestFixture::index_type;
+    auto factors = this->ilu_factory_skip->generate(this->mtx_small);
+    std::stringstream stream;
+    factors->save(stream, this->mtx_small.get());
+    auto data = stream.str();
+    // skip the header, the dimensions, the row pointers of L and the number
+    // of its column indexes
+    const auto num_rows = this->mtx_small->get_size()[0];
+    const auto offset = 56 + 3 * sizeof(std::uint64_t) +
+                        (num_rows + 1) * sizeof(index_type) +
+                        sizeof(std::uint64_t);
+    const index_type col = 1000000;
+    std::memcpy(&data[offset], &col, sizeof(col));
+    std::stringstream corrupted{data};
+
+    ASSERT_THROW(par_ilu_type::load(corrupted, this->ilu_factory_skip.get(),
+                                    this->mtx_small.get()),
+                 gko::StreamError);
+}
+
+
 }  // namespace
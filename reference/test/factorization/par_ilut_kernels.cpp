@@ -34,7 +34,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 
@@ -672,4 +676,79 @@ TYPED_TEST(ParIlut, GenerateWithApproxLargeLimit)
 }
 
 
+TYPED_TEST(ParIlut, UpdatesValuesWithExactSmallLimit)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Dense = typename TestFixture::Dense;
+    auto fact = factorization_type::build()
+                    .with_approximate_select(false)
+                    .with_fill_in_limit(0.75)
+                    .on(this->exec)
+                    ->generate(this->mtx_system);
+    auto scaled_system = gko::share(Dense::create(this->exec));
+    this->mtx_system->convert_to(scaled_system.get());
+    scaled_system->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+    auto u_expect = Dense::create(this->exec);
+    this->mtx_u_small_expect->convert_to(u_expect.get());
+    u_expect->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+
+    fact->update_values(scaled_system);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->mtx_l_small_expect,
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), u_expect, this->tol);
+}
+
+
+TYPED_TEST(ParIlut, SavesAndLoadsFactors)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact = this->fact_fact->generate(this->mtx_system);
+    std::stringstream stream;
+    fact->save(stream, this->mtx_system.get());
+
+    auto loaded = factorization_type::load(stream, this->fact_fact.get(),
+                                           this->mtx_system.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_l_factor(), fact->get_l_factor());
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_u_factor(), fact->get_u_factor());
+    GKO_ASSERT_MTX_NEAR(loaded->get_l_factor(), fact->get_l_factor(), 0.0);
+    GKO_ASSERT_MTX_NEAR(loaded->get_u_factor(), fact->get_u_factor(), 0.0);
+}
+
+
+TYPED_TEST(ParIlut, LoadThrowsForTruncatedData)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    std::stringstream stream;
+    this->fact_fact->generate(this->mtx_system)
+        ->save(stream, this->mtx_system.get());
+    auto data = stream.str();
+    std::stringstream truncated{data.substr(0, data.size() - 1)};
+
+    ASSERT_THROW(factorization_type::load(truncated, this->fact_fact.get(),
+                                          this->mtx_system.get()),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(ParIlut, LoadThrowsForCorruptedSize)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    std::stringstream stream;
+    this->fact_fact->generate(this->mtx_system)
+        ->save(stream, this->mtx_system.get());
+    auto data = stream.str();
+    // the element count of the row pointers of L follows the 56 byte header
+    // and the dimensions of L
+    const auto count = std::numeric_limits<std::uint64_t>::max() / 2;
+    std::memcpy(&data[72], &count, sizeof(count));
+    std::stringstream corrupted{data};
+
+    ASSERT_THROW(factorization_type::load(corrupted, this->fact_fact.get(),
+                                          this->mtx_system.get()),
+                 gko::StreamError);
+}
+
+
 }  // namespace
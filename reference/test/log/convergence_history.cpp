@@ -0,0 +1,227 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/log/convergence_history.hpp>
+
+
+#include <limits>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class ConvergenceHistory : public ::testing::Test {
+protected:
+    using value_type = T;
+    using absolute_type = gko::remove_complex<T>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using NormVector = gko::matrix::Dense<absolute_type>;
+    using Logger = gko::log::ConvergenceHistory<value_type>;
+
+    ConvergenceHistory() : exec(gko::ReferenceExecutor::create()) {}
+
+    void log_norm(const Logger *logger, gko::size_type iteration,
+                  absolute_type norm)
+    {
+        auto norm_vector = NormVector::create(exec, gko::dim<2>{1, 1});
+        norm_vector->at(0, 0) = norm;
+        logger->template on<gko::log::Logger::iteration_complete>(
+            nullptr, iteration, nullptr, nullptr, norm_vector.get());
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+};
+
+TYPED_TEST_CASE(ConvergenceHistory, gko::test::ValueTypes);
+
+
+TYPED_TEST(ConvergenceHistory, ComputesResidualNormFromResidual)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto logger = TestFixture::Logger::create(this->exec);
+    auto residual = gko::initialize<Mtx>(
+        {I<T>{1.0, 0.0}, I<T>{2.0, 3.0}, I<T>{2.0, 4.0}}, this->exec);
+
+    logger->template on<gko::log::Logger::iteration_complete>(
+        nullptr, 0, residual.get());
+
+    // the largest norm of all columns is recorded
+    ASSERT_EQ(logger->get_num_iterations(), 0);
+    ASSERT_NEAR(logger->get_residual_norm(), 5.0, r<TypeParam>::value);
+    ASSERT_NEAR(logger->get_initial_residual_norm(), 5.0,
+                r<TypeParam>::value);
+}
+
+
+TYPED_TEST(ConvergenceHistory, ProjectsRemainingIterations)
+{
+    auto logger = TestFixture::Logger::create(this->exec, 5e-5);
+
+    this->log_norm(logger.get(), 0, 3.0);
+    this->log_norm(logger.get(), 1, 0.3);
+    this->log_norm(logger.get(), 2, 0.03);
+
+    auto history = logger->get_history();
+    ASSERT_EQ(history.size(), 3);
+    ASSERT_EQ(history[2].iteration, 2);
+    ASSERT_NEAR(history[2].residual_norm, 0.03, r<TypeParam>::value);
+    ASSERT_LE(history[0].time, history[2].time);
+    ASSERT_NEAR(logger->get_convergence_rate(), 0.1, r<TypeParam>::value);
+    // 0.03 needs to be reduced to 1.5e-4, i.e. by 10^2.3
+    ASSERT_EQ(logger->get_projected_iterations(), 3);
+    ASSERT_LT(logger->get_projected_time(),
+              std::chrono::nanoseconds::max());
+}
+
+
+TYPED_TEST(ConvergenceHistory, SmoothesConvergenceRate)
+{
+    auto logger = TestFixture::Logger::create(this->exec, 1e-8, 16, 0.5);
+
+    this->log_norm(logger.get(), 0, 1.0);
+    this->log_norm(logger.get(), 1, 1e-1);
+    this->log_norm(logger.get(), 2, 1e-4);
+
+    // average of the logarithms of 0.1 and 0.001
+    ASSERT_NEAR(logger->get_convergence_rate(), 1e-2,
+                r<TypeParam>::value * 1e-2);
+}
+
+
+TYPED_TEST(ConvergenceHistory, ReplacesIntermediateResidualOfSameIteration)
+{
+    auto logger = TestFixture::Logger::create(this->exec);
+
+    this->log_norm(logger.get(), 0, 1.0);
+    this->log_norm(logger.get(), 1, 0.5);
+    this->log_norm(logger.get(), 1, 0.25);
+
+    auto history = logger->get_history();
+    ASSERT_EQ(history.size(), 2);
+    ASSERT_NEAR(history[1].residual_norm, 0.25, r<TypeParam>::value);
+}
+
+
+TYPED_TEST(ConvergenceHistory, StartsNewSolveAtIterationZero)
+{
+    auto logger = TestFixture::Logger::create(this->exec);
+    this->log_norm(logger.get(), 0, 1.0);
+    this->log_norm(logger.get(), 1, 0.5);
+
+    this->log_norm(logger.get(), 0, 2.0);
+
+    ASSERT_EQ(logger->get_history().size(), 1);
+    ASSERT_EQ(logger->get_num_iterations(), 0);
+    ASSERT_EQ(logger->get_initial_residual_norm(), 2.0);
+    ASSERT_EQ(logger->get_convergence_rate(), 1.0);
+}
+
+
+TYPED_TEST(ConvergenceHistory, KeepsBoundedHistory)
+{
+    auto logger = TestFixture::Logger::create(this->exec, 1e-8, 2);
+
+    for (int i = 0; i < 4; ++i) {
+        this->log_norm(logger.get(), i, 1.0 / (i + 1));
+    }
+
+    auto history = logger->get_history();
+    ASSERT_EQ(history.size(), 2);
+    ASSERT_EQ(history[0].iteration, 2);
+    ASSERT_EQ(history[1].iteration, 3);
+    ASSERT_EQ(logger->get_initial_residual_norm(), 1.0);
+}
+
+
+TYPED_TEST(ConvergenceHistory, DoesNotProjectDivergingSolve)
+{
+    auto logger = TestFixture::Logger::create(this->exec);
+
+    this->log_norm(logger.get(), 0, 1.0);
+    this->log_norm(logger.get(), 1, 2.0);
+
+    ASSERT_EQ(logger->get_projected_iterations(),
+              std::numeric_limits<gko::size_type>::max());
+    ASSERT_EQ(logger->get_projected_time(), std::chrono::nanoseconds::max());
+}
+
+
+TYPED_TEST(ConvergenceHistory, RecordsSolverIterations)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto exec = this->exec;
+    auto logger = gko::share(
+        TestFixture::Logger::create(exec, r<value_type>::value));
+    auto mtx = gko::share(gko::initialize<Mtx>(
+        {{2.0, -1.0, 0.0}, {-1.0, 2.0, -1.0}, {0.0, -1.0, 2.0}}, exec));
+    auto solver =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(10u).on(exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(exec))
+            .on(exec)
+            ->generate(mtx);
+    auto b = gko::initialize<Mtx>({1.0, 2.0, 3.0}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, exec);
+    solver->add_logger(logger);
+
+    solver->apply(b.get(), x.get());
+
+    auto history = logger->get_history();
+    ASSERT_GT(history.size(), 1);
+    ASSERT_EQ(history.back().iteration, history.size() - 1);
+    ASSERT_LT(history.back().residual_norm, history.front().residual_norm);
+    ASSERT_EQ(logger->get_projected_iterations(), 0);
+    ASSERT_EQ(logger->get_projected_time(), std::chrono::nanoseconds{0});
+}
+
+
+}  // namespace
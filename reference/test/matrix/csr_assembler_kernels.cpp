@@ -0,0 +1,333 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/matrix/csr_assembler_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class CsrAssembler : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Assembler = gko::matrix::CsrAssembler<value_type, index_type>;
+    using index_array = gko::Array<index_type>;
+    using value_array = gko::Array<value_type>;
+
+    CsrAssembler()
+        : ref(gko::ReferenceExecutor::create()),
+          rows{ref, {2, 0, 1, 0, 2, 2}},
+          cols{ref, {3, 2, 1, 0, 0, 1}},
+          values{ref, {6.0, 2.0, 0.0, 1.0, 4.0, 5.0}},
+          expected(gko::initialize<Csr>({{1.0, 0.0, 2.0, 0.0},
+                                         {0.0, 0.0, 0.0, 0.0},
+                                         {4.0, 5.0, 0.0, 6.0}},
+                                        ref))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    index_array rows;
+    index_array cols;
+    value_array values;
+    std::unique_ptr<Csr> expected;
+};
+
+TYPED_TEST_CASE(CsrAssembler, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(CsrAssembler, KernelCountsNonzerosPerRow)
+{
+    using index_array = typename TestFixture::index_array;
+    index_array row_nnz{this->ref, {0, 0, 0, 1}};
+
+    gko::kernels::reference::csr_assembler::count_nonzeros_per_row(
+        this->ref, this->rows, this->values, row_nnz.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(row_nnz, index_array(this->ref, {2, 0, 3, 1}));
+}
+
+
+TYPED_TEST(CsrAssembler, KernelFillsInEntries)
+{
+    using index_array = typename TestFixture::index_array;
+    using value_array = typename TestFixture::value_array;
+    using value_type = typename TestFixture::value_type;
+    index_array cursors{this->ref, {0, 2, 2, 5}};
+    index_array col_idxs{this->ref, 5};
+    value_array csr_values{this->ref, 5};
+    gko::Array<gko::int64> entry_idxs{this->ref, 5};
+
+    gko::kernels::reference::csr_assembler::fill_in(
+        this->ref, this->rows, this->cols, this->values, 10,
+        cursors.get_data(), col_idxs.get_data(), csr_values.get_data(),
+        entry_idxs.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(cursors, index_array(this->ref, {2, 2, 5, 5}));
+    GKO_ASSERT_ARRAY_EQ(col_idxs, index_array(this->ref, {2, 0, 3, 0, 1}));
+    GKO_ASSERT_ARRAY_EQ(csr_values,
+                        value_array(this->ref, I<value_type>{
+                                                   2.0, 1.0, 6.0, 4.0, 5.0}));
+    GKO_ASSERT_ARRAY_EQ(entry_idxs, gko::Array<gko::int64>(
+                                        this->ref, {11, 13, 10, 14, 15}));
+}
+
+
+TYPED_TEST(CsrAssembler, KernelSortsByColumnAndEntry)
+{
+    using Csr = typename TestFixture::Csr;
+    using index_array = typename TestFixture::index_array;
+    using value_array = typename TestFixture::value_array;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = Csr::create(this->ref, gko::dim<2>{2, 3},
+                           value_array{this->ref, I<value_type>{
+                                                      1.0, 2.0, 3.0, 4.0,
+                                                      5.0}},
+                           index_array{this->ref, {2, 0, 2, 1, 1}},
+                           index_array{this->ref, {0, 3, 5}});
+    const gko::Array<gko::int64> entry_idxs{this->ref, {4, 3, 1, 2, 0}};
+
+    gko::kernels::reference::csr_assembler::sort_by_column_and_entry(
+        this->ref, mtx.get(), entry_idxs.get_const_data());
+
+    GKO_ASSERT_ARRAY_EQ(
+        index_array::view(this->ref, 5, mtx->get_col_idxs()),
+        index_array(this->ref, {0, 2, 2, 1, 1}));
+    GKO_ASSERT_ARRAY_EQ(
+        value_array::view(this->ref, 5, mtx->get_values()),
+        value_array(this->ref, I<value_type>{2.0, 3.0, 1.0, 5.0, 4.0}));
+}
+
+
+TYPED_TEST(CsrAssembler, AssemblesSingleChunk)
+{
+    using Assembler = typename TestFixture::Assembler;
+    Assembler assembler{this->ref, gko::dim<2>{3, 4}};
+
+    assembler.insert(this->rows, this->cols, this->values);
+    auto result = assembler.finalize();
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>(3, 4));
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->expected);
+    GKO_ASSERT_MTX_NEAR(result, this->expected, 0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, AssemblesMultipleChunksFromPointers)
+{
+    using Assembler = typename TestFixture::Assembler;
+    Assembler assembler{this->ref, gko::dim<2>{3, 4}};
+    auto rows = this->rows.get_const_data();
+    auto cols = this->cols.get_const_data();
+    auto values = this->values.get_const_data();
+
+    assembler.insert(4, rows + 2, cols + 2, values + 2);
+    assembler.insert(2, rows, cols, values);
+    auto result = assembler.finalize();
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->expected);
+    GKO_ASSERT_MTX_NEAR(result, this->expected, 0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, AssemblesChunksFromMultipleThreads)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    using Csr = typename TestFixture::Csr;
+    const index_type size = 100;
+    Assembler assembler{this->ref, gko::dim<2>(size, size)};
+    std::vector<std::thread> threads;
+
+    // each thread inserts a different diagonal
+    for (index_type offset = 0; offset < 4; ++offset) {
+        threads.emplace_back([&, offset] {
+            std::vector<index_type> rows;
+            std::vector<index_type> cols;
+            std::vector<value_type> values;
+            for (index_type row = 0; row + offset < size; ++row) {
+                rows.push_back(row);
+                cols.push_back(row + offset);
+                values.push_back(static_cast<value_type>(offset + 1));
+            }
+            assembler.insert(rows.size(), rows.data(), cols.data(),
+                             values.data());
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(assembler.get_num_entries(), 4 * size - 6);
+    auto result = assembler.finalize();
+
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+    for (index_type row = 0; row < size; ++row) {
+        for (index_type offset = 0; offset < 4 && row + offset < size;
+             ++offset) {
+            data.nonzeros.emplace_back(row, row + offset,
+                                       static_cast<value_type>(offset + 1));
+        }
+    }
+    auto expected = Csr::create(this->ref);
+    expected->read(data);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, expected);
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, KeepsDuplicateEntries)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using index_array = typename TestFixture::index_array;
+    using value_array = typename TestFixture::value_array;
+    Assembler assembler{this->ref, gko::dim<2>{2, 2}};
+
+    assembler.insert(index_array{this->ref, {1, 1}},
+                     index_array{this->ref, {0, 0}},
+                     value_array{this->ref, {1.0, 1.0}});
+    auto result = assembler.finalize();
+
+    ASSERT_EQ(result->get_num_stored_elements(), 2);
+    GKO_ASSERT_ARRAY_EQ(
+        index_array::view(this->ref, 3, result->get_row_ptrs()),
+        index_array(this->ref, {0, 0, 2}));
+}
+
+
+TYPED_TEST(CsrAssembler, KernelSumsDuplicates)
+{
+    using Csr = typename TestFixture::Csr;
+    using index_array = typename TestFixture::index_array;
+    using value_array = typename TestFixture::value_array;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = Csr::create(this->ref, gko::dim<2>{3, 3},
+                           value_array{this->ref, I<value_type>{
+                                                      1.0, 2.0, 3.0, 1.0,
+                                                      -1.0, 4.0, 5.0}},
+                           index_array{this->ref, {0, 0, 2, 1, 1, 0, 2}},
+                           index_array{this->ref, {0, 3, 5, 7}});
+
+    gko::kernels::reference::csr_assembler::sum_duplicates(this->ref,
+                                                           mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(mtx,
+                        l({{3.0, 0.0, 3.0}, {0.0, 0.0, 0.0}, {4.0, 0.0, 5.0}}),
+                        0.0);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(CsrAssembler, AssemblesSummedDuplicates)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using index_array = typename TestFixture::index_array;
+    using value_array = typename TestFixture::value_array;
+    Assembler assembler{this->ref, gko::dim<2>{3, 4}, true};
+    assembler.insert(this->rows, this->cols, this->values);
+
+    // split one entry, add a cancelling pair and a new entry
+    assembler.insert(index_array{this->ref, {0, 1, 2, 1, 2}},
+                     index_array{this->ref, {2, 3, 3, 3, 2}},
+                     value_array{this->ref, {3.0, 1.0, -6.0, -1.0, 7.0}});
+    auto result = assembler.finalize();
+
+    GKO_ASSERT_MTX_NEAR(result,
+                        l({{1.0, 0.0, 5.0, 0.0},
+                           {0.0, 0.0, 0.0, 0.0},
+                           {4.0, 5.0, 7.0, 0.0}}),
+                        0.0);
+    ASSERT_EQ(result->get_num_stored_elements(), 5);
+}
+
+
+TYPED_TEST(CsrAssembler, FinalizeEmptiesAssembler)
+{
+    using Assembler = typename TestFixture::Assembler;
+    Assembler assembler{this->ref, gko::dim<2>{3, 4}};
+    assembler.insert(this->rows, this->cols, this->values);
+    assembler.finalize();
+
+    auto result = assembler.finalize();
+
+    ASSERT_EQ(assembler.get_num_entries(), 0);
+    ASSERT_EQ(result->get_size(), gko::dim<2>(3, 4));
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+}
+
+
+TYPED_TEST(CsrAssembler, ThrowsOnOutOfBoundsIndex)
+{
+    using Assembler = typename TestFixture::Assembler;
+    Assembler assembler{this->ref, gko::dim<2>{3, 3}};
+
+    ASSERT_THROW(assembler.insert(this->rows, this->cols, this->values),
+                 gko::OutOfBoundsError);
+}
+
+
+TYPED_TEST(CsrAssembler, ThrowsOnSizeMismatch)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using index_array = typename TestFixture::index_array;
+    Assembler assembler{this->ref, gko::dim<2>{3, 4}};
+
+    ASSERT_THROW(assembler.insert(this->rows, index_array{this->ref, {1}},
+                                  this->values),
+                 gko::ValueMismatch);
+}
+
+
+}  // namespace
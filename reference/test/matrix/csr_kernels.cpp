@@ -1306,6 +1306,103 @@ TYPED_TEST(Csr, ExtractsDiagonal)
 }
 
 
+TYPED_TEST(Csr, BuildsValueMap)
+{
+    using index_type = typename TestFixture::index_type;
+    using Arr = gko::Array<index_type>;
+
+    auto map = this->mtx->build_value_map(Arr{this->exec, {1, 0, 0, 1, 0, 0}},
+                                          Arr{this->exec, {1, 2, 0, 1, 0, 1}});
+
+    GKO_ASSERT_ARRAY_EQ(map.slot_ptrs, Arr(this->exec, {0, 2, 3, 4, 6}));
+    GKO_ASSERT_ARRAY_EQ(map.contribution_idxs,
+                        Arr(this->exec, {2, 4, 5, 1, 0, 3}));
+}
+
+
+TYPED_TEST(Csr, UpdatesValuesWithValueMap)
+{
+    using index_type = typename TestFixture::index_type;
+    using T = typename TestFixture::value_type;
+    using Arr = gko::Array<index_type>;
+    auto map = this->mtx->build_value_map(Arr{this->exec, {1, 0, 0, 1, 0, 0}},
+                                          Arr{this->exec, {1, 2, 0, 1, 0, 1}});
+    auto strategy = this->mtx->get_strategy();
+    auto srow = this->mtx->get_const_srow()[0];
+
+    this->mtx->update_values(
+        map, gko::Array<T>{this->exec, {1., 2., 3., 4., 5., 6.}});
+
+    GKO_ASSERT_MTX_NEAR(this->mtx, l({{8., 6., 2.}, {0., 5., 0.}}), 0.0);
+    ASSERT_EQ(this->mtx->get_strategy(), strategy);
+    ASSERT_EQ(this->mtx->get_num_srow_elements(), 1);
+    ASSERT_EQ(this->mtx->get_const_srow()[0], srow);
+}
+
+
+TYPED_TEST(Csr, UpdateValuesZeroesEntriesWithoutContributions)
+{
+    using index_type = typename TestFixture::index_type;
+    using T = typename TestFixture::value_type;
+    using Arr = gko::Array<index_type>;
+
+    this->mtx->update_values(Arr{this->exec, {0, 0}}, Arr{this->exec, {1, 1}},
+                             gko::Array<T>{this->exec, {2., 4.}});
+
+    GKO_ASSERT_MTX_NEAR(this->mtx, l({{0., 6., 0.}, {0., 0., 0.}}), 0.0);
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(Csr, UpdatesValuesFromPermutedValueArray)
+{
+    using index_type = typename TestFixture::index_type;
+    using T = typename TestFixture::value_type;
+    using Arr = gko::Array<index_type>;
+
+    this->mtx->update_values(Arr{this->exec, {1, 0, 0, 0}},
+                             Arr{this->exec, {1, 2, 1, 0}},
+                             gko::Array<T>{this->exec, {4., 3., 2., 1.}});
+
+    GKO_ASSERT_MTX_NEAR(this->mtx, l({{1., 2., 3.}, {0., 4., 0.}}), 0.0);
+}
+
+
+TYPED_TEST(Csr, BuildValueMapThrowsOnPositionOutsidePattern)
+{
+    using index_type = typename TestFixture::index_type;
+    using Arr = gko::Array<index_type>;
+
+    ASSERT_THROW(this->mtx->build_value_map(Arr{this->exec, {0, 1}},
+                                            Arr{this->exec, {1, 0}}),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Csr, BuildValueMapThrowsOnPositionOutsideMatrix)
+{
+    using index_type = typename TestFixture::index_type;
+    using Arr = gko::Array<index_type>;
+
+    ASSERT_THROW(this->mtx->build_value_map(Arr{this->exec, {0, 2}},
+                                            Arr{this->exec, {1, 0}}),
+                 gko::OutOfBoundsError);
+}
+
+
+TYPED_TEST(Csr, UpdateValuesThrowsOnWrongNumberOfContributions)
+{
+    using index_type = typename TestFixture::index_type;
+    using T = typename TestFixture::value_type;
+    using Arr = gko::Array<index_type>;
+    auto map = this->mtx->build_value_map(Arr{this->exec, {0, 1}},
+                                          Arr{this->exec, {1, 1}});
+
+    ASSERT_THROW(this->mtx->update_values(map, gko::Array<T>{this->exec, 3}),
+                 gko::ValueMismatch);
+}
+
+
 template <typename ValueIndexType>
 class CsrComplex : public ::testing::Test {
 protected:
@@ -0,0 +1,283 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm_reduction.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Stencil<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx1d(Mtx::create(exec, gko::dim<1>{4},
+                            gko::matrix::stencil_shape::star,
+                            gko::Array<value_type>{exec, {-1., 2., -1.}})),
+          mtx2d(Mtx::create(exec, gko::dim<2>{2, 2},
+                            gko::matrix::stencil_shape::star, true))
+    {
+        // the coefficient of stencil point p in row i is p + 1 + 10 * i
+        auto coeffs = mtx2d->get_coefficients();
+        for (int p = 0; p < 5; ++p) {
+            for (int i = 0; i < 4; ++i) {
+                coeffs[p * 4 + i] = static_cast<value_type>(p + 1 + 10 * i);
+            }
+        }
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx1d;
+    std::unique_ptr<Mtx> mtx2d;
+};
+
+TYPED_TEST_CASE(Stencil, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Stencil, ConvertsConstant1DToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx1d->convert_to(csr.get());
+
+    ASSERT_EQ(csr->get_num_stored_elements(), 10);
+    GKO_ASSERT_MTX_NEAR(csr,
+                        l({{2., -1., 0., 0.},
+                           {-1., 2., -1., 0.},
+                           {0., -1., 2., -1.},
+                           {0., 0., -1., 2.}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Stencil, ConvertsVariable2DToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx2d->convert_to(csr.get());
+
+    ASSERT_EQ(csr->get_num_stored_elements(), 12);
+    GKO_ASSERT_MTX_NEAR(csr,
+                        l({{3., 4., 5., 0.},
+                           {12., 13., 0., 15.},
+                           {21., 0., 23., 24.},
+                           {0., 31., 32., 33.}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Stencil, Converts3DBoxToCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec, gko::dim<3>{3, 3, 3},
+                           gko::matrix::stencil_shape::box);
+    for (int p = 0; p < 27; ++p) {
+        mtx->get_coefficients()[p] = static_cast<value_type>(p + 1);
+    }
+    auto csr = Csr::create(this->exec);
+    auto b = Vec::create(this->exec, gko::dim<2>{27, 1});
+    for (int i = 0; i < 27; ++i) {
+        b->at(i, 0) = static_cast<value_type>(i % 5 - 2);
+    }
+    auto x = Vec::create(this->exec, gko::dim<2>{27, 1});
+    auto expected = Vec::create(this->exec, gko::dim<2>{27, 1});
+
+    mtx->convert_to(csr.get());
+    mtx->apply(b.get(), x.get());
+    csr->apply(b.get(), expected.get());
+
+    ASSERT_EQ(csr->get_num_stored_elements(), 7 * 7 * 7);
+    ASSERT_TRUE(csr->is_sorted_by_column_index());
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    this->mtx1d->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({0.0, 0.0, 0.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesVariableCoefficientsToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    this->mtx2d->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({26.0, 98.0, 186.0, 290.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesToMultipleDenseVectors)
+{
+    using Csr = typename TestFixture::Csr;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto b = gko::initialize<Vec>(
+        {I<value_type>{1.0, -1.0}, I<value_type>{2.0, 0.5},
+         I<value_type>{3.0, 2.0}, I<value_type>{4.0, -3.0}},
+        this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 2});
+    auto expected = Vec::create(this->exec, gko::dim<2>{4, 2});
+    auto csr = Csr::create(this->exec);
+    this->mtx2d->convert_to(csr.get());
+
+    this->mtx2d->apply(b.get(), x.get());
+    csr->apply(b.get(), expected.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({2.0}, this->exec);
+    auto beta = gko::initialize<Vec>({-1.0}, this->exec);
+    auto b = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 1.0, 1.0, 1.0}, this->exec);
+
+    this->mtx1d->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-1.0, -1.0, -1.0, 9.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, ExtractsDiagonal)
+{
+    auto diag = this->mtx2d->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size(), gko::dim<2>(4, 4));
+    GKO_ASSERT_MTX_NEAR(diag,
+                        l({{3., 0., 0., 0.},
+                           {0., 13., 0., 0.},
+                           {0., 0., 23., 0.},
+                           {0., 0., 0., 33.}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Stencil, WritesToMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx1d->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(4, 4));
+    ASSERT_EQ(data.nonzeros.size(), 10);
+    EXPECT_EQ(data.nonzeros[1].row, 0);
+    EXPECT_EQ(data.nonzeros[1].column, 1);
+    EXPECT_EQ(data.nonzeros[1].value, value_type{-1.0});
+    EXPECT_EQ(data.nonzeros[9].row, 3);
+    EXPECT_EQ(data.nonzeros[9].column, 3);
+    EXPECT_EQ(data.nonzeros[9].value, value_type{2.0});
+}
+
+
+TYPED_TEST(Stencil, SolvesPoissonProblemWithJacobiPreconditionedCg)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Jacobi = gko::preconditioner::Jacobi<value_type, index_type>;
+    std::shared_ptr<Mtx> mtx = Mtx::create(
+        this->exec, gko::dim<2>{6, 6}, gko::matrix::stencil_shape::star,
+        gko::Array<value_type>{this->exec, {-1., -1., 4., -1., -1.}});
+    auto solver =
+        gko::solver::Cg<value_type>::build()
+            .with_preconditioner(
+                Jacobi::build().with_max_block_size(1u).on(this->exec))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(mtx);
+    auto expected = Vec::create(this->exec, gko::dim<2>{36, 1});
+    auto b = Vec::create(this->exec, gko::dim<2>{36, 1});
+    auto x = Vec::create(this->exec, gko::dim<2>{36, 1});
+    for (int i = 0; i < 36; ++i) {
+        expected->at(i, 0) = gko::one<value_type>();
+        x->at(i, 0) = gko::zero<value_type>();
+    }
+    mtx->apply(expected.get(), b.get());
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
@@ -36,6 +36,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <type_traits>
 
 
@@ -921,4 +922,119 @@ TYPED_TEST(Isai, ReturnsConjTransposedCorrectInverseU)
 }
 
 
+TYPED_TEST(Isai, KernelGeneratesGeneralInverseFromLeastSquares)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::initialize<Csr>(
+        {{2., 1., 0.}, {1., 2., 1.}, {0., 1., 2.}}, this->exec);
+    auto inverse = this->clone_allocations(mtx.get());
+
+    gko::kernels::reference::isai::generate_general_inverse(
+        this->exec, mtx.get(), inverse.get());
+
+    // the first and last row are least-squares solutions, the middle row has
+    // a full pattern and is exact
+    GKO_ASSERT_MTX_EQ_SPARSITY(inverse, mtx);
+    GKO_ASSERT_MTX_NEAR(inverse,
+                        l({{8. / 14., -3. / 14., 0.},
+                           {-.5, 1., -.5},
+                           {0., -3. / 14., 8. / 14.}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Isai, GeneralIsaiWithFullPatternIsExactInverse)
+{
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using GeneralIsai = gko::preconditioner::GeneralIsai<
+        typename TestFixture::value_type, typename TestFixture::index_type>;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {{4., 1., 0.}, {2., 5., 1.}, {0., 3., 6.}}, this->exec));
+    auto dense_mtx = Dense::create(this->exec);
+    mtx->convert_to(dense_mtx.get());
+    auto product = Dense::create(this->exec, mtx->get_size());
+
+    // the second power of a tridiagonal 3x3 matrix is dense
+    auto isai =
+        GeneralIsai::build().with_sparsity_power(2).on(this->exec)->generate(
+            mtx);
+    isai->get_approximate_inverse()->apply(dense_mtx.get(), product.get());
+
+    GKO_ASSERT_MTX_NEAR(product, l({{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Isai, GeneralIsaiAppliesApproximateInverse)
+{
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using GeneralIsai = gko::preconditioner::GeneralIsai<
+        typename TestFixture::value_type, typename TestFixture::index_type>;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {{2., 1., 0.}, {1., 2., 1.}, {0., 1., 2.}}, this->exec));
+    auto b = gko::initialize<Dense>({14., 14., 14.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{3, 1});
+
+    GeneralIsai::build().on(this->exec)->generate(mtx)->apply(b.get(),
+                                                               x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({5., 0., 5.}), r<value_type>::value * 14);
+}
+
+
+TYPED_TEST(Isai, ReturnsTransposedGeneralIsai)
+{
+    using Csr = typename TestFixture::Csr;
+    using GeneralIsai = gko::preconditioner::GeneralIsai<
+        typename TestFixture::value_type, typename TestFixture::index_type>;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {{4., 1., 0.}, {2., 5., 1.}, {0., 3., 6.}}, this->exec));
+    const auto isai = GeneralIsai::build().on(this->exec)->generate(mtx);
+
+    auto transp = gko::as<GeneralIsai>(isai->transpose());
+
+    GKO_ASSERT_MTX_NEAR(
+        gko::as<Csr>(transp->get_approximate_inverse()->transpose()),
+        isai->get_approximate_inverse(), 0);
+}
+
+
+TYPED_TEST(Isai, SavesAndLoadsInverseL)
+{
+    using LowerIsai = typename TestFixture::LowerIsai;
+    const auto isai = this->lower_isai_factory->generate(this->l_sparse);
+    std::stringstream stream;
+    isai->save(stream, this->l_sparse.get());
+
+    auto loaded = LowerIsai::load(stream, this->lower_isai_factory.get(),
+                                  this->l_sparse.get());
+
+    ASSERT_EQ(loaded->get_size(), isai->get_size());
+    GKO_ASSERT_MTX_EQ_SPARSITY(loaded->get_approximate_inverse(),
+                               isai->get_approximate_inverse());
+    GKO_ASSERT_MTX_NEAR(loaded->get_approximate_inverse(),
+                        isai->get_approximate_inverse(), 0.0);
+}
+
+
+TYPED_TEST(Isai, LoadThrowsForDifferentIsaiType)
+{
+    using UpperIsai = typename TestFixture::UpperIsai;
+    const auto isai = this->lower_isai_factory->generate(this->l_sparse);
+    std::stringstream stream;
+    isai->save(stream, this->l_sparse.get());
+    auto upper_isai_factory = UpperIsai::build().on(this->exec);
+
+    ASSERT_THROW(UpperIsai::load(stream, upper_isai_factory.get(),
+                                 this->l_sparse.get()),
+                 gko::StreamError);
+}
+
+
 }  // namespace
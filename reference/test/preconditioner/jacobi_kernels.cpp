@@ -34,6 +34,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
 #include <type_traits>
 
 
@@ -920,4 +924,174 @@ TYPED_TEST(Jacobi, ConvertsEmptyToDense)
 }
 
 
+TYPED_TEST(Jacobi, UpdatesValues)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto bj = this->bj_factory->generate(this->mtx);
+    auto blocks = bj->get_blocks();
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    for (gko::size_type i = 0; i < new_mtx->get_num_stored_elements(); ++i) {
+        new_mtx->get_values()[i] *= value_type{2.0};
+    }
+
+    bj->update_values(new_mtx);
+
+    ASSERT_EQ(bj->get_blocks(), blocks);
+    ASSERT_EQ(bj->get_num_blocks(), 2);
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(bj,
+        l({{2.0 / 14, 1.0 / 14,      0.0,      0.0,      0.0},
+           {0.5 / 14, 2.0 / 14,      0.0,      0.0,      0.0},
+           {     0.0,      0.0, 7.0 / 48, 4.0 / 48, 2.0 / 48},
+           {     0.0,      0.0, 2.0 / 48, 8.0 / 48, 4.0 / 48},
+           {     0.0,      0.0, 0.5 / 48, 2.0 / 48, 7.0 / 48}}),
+        r<value_type>::value);
+    // clang-format on
+}
+
+
+TYPED_TEST(Jacobi, UpdatesValuesWithAdaptivePrecision)
+{
+    using Bj = typename TestFixture::Bj;
+    using T = typename TestFixture::value_type;
+    auto bj_factory =
+        Bj::build()
+            .with_max_block_size(17u)
+            .with_block_pointers(this->block_pointers)
+            .with_storage_optimization(gko::Array<gko::precision_reduction>(
+                this->exec, {gko::precision_reduction::autodetect()}))
+            .with_accuracy(gko::remove_complex<T>{1.5e-3})
+            .on(this->exec);
+    auto bj = bj_factory->generate(this->mtx);
+    // remove the coupling inside of the diagonal blocks, which makes them
+    // perfectly conditioned
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    this->template init_array<T>(
+        new_mtx->get_values(),
+        {4.0, 0.0, -2.0, 0.0, 4.0, 4.0, 0.0, 0.0, 4.0, 0.0, -1.0, 0.0, 4.0});
+
+    bj->update_values(new_mtx);
+
+    auto expected = bj_factory->generate(new_mtx);
+    auto prec =
+        bj->get_parameters().storage_optimization.block_wise.get_const_data();
+    auto expected_prec = expected->get_parameters()
+                             .storage_optimization.block_wise.get_const_data();
+    EXPECT_EQ(prec[0], expected_prec[0]);
+    EXPECT_EQ(prec[1], expected_prec[1]);
+    GKO_ASSERT_MTX_NEAR(bj, expected, 0.0);
+}
+
+
+TYPED_TEST(Jacobi, SavesAndLoadsAdaptivePrecision)
+{
+    using Bj = typename TestFixture::Bj;
+    using T = typename TestFixture::value_type;
+    auto bj_factory =
+        Bj::build()
+            .with_max_block_size(17u)
+            .with_block_pointers(this->block_pointers)
+            .with_storage_optimization(gko::Array<gko::precision_reduction>(
+                this->exec, {gko::precision_reduction::autodetect()}))
+            .with_accuracy(gko::remove_complex<T>{1.5e-3})
+            .on(this->exec);
+    auto bj = bj_factory->generate(this->mtx);
+    std::stringstream stream;
+    bj->save(stream, this->mtx.get());
+
+    auto loaded = Bj::load(stream, bj_factory.get(), this->mtx.get());
+
+    ASSERT_EQ(loaded->get_size(), bj->get_size());
+    ASSERT_EQ(loaded->get_num_blocks(), 2);
+    auto prec = loaded->get_parameters()
+                    .storage_optimization.block_wise.get_const_data();
+    auto expected_prec =
+        bj->get_parameters().storage_optimization.block_wise.get_const_data();
+    EXPECT_EQ(prec[0], expected_prec[0]);
+    EXPECT_EQ(prec[1], expected_prec[1]);
+    GKO_ASSERT_MTX_NEAR(loaded, bj, 0.0);
+}
+
+
+TYPED_TEST(Jacobi, LoadedPreconditionerUpdatesValues)
+{
+    using Bj = typename TestFixture::Bj;
+    using value_type = typename TestFixture::value_type;
+    std::stringstream stream;
+    this->bj_factory->generate(this->mtx)->save(stream, this->mtx.get());
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    for (gko::size_type i = 0; i < new_mtx->get_num_stored_elements(); ++i) {
+        new_mtx->get_values()[i] *= value_type{2.0};
+    }
+    auto loaded = Bj::load(stream, this->bj_factory.get(), this->mtx.get());
+
+    loaded->update_values(new_mtx);
+
+    GKO_ASSERT_MTX_NEAR(loaded, this->bj_factory->generate(new_mtx), 0.0);
+}
+
+
+TYPED_TEST(Jacobi, LoadThrowsForDifferentMatrix)
+{
+    using Bj = typename TestFixture::Bj;
+    using value_type = typename TestFixture::value_type;
+    std::stringstream stream;
+    this->bj_factory->generate(this->mtx)->save(stream, this->mtx.get());
+    auto new_mtx = gko::clone(this->mtx);
+    new_mtx->get_values()[0] = value_type{5.0};
+
+    ASSERT_THROW(Bj::load(stream, this->bj_factory.get(), new_mtx.get()),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(Jacobi, LoadThrowsForBlockLargerThanMaxBlockSize)
+{
+    using Bj = typename TestFixture::Bj;
+    using index_type = typename TestFixture::index_type;
+    std::stringstream stream;
+    this->bj_factory->generate(this->mtx)->save(stream, this->mtx.get());
+    auto data = stream.str();
+    // skip the header, the block size parameters, the storage optimization
+    // and the number of block pointers
+    const auto offset = 56 + 2 * sizeof(gko::uint32) + sizeof(gko::uint8) +
+                        sizeof(gko::precision_reduction) +
+                        sizeof(std::uint64_t);
+    // the second block now spans 4 rows, max_block_size is 3
+    const index_type block_pointer = 1;
+    std::memcpy(&data[offset + sizeof(index_type)], &block_pointer,
+                sizeof(block_pointer));
+    std::stringstream corrupted{data};
+
+    ASSERT_THROW(Bj::load(corrupted, this->bj_factory.get(), this->mtx.get()),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(Jacobi, LoadThrowsForWrongNumberOfPrecisions)
+{
+    using Bj = typename TestFixture::Bj;
+    using index_type = typename TestFixture::index_type;
+    std::stringstream stream;
+    this->bj_factory->generate(this->mtx)->save(stream, this->mtx.get());
+    auto data = stream.str();
+    // skip the header, the block size parameters, the storage optimization
+    // and the three block pointers to reach the empty block-wise precisions
+    const auto offset = 56 + 2 * sizeof(gko::uint32) + sizeof(gko::uint8) +
+                        sizeof(gko::precision_reduction) +
+                        sizeof(std::uint64_t) + 3 * sizeof(index_type);
+    // store a single precision for the two blocks
+    const std::uint64_t num_precisions = 1;
+    std::memcpy(&data[offset], &num_precisions, sizeof(num_precisions));
+    const gko::precision_reduction precision{};
+    data.insert(offset + sizeof(num_precisions),
+                reinterpret_cast<const char *>(&precision), sizeof(precision));
+    std::stringstream corrupted{data};
+
+    ASSERT_THROW(Bj::load(corrupted, this->bj_factory.get(), this->mtx.get()),
+                 gko::StreamError);
+}
+
+
 }  // namespace
@@ -0,0 +1,244 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/polynomial.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Polynomial : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Polynomial_type = gko::preconditioner::Polynomial<value_type>;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    using Dense = gko::matrix::Dense<value_type>;
+
+    Polynomial()
+        : exec(gko::ReferenceExecutor::create()),
+          spd(gko::initialize<Csr>(
+              {I<value_type>{4., 1.}, I<value_type>{1., 4.}}, exec)),
+          rotation(gko::initialize<Csr>(
+              {{1., -2., 0.}, {2., 1., 0.}, {0., 0., 3.}}, exec)),
+          laplace(gko::initialize<Csr>({{2., -1., 0., 0., 0.},
+                                        {-1., 2., -1., 0., 0.},
+                                        {0., -1., 2., -1., 0.},
+                                        {0., 0., -1., 2., -1.},
+                                        {0., 0., 0., -1., 2.}},
+                                       exec)),
+          neumann_factory(
+              Polynomial_type::build()
+                  .with_type(gko::preconditioner::polynomial_type::neumann)
+                  .with_degree(2u)
+                  .on(exec)),
+          gmres_factory(
+              Polynomial_type::build()
+                  .with_type(gko::preconditioner::polynomial_type::gmres)
+                  .with_degree(2u)
+                  .on(exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> spd;
+    std::shared_ptr<Csr> rotation;
+    std::shared_ptr<Csr> laplace;
+    std::unique_ptr<typename Polynomial_type::Factory> neumann_factory;
+    std::unique_ptr<typename Polynomial_type::Factory> gmres_factory;
+};
+
+TYPED_TEST_CASE(Polynomial, gko::test::ValueTypes);
+
+
+TYPED_TEST(Polynomial, NeumannOfDegreeZeroIsJacobi)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = TestFixture::Polynomial_type::build()
+                       .with_degree(0u)
+                       .on(this->exec)
+                       ->generate(this->spd);
+    auto b = gko::initialize<Dense>({1., 2.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{2, 1});
+
+    precond->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({0.25, 0.5}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Polynomial, AppliesNeumannSeries)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = this->neumann_factory->generate(this->spd);
+    auto b = gko::initialize<Dense>({1., 2.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{2, 1});
+
+    precond->apply(b.get(), x.get());
+
+    // x_0 = D^-1 b, x_{k+1} = x_k + D^-1 (b - A x_k)
+    GKO_ASSERT_MTX_NEAR(x, l({0.140625, 0.46875}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Polynomial, AppliesNeumannSeriesToMultipleVectors)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = this->neumann_factory->generate(this->spd);
+    auto b = gko::initialize<Dense>(
+        {I<value_type>{1., 2.}, I<value_type>{2., 4.}}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{2, 2});
+
+    precond->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{0.140625, 0.28125}, {0.46875, 0.9375}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Polynomial, AppliesNeumannSeriesAdvanced)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = this->neumann_factory->generate(this->spd);
+    auto alpha = gko::initialize<Dense>({2.0}, this->exec);
+    auto beta = gko::initialize<Dense>({-1.0}, this->exec);
+    auto b = gko::initialize<Dense>({1., 2.}, this->exec);
+    auto x = gko::initialize<Dense>({1., 1.}, this->exec);
+
+    precond->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-0.71875, -0.0625}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Polynomial, GmresPolynomialOfFullDegreeIsExactInverse)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = this->gmres_factory->generate(this->rotation);
+    auto b = gko::initialize<Dense>({1., 2., 3.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{3, 1});
+
+    precond->apply(b.get(), x.get());
+
+    // A^-1 = [[1, 2, 0], [-2, 1, 0], [0, 0, 5 / 3]] / 5
+    GKO_ASSERT_MTX_NEAR(x, l({1., 0., 1.}), r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Polynomial, GmresPolynomialCanBeAppliedRepeatedly)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = this->gmres_factory->generate(this->rotation);
+    auto b1 = gko::initialize<Dense>({1., 2., 3.}, this->exec);
+    auto b2 = gko::initialize<Dense>(
+        {I<value_type>{1., 5.}, I<value_type>{2., -5.}, I<value_type>{3., 0.}},
+        this->exec);
+    auto x1 = Dense::create(this->exec, gko::dim<2>{3, 1});
+    auto x2 = Dense::create(this->exec, gko::dim<2>{3, 2});
+
+    precond->apply(b1.get(), x1.get());
+    precond->apply(b2.get(), x2.get());
+    precond->apply(b1.get(), x1.get());
+
+    GKO_ASSERT_MTX_NEAR(x1, l({1., 0., 1.}), r<value_type>::value * 1e2);
+    GKO_ASSERT_MTX_NEAR(x2,
+                        l({I<value_type>{1., -1.}, I<value_type>{0., -3.},
+                           I<value_type>{1., 0.}}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Polynomial, GmresPolynomialRootsAreEigenvalues)
+{
+    using value_type = typename TestFixture::value_type;
+    using root_type = typename TestFixture::Polynomial_type::root_type;
+    auto precond = this->gmres_factory->generate(this->rotation);
+
+    auto roots = precond->get_roots();
+
+    // conjugate pairs are only stored once for real value types
+    const auto num_roots = gko::is_complex<value_type>() ? 3u : 2u;
+    ASSERT_EQ(roots.size(), num_roots);
+    // the root of largest magnitude comes first
+    ASSERT_NEAR(std::abs(roots[0] - root_type(3., 0.)), 0.,
+                r<value_type>::value * 1e2);
+    ASSERT_NEAR(std::abs(roots[1] - root_type(1., 2.)) *
+                    std::abs(roots[1] - root_type(1., -2.)),
+                0., r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Polynomial, GmresPolynomialReducesResidual)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    using real_type = gko::remove_complex<value_type>;
+    auto precond = this->gmres_factory->generate(this->laplace);
+    auto b = gko::initialize<Dense>({1., 1., 1., 1., 1.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{5, 1});
+    auto one = gko::initialize<Dense>({1.0}, this->exec);
+    auto neg_one = gko::initialize<Dense>({-1.0}, this->exec);
+    auto b_norm = gko::matrix::Dense<real_type>::create(this->exec,
+                                                        gko::dim<2>{1, 1});
+    auto res_norm = gko::matrix::Dense<real_type>::create(this->exec,
+                                                          gko::dim<2>{1, 1});
+    b->compute_norm2(b_norm.get());
+
+    precond->apply(b.get(), x.get());
+    this->laplace->apply(neg_one.get(), x.get(), one.get(), b.get());
+    b->compute_norm2(res_norm.get());
+
+    ASSERT_LT(res_norm->at(0, 0), 0.5 * b_norm->at(0, 0));
+}
+
+
+}  // namespace
@@ -0,0 +1,244 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/preconditioner/schwarz.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Schwarz : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Schwarz_type = gko::preconditioner::Schwarz<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using index_array = gko::Array<index_type>;
+
+    Schwarz()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Csr>({{4., -1., 0., 0., 0., 0.},
+                                    {-1., 4., -1., 0., 0., 0.},
+                                    {0., -1., 4., -1., 0., 0.},
+                                    {0., 0., -1., 4., -1., 0.},
+                                    {0., 0., 0., -1., 4., -1.},
+                                    {0., 0., 0., 0., -1., 4.}},
+                                   exec)),
+          ones(gko::initialize<Dense>({1., 1., 1., 1., 1., 1.}, exec)),
+          tol{r<value_type>::value}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> mtx;
+    std::unique_ptr<Dense> ones;
+    gko::remove_complex<value_type> tol;
+};
+
+TYPED_TEST_CASE(Schwarz, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Schwarz, PartitionsByNonzeros)
+{
+    using index_array = typename TestFixture::index_array;
+
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(2u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+
+    ASSERT_EQ(precond->get_num_subdomains(), 2);
+    GKO_ASSERT_ARRAY_EQ(precond->get_block_pointers(),
+                        index_array(this->exec, {0, 3, 6}));
+    GKO_ASSERT_ARRAY_EQ(precond->get_subdomain_pointers(),
+                        index_array(this->exec, {0, 3, 6}));
+    GKO_ASSERT_ARRAY_EQ(precond->get_subdomain_rows(),
+                        index_array(this->exec, {0, 1, 2, 3, 4, 5}));
+}
+
+
+TYPED_TEST(Schwarz, ExtendsSubdomainsByOverlap)
+{
+    using index_array = typename TestFixture::index_array;
+
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(2u)
+                       .with_overlap(1u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+
+    GKO_ASSERT_ARRAY_EQ(precond->get_block_pointers(),
+                        index_array(this->exec, {0, 3, 6}));
+    GKO_ASSERT_ARRAY_EQ(precond->get_subdomain_pointers(),
+                        index_array(this->exec, {0, 4, 8}));
+    GKO_ASSERT_ARRAY_EQ(precond->get_subdomain_rows(),
+                        index_array(this->exec, {0, 1, 2, 3, 2, 3, 4, 5}));
+    ASSERT_EQ(precond->get_local_factors()->get_size(), gko::dim<2>(8, 8));
+}
+
+
+TYPED_TEST(Schwarz, AppliesBlockJacobiWithoutOverlap)
+{
+    using Dense = typename TestFixture::Dense;
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(2u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+    auto x = Dense::create(this->exec, gko::dim<2>{6, 1});
+
+    precond->apply(this->ones.get(), x.get());
+
+    // ILU(0) of the tridiagonal blocks is exact
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({5. / 14., 6. / 14., 5. / 14., 5. / 14., 6. / 14.,
+                           5. / 14.}),
+                        this->tol);
+}
+
+
+TYPED_TEST(Schwarz, AppliesRestrictedSolutionWithOverlap)
+{
+    using Dense = typename TestFixture::Dense;
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(2u)
+                       .with_overlap(1u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+    auto x = Dense::create(this->exec, gko::dim<2>{6, 1});
+
+    precond->apply(this->ones.get(), x.get());
+
+    // each subdomain solves a 4x4 system, but only keeps its own block
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({4. / 11., 5. / 11., 5. / 11., 5. / 11., 5. / 11.,
+                           4. / 11.}),
+                        this->tol);
+}
+
+
+TYPED_TEST(Schwarz, SingleSubdomainSolvesExactlyForTridiagonalMatrix)
+{
+    using Dense = typename TestFixture::Dense;
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(1u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+    auto b = gko::initialize<Dense>({2., 4., 6., 8., 10., 19.}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{6, 1});
+
+    precond->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 2., 3., 4., 5., 6.}), this->tol * 10);
+}
+
+
+TYPED_TEST(Schwarz, AppliesToMultipleVectors)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(1u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+    auto b = gko::initialize<Dense>(
+        {I<value_type>{2., 1.}, I<value_type>{4., 1.}, I<value_type>{6., 1.},
+         I<value_type>{8., 1.}, I<value_type>{10., 1.},
+         I<value_type>{19., 1.}},
+        this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{6, 2});
+
+    precond->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({{1., 15. / 41.},
+                           {2., 19. / 41.},
+                           {3., 20. / 41.},
+                           {4., 20. / 41.},
+                           {5., 19. / 41.},
+                           {6., 15. / 41.}}),
+                        this->tol * 10);
+}
+
+
+TYPED_TEST(Schwarz, AppliesAdvanced)
+{
+    using Dense = typename TestFixture::Dense;
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(1u)
+                       .on(this->exec)
+                       ->generate(this->mtx);
+    auto alpha = gko::initialize<Dense>({2.0}, this->exec);
+    auto beta = gko::initialize<Dense>({-1.0}, this->exec);
+    auto b = gko::initialize<Dense>({2., 4., 6., 8., 10., 19.}, this->exec);
+    auto x = gko::initialize<Dense>({1., 1., 1., 1., 1., 1.}, this->exec);
+
+    precond->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1., 3., 5., 7., 9., 11.}), this->tol * 10);
+}
+
+
+TYPED_TEST(Schwarz, InsertsMissingDiagonal)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {I<value_type>{2., 1.}, I<value_type>{1., 0.}}, this->exec));
+
+    auto precond = TestFixture::Schwarz_type::build()
+                       .with_num_subdomains(1u)
+                       .on(this->exec)
+                       ->generate(mtx);
+
+    ASSERT_EQ(precond->get_local_factors()->get_num_stored_elements(), 4);
+}
+
+
+}  // namespace
@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/convergence.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -186,6 +187,97 @@ TYPED_TEST(Cg, SolvesBigDenseSystem1)
 }
 
 
+TYPED_TEST(Cg, SolvesBigDenseSystemWithDeferredResidualCheck)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        TestFixture::Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .with_check_interval(4u)
+                    .with_adaptive_check_interval(true)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+// the iteration counts are recorded by a logger, which is never called if
+// logging is disabled
+#ifndef GINKGO_DISABLE_LOGGING
+
+
+TYPED_TEST(Cg, ImplicitResidualNormStopsLikeExplicitResidualNorm)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    const gko::size_type n = 50;
+    gko::matrix_data<value_type> mtx_data{gko::dim<2>{n}};
+    gko::matrix_data<value_type> identity_data{gko::dim<2>{n}};
+    gko::matrix_data<value_type> b_data{gko::dim<2>{n, 1}};
+    for (gko::size_type i = 0; i < n; ++i) {
+        if (i > 0) {
+            mtx_data.nonzeros.emplace_back(i, i - 1, -1.0);
+        }
+        mtx_data.nonzeros.emplace_back(i, i, 2.0);
+        if (i < n - 1) {
+            mtx_data.nonzeros.emplace_back(i, i + 1, -1.0);
+        }
+        identity_data.nonzeros.emplace_back(i, i, 1.0);
+        b_data.nonzeros.emplace_back(i, 0, static_cast<double>(i % 3) - 1.0);
+    }
+    auto mtx = gko::share(Mtx::create(this->exec));
+    mtx->read(mtx_data);
+    // an explicit identity matrix is not detected as missing preconditioner,
+    // so the criterion computes the residual norm explicitly
+    auto identity = gko::share(Mtx::create(this->exec));
+    identity->read(identity_data);
+    auto b = Mtx::create(this->exec);
+    b->read(b_data);
+    auto solve = [&](std::shared_ptr<const gko::LinOp> precond) {
+        auto logger = gko::share(gko::log::Convergence<value_type>::create(
+            this->exec, gko::log::Logger::criterion_check_completed_mask));
+        auto criterion =
+            gko::share(gko::stop::ResidualNormReduction<value_type>::build()
+                           .with_reduction_factor(r<value_type>::value)
+                           .on(this->exec));
+        criterion->add_logger(logger);
+        auto solver = TestFixture::Solver::build()
+                          .with_criteria(gko::stop::Iteration::build()
+                                             .with_max_iters(200u)
+                                             .on(this->exec),
+                                         criterion)
+                          .with_generated_preconditioner(precond)
+                          .on(this->exec)
+                          ->generate(mtx);
+        auto x = Mtx::create(this->exec);
+        x->read(gko::matrix_data<value_type>{gko::dim<2>{n, 1}});
+        solver->apply(b.get(), x.get());
+        return logger->get_num_iterations();
+    };
+
+    auto num_iters_implicit = solve(nullptr);
+
+    ASSERT_EQ(num_iters_implicit, solve(identity));
+}
+
+
+#endif  // GINKGO_DISABLE_LOGGING
+
+
 TYPED_TEST(Cg, SolvesBigDenseSystem2)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -0,0 +1,305 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/deflated_cg.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/convergence.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class DeflatedCg : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    using Solver = gko::solver::DeflatedCg<value_type>;
+
+    DeflatedCg()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(4u).on(exec),
+                      gko::stop::ResidualNormReduction<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value)
+                          .on(exec))
+                  .on(exec)),
+          laplacian(create_laplacian(100, 2.0)),
+          factory_big(Solver::build()
+                          .with_criteria(gko::stop::Iteration::build()
+                                             .with_max_iters(400u)
+                                             .on(exec))
+                          .with_deflation_dim(4u)
+                          .with_krylov_dim(40u)
+                          .on(exec))
+    {}
+
+    // 1D Laplacian with the given diagonal value
+    std::shared_ptr<Csr> create_laplacian(gko::size_type n, double diag)
+    {
+        gko::matrix_data<value_type, gko::int32> data{gko::dim<2>{n, n}};
+        for (gko::size_type i = 0; i < n; ++i) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, diag);
+            if (i < n - 1) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto result = gko::share(Csr::create(exec));
+        result->read(data);
+        return result;
+    }
+
+    std::unique_ptr<Mtx> create_rhs(gko::size_type n, int seed)
+    {
+        auto result = Mtx::create(exec, gko::dim<2>{n, 1});
+        for (gko::size_type i = 0; i < n; ++i) {
+            result->at(i, 0) = static_cast<value_type>(((i * seed) % 7) - 3.0);
+        }
+        return result;
+    }
+
+    // solves with a zero initial guess and returns the number of iterations
+    gko::size_type solve(Solver *solver, const Mtx *b)
+    {
+        auto x = Mtx::create(exec, b->get_size());
+        for (gko::size_type i = 0; i < b->get_size()[0]; ++i) {
+            x->at(i, 0) = gko::zero<value_type>();
+        }
+        auto logger = gko::share(gko::log::Convergence<value_type>::create(
+            exec, gko::log::Logger::criterion_check_completed_mask));
+        auto criterion =
+            gko::share(gko::stop::ResidualNormReduction<value_type>::build()
+                           .with_reduction_factor(
+                               gko::remove_complex<value_type>{1e-4})
+                           .on(exec));
+        criterion->add_logger(logger);
+        solver->set_stop_criterion_factory(
+            gko::stop::Combined::build()
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(400u).on(
+                        exec),
+                    criterion)
+                .on(exec));
+        solver->apply(b, x.get());
+        return logger->get_num_iterations();
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> factory;
+    std::shared_ptr<Csr> laplacian;
+    std::unique_ptr<typename Solver::Factory> factory_big;
+};
+
+TYPED_TEST_CASE(DeflatedCg, gko::test::ValueTypes);
+
+
+TYPED_TEST(DeflatedCg, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(DeflatedCg, SolvesStencilSystemWithDeflationSpace)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    solver->set_deflation_space(
+        gko::initialize<Mtx>({1.0, 1.0, 1.0}, this->exec));
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(DeflatedCg, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->factory->generate(this->mtx);
+    solver->set_deflation_space(
+        gko::initialize<Mtx>({1.0, 1.0, 1.0}, this->exec));
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(DeflatedCg, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(DeflatedCg, ComputesAOrthonormalDeflationSpace)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->factory_big->generate(this->laplacian);
+    auto b = this->create_rhs(100, 3);
+
+    this->solve(solver.get(), b.get());
+
+    auto space = solver->get_deflation_space();
+    ASSERT_NE(space, nullptr);
+    ASSERT_EQ(space->get_size(), gko::dim<2>(100, 4));
+    auto a_space = Mtx::create(this->exec, space->get_size());
+    auto product = Mtx::create(this->exec, gko::dim<2>{4, 4});
+    this->laplacian->apply(space.get(), a_space.get());
+    gko::as<Mtx>(space->conj_transpose())->apply(a_space.get(), product.get());
+    GKO_ASSERT_MTX_NEAR(product,
+                        l({{1.0, 0.0, 0.0, 0.0},
+                           {0.0, 1.0, 0.0, 0.0},
+                           {0.0, 0.0, 1.0, 0.0},
+                           {0.0, 0.0, 0.0, 1.0}}),
+                        r<value_type>::value * 1e2);
+}
+
+
+// the iteration counts are recorded by a logger, which is never called if
+// logging is disabled
+#ifndef GINKGO_DISABLE_LOGGING
+
+
+TYPED_TEST(DeflatedCg, RecyclingReducesIterations)
+{
+    auto solver = this->factory_big->generate(this->laplacian);
+    auto reference = this->factory_big->generate(this->laplacian);
+    auto b1 = this->create_rhs(100, 3);
+    auto b2 = this->create_rhs(100, 5);
+    this->solve(solver.get(), b1.get());
+
+    auto num_iters = this->solve(solver.get(), b2.get());
+
+    auto num_iters_reference = this->solve(reference.get(), b2.get());
+    ASSERT_LT(num_iters, num_iters_reference);
+}
+
+
+TYPED_TEST(DeflatedCg, RecyclesDeflationSpaceForNewMatrix)
+{
+    auto solver = this->factory_big->generate(this->laplacian);
+    auto shifted = this->create_laplacian(100, 2.0001);
+    auto new_solver = this->factory_big->generate(shifted);
+    auto reference = this->factory_big->generate(shifted);
+    auto b1 = this->create_rhs(100, 3);
+    auto b2 = this->create_rhs(100, 5);
+    this->solve(solver.get(), b1.get());
+    this->solve(solver.get(), b2.get());
+
+    new_solver->set_deflation_space(solver->get_deflation_space());
+    auto num_iters = this->solve(new_solver.get(), b2.get());
+
+    auto num_iters_reference = this->solve(reference.get(), b2.get());
+    ASSERT_LT(num_iters, num_iters_reference);
+}
+
+
+TYPED_TEST(DeflatedCg, TransposeKeepsDeflationSpace)
+{
+    using Solver = typename TestFixture::Solver;
+    auto solver = this->factory_big->generate(this->laplacian);
+    auto reference = this->factory_big->generate(this->laplacian);
+    auto b1 = this->create_rhs(100, 3);
+    auto b2 = this->create_rhs(100, 5);
+    this->solve(solver.get(), b1.get());
+
+    auto transposed = gko::as<Solver>(solver->transpose());
+    auto conj_transposed = gko::as<Solver>(solver->conj_transpose());
+
+    ASSERT_NE(transposed->get_deflation_space(), nullptr);
+    ASSERT_NE(conj_transposed->get_deflation_space(), nullptr);
+    ASSERT_EQ(transposed->get_deflation_space()->get_size(),
+              gko::dim<2>(100, 4));
+    ASSERT_EQ(conj_transposed->get_deflation_space()->get_size(),
+              gko::dim<2>(100, 4));
+    auto num_iters_reference = this->solve(reference.get(), b2.get());
+    ASSERT_LT(this->solve(transposed.get(), b2.get()), num_iters_reference);
+    ASSERT_LT(this->solve(conj_transposed.get(), b2.get()),
+              num_iters_reference);
+}
+
+
+#endif  // GINKGO_DISABLE_LOGGING
+
+
+}  // namespace
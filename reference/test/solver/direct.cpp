@@ -0,0 +1,169 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/direct.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/cholesky.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Direct : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using CsrMtx = gko::matrix::Csr<value_type, index_type>;
+    using Solver = gko::solver::Direct<value_type, index_type>;
+
+    Direct()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<CsrMtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          b(gko::initialize<Mtx>({0.0, 0.0, 4.0}, exec)),
+          tol{r<value_type>::value}
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<CsrMtx> mtx;
+    std::shared_ptr<Mtx> b;
+    gko::remove_complex<value_type> tol;
+};
+
+TYPED_TEST_CASE(Direct, gko::test::ValueIndexTypes);
+
+
+TYPED_TEST(Direct, SolvesSystemWithLu)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto solver = Solver::build().on(this->exec)->generate(this->mtx);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(this->b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 2.0, 3.0}), this->tol);
+}
+
+
+TYPED_TEST(Direct, SolvesSystemWithCholesky)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto solver =
+        Solver::build()
+            .with_factorization(
+                gko::factorization::Cholesky<value_type, index_type>::build()
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(this->b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 2.0, 3.0}), this->tol);
+}
+
+
+TYPED_TEST(Direct, SolvesMultipleRhs)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using T = typename TestFixture::value_type;
+    auto solver =
+        Solver::build().with_num_rhs(2u).on(this->exec)->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{0.0, 1.0}, I<T>{0.0, 0.0}, I<T>{4.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {2.0, 1.0}, {3.0, 1.0}}),
+                        this->tol);
+}
+
+
+TYPED_TEST(Direct, SolvesAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto solver = Solver::build().on(this->exec)->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({1.0, -1.0, 1.0}, this->exec);
+
+    solver->apply(alpha.get(), this->b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 5.0, 5.0}), this->tol * 1e1);
+}
+
+
+TYPED_TEST(Direct, SolvesTransposedSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    using Solver = typename TestFixture::Solver;
+    auto mtx = gko::share(gko::initialize<CsrMtx>(
+        {{2, -1.0, 0.0}, {-2.0, 2, -1.0}, {0.0, -1.0, 2}}, this->exec));
+    auto solver = Solver::build().on(this->exec)->generate(mtx);
+    auto b = gko::initialize<Mtx>({-2.0, 0.0, 4.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 2.0, 3.0}), this->tol);
+}
+
+
+}  // namespace
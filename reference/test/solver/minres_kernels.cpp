@@ -0,0 +1,286 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2020, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/minres.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/convergence.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Minres : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Minres<value_type>;
+
+    Minres()
+        : exec(gko::ReferenceExecutor::create()),
+          spd_mtx(gko::initialize<Mtx>(
+              {{2.0, -1.0, 0.0}, {-1.0, 2.0, -1.0}, {0.0, -1.0, 2.0}}, exec)),
+          indefinite_mtx(gko::initialize<Mtx>(
+              {{1.0, 2.0, 0.0}, {2.0, -1.0, 3.0}, {0.0, 3.0, 1.0}}, exec)),
+          saddle_point_mtx(
+              gko::initialize<Mtx>({{4.0, 1.0, 0.0, 0.0, 1.0, 0.0},
+                                    {1.0, 4.0, 1.0, 0.0, 0.0, 1.0},
+                                    {0.0, 1.0, 4.0, 1.0, 1.0, 0.0},
+                                    {0.0, 0.0, 1.0, 4.0, 0.0, 1.0},
+                                    {1.0, 0.0, 1.0, 0.0, 0.0, 0.0},
+                                    {0.0, 1.0, 0.0, 1.0, 0.0, 0.0}},
+                                   exec)),
+          minres_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(20u).on(
+                          exec),
+                      gko::stop::ResidualNormReduction<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value)
+                          .on(exec))
+                  .on(exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> spd_mtx;
+    std::shared_ptr<Mtx> indefinite_mtx;
+    std::shared_ptr<Mtx> saddle_point_mtx;
+    std::unique_ptr<typename Solver::Factory> minres_factory;
+};
+
+TYPED_TEST_CASE(Minres, gko::test::ValueTypes);
+
+
+TYPED_TEST(Minres, SolvesSpdSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->minres_factory->generate(this->spd_mtx);
+    auto b = gko::initialize<Mtx>({1.0, 0.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 1.0, 1.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesIndefiniteSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->minres_factory->generate(this->indefinite_mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 9.0, -1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesIndefiniteSystemWithInitialGuess)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->minres_factory->generate(this->indefinite_mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 9.0, -1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({1.0, 1.0, 1.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesMultipleIndefiniteSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->minres_factory->generate(this->indefinite_mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 3.0}, I<T>{9.0, 4.0}, I<T>{-1.0, 4.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {-1.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesIndefiniteSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->minres_factory->generate(this->indefinite_mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 9.0, -1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, -3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesSaddlePointSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->minres_factory->generate(this->saddle_point_mtx);
+    auto b =
+        gko::initialize<Mtx>({1.0, 0.0, 5.5, 5.0, 3.0, -0.5}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0, 0.5, -2.0, 1.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(Minres, SolvesSpdSystemWithJacobiPreconditioner)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        TestFixture::Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(20u).on(
+                    this->exec),
+                gko::stop::ResidualNormReduction<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->spd_mtx);
+    auto b = gko::initialize<Mtx>({1.0, 0.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 1.0, 1.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Minres, SolvesTransposedIndefiniteSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        this->minres_factory->generate(this->indefinite_mtx->transpose());
+    auto b = gko::initialize<Mtx>({-1.0, 9.0, -1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, -1.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+// the iteration counts are recorded by a logger, which is never called if
+// logging is disabled
+#ifndef GINKGO_DISABLE_LOGGING
+
+
+TYPED_TEST(Minres, MeasuresInitialResidualInPreconditionedNorm)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    // scaling the preconditioner scales the preconditioned residual norm, but
+    // does not change the iterates or their relative residual reduction
+    auto solve = [&](std::shared_ptr<const gko::LinOp> precond) {
+        auto logger = gko::share(gko::log::Convergence<value_type>::create(
+            this->exec, gko::log::Logger::criterion_check_completed_mask));
+        auto criterion =
+            gko::share(gko::stop::ResidualNormReduction<value_type>::build()
+                           .with_reduction_factor(
+                               gko::remove_complex<value_type>{1e-2})
+                           .on(this->exec));
+        criterion->add_logger(logger);
+        auto solver =
+            TestFixture::Solver::build()
+                .with_criteria(gko::stop::Iteration::build()
+                                   .with_max_iters(20u)
+                                   .on(this->exec),
+                               criterion)
+                .with_generated_preconditioner(precond)
+                .on(this->exec)
+                ->generate(this->saddle_point_mtx);
+        auto b =
+            gko::initialize<Mtx>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+        auto x =
+            gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+        solver->apply(b.get(), x.get());
+        return logger->get_num_iterations();
+    };
+    auto scaled_identity = gko::share(gko::initialize<Mtx>(
+        {{1e-4, 0.0, 0.0, 0.0, 0.0, 0.0},
+         {0.0, 1e-4, 0.0, 0.0, 0.0, 0.0},
+         {0.0, 0.0, 1e-4, 0.0, 0.0, 0.0},
+         {0.0, 0.0, 0.0, 1e-4, 0.0, 0.0},
+         {0.0, 0.0, 0.0, 0.0, 1e-4, 0.0},
+         {0.0, 0.0, 0.0, 0.0, 0.0, 1e-4}},
+        this->exec));
+
+    auto num_iters_scaled = solve(scaled_identity);
+
+    ASSERT_GT(num_iters_scaled, 0u);
+    ASSERT_EQ(num_iters_scaled, solve(nullptr));
+}
+
+
+#endif  // GINKGO_DISABLE_LOGGING
+
+
+}  // namespace
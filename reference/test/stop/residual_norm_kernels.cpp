@@ -176,6 +176,132 @@ TYPED_TEST(ResidualNormReduction, WaitsTillResidualGoalMultipleRHS)
 }
 
 
+TYPED_TEST(ResidualNormReduction, DefaultsToCheckingEveryIteration)
+{
+    ASSERT_EQ(this->factory_->get_parameters().check_interval, 1u);
+    ASSERT_FALSE(this->factory_->get_parameters().adaptive_check_interval);
+}
+
+
+TYPED_TEST(ResidualNormReduction, ChecksOnlyEveryCheckInterval)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using NormVector = typename TestFixture::NormVector;
+    auto initial_res = gko::initialize<Mtx>({100.0}, this->exec_);
+    std::shared_ptr<gko::LinOp> rhs = gko::initialize<Mtx>({10.0}, this->exec_);
+    auto res_norm = gko::initialize<NormVector>({100.0}, this->exec_);
+    auto criterion = gko::stop::ResidualNormReduction<TypeParam>::build()
+                         .with_reduction_factor(r<TypeParam>::value)
+                         .with_check_interval(3u)
+                         .on(this->exec_)
+                         ->generate(nullptr, rhs, nullptr, initial_res.get());
+    bool one_changed{};
+    constexpr gko::uint8 RelativeStoppingId{1};
+    gko::Array<gko::stopping_status> stop_status(this->exec_, 1);
+    stop_status.get_data()[0].reset();
+
+    ASSERT_FALSE(
+        criterion->update()
+            .residual_norm(res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+    res_norm->at(0) = r<TypeParam>::value * 0.9e+2;
+    // the next two checks are skipped
+    ASSERT_FALSE(
+        criterion->update()
+            .residual_norm(res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+    ASSERT_FALSE(
+        criterion->update()
+            .residual_norm(res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), false);
+    ASSERT_EQ(one_changed, false);
+    ASSERT_TRUE(
+        criterion->update()
+            .residual_norm(res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), true);
+    ASSERT_EQ(one_changed, true);
+}
+
+
+TYPED_TEST(ResidualNormReduction, AdaptsCheckIntervalToConvergenceRate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using NormVector = typename TestFixture::NormVector;
+    auto initial_res = gko::initialize<Mtx>({100.0}, this->exec_);
+    std::shared_ptr<gko::LinOp> rhs = gko::initialize<Mtx>({10.0}, this->exec_);
+    auto res_norm = gko::initialize<NormVector>({100.0}, this->exec_);
+    auto criterion = gko::stop::ResidualNormReduction<TypeParam>::build()
+                         .with_reduction_factor(1e-3)
+                         .with_check_interval(100u)
+                         .with_adaptive_check_interval(true)
+                         .on(this->exec_)
+                         ->generate(nullptr, rhs, nullptr, initial_res.get());
+    bool one_changed{};
+    constexpr gko::uint8 RelativeStoppingId{1};
+    gko::Array<gko::stopping_status> stop_status(this->exec_, 1);
+    stop_status.get_data()[0].reset();
+    auto check = [&] {
+        return criterion->update()
+            .residual_norm(res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed);
+    };
+
+    ASSERT_FALSE(check());
+    // halving the norm per check predicts convergence after 9 more checks
+    res_norm->at(0) = 50.0;
+    ASSERT_FALSE(check());
+    // so the next 3 checks are skipped
+    res_norm->at(0) = 0.01;
+    ASSERT_FALSE(check());
+    ASSERT_FALSE(check());
+    ASSERT_FALSE(check());
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), false);
+    // the rate is unchanged, 5 more checks are predicted, 1 is skipped
+    res_norm->at(0) = 3.125;
+    ASSERT_FALSE(check());
+    res_norm->at(0) = 0.01;
+    ASSERT_FALSE(check());
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), false);
+    ASSERT_TRUE(check());
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), true);
+}
+
+
+TYPED_TEST(ResidualNormReduction, UsesImplicitResidualNorm)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto initial_res = gko::initialize<Mtx>({100.0}, this->exec_);
+    std::shared_ptr<gko::LinOp> rhs = gko::initialize<Mtx>({10.0}, this->exec_);
+    auto sq_res_norm = gko::initialize<Mtx>({1e+4}, this->exec_);
+    auto res = gko::initialize<Mtx>({0.0}, this->exec_);
+    auto criterion = gko::stop::ResidualNormReduction<TypeParam>::build()
+                         .with_reduction_factor(1e-3)
+                         .on(this->exec_)
+                         ->generate(nullptr, rhs, nullptr, initial_res.get());
+    bool one_changed{};
+    constexpr gko::uint8 RelativeStoppingId{1};
+    gko::Array<gko::stopping_status> stop_status(this->exec_, 1);
+    stop_status.get_data()[0].reset();
+
+    // the implicit norm takes precedence over the residual
+    ASSERT_FALSE(
+        criterion->update()
+            .residual(res.get())
+            .implicit_sq_residual_norm(sq_res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+
+    sq_res_norm->at(0) = 1e-4;
+    ASSERT_TRUE(
+        criterion->update()
+            .residual(res.get())
+            .implicit_sq_residual_norm(sq_res_norm.get())
+            .check(RelativeStoppingId, true, &stop_status, &one_changed));
+    ASSERT_EQ(stop_status.get_data()[0].has_converged(), true);
+}
+
+
 template <typename T>
 class RelativeResidualNorm : public ::testing::Test {
 protected: